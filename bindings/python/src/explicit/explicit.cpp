@@ -51,6 +51,7 @@
 #include "representation/core/structural_model.hpp"
 
 #include "representation/io/cross_section.hpp"
+#include "representation/io/io_trace.hpp"
 #include "representation/io/structural_model.hpp"
 
 PYBIND11_MODULE( opengeode_geosciences_py_explicit, module )
@@ -83,6 +84,7 @@ PYBIND11_MODULE( opengeode_geosciences_py_explicit, module )
 
     geode::define_structural_model_io( module );
     geode::define_cross_section_io( module );
+    geode::define_io_trace( module );
 
     geode::define_crs( module );
     geode::define_crs_helper( module );
@@ -24,6 +24,7 @@
 #include <geode/basic/attribute_manager.hpp>
 
 #include <geode/geosciences/explicit/geometry/geographic_coordinate_system.hpp>
+#include <geode/geosciences/explicit/geometry/geographic_coordinate_system_catalogue.hpp>
 
 #define PYTHON_CRS( dimension )                                                \
     const auto name##dimension =                                               \
@@ -58,5 +59,42 @@ namespace geode
             .def_readwrite( "name", &GeographicCoordinateSystemInfo::name );
         PYTHON_CRS( 2 );
         PYTHON_CRS( 3 );
+
+        pybind11::enum_< GeographicCoordinateSystemType >(
+            module, "GeographicCoordinateSystemType" )
+            .value(
+                "geographic_2d", GeographicCoordinateSystemType::geographic_2d )
+            .value(
+                "geographic_3d", GeographicCoordinateSystemType::geographic_3d )
+            .value( "geocentric", GeographicCoordinateSystemType::geocentric )
+            .value( "projected", GeographicCoordinateSystemType::projected )
+            .value( "vertical", GeographicCoordinateSystemType::vertical )
+            .value( "compound", GeographicCoordinateSystemType::compound )
+            .value( "other", GeographicCoordinateSystemType::other );
+        module
+            .def( "geographic_coordinate_system_catalogue",
+                []() {
+                    const auto catalogue =
+                        geographic_coordinate_system_catalogue();
+                    return std::vector< GeographicCoordinateSystemInfo >{
+                        catalogue.begin(), catalogue.end()
+                    };
+                } )
+            .def( "find_geographic_coordinate_system",
+                &find_geographic_coordinate_system )
+            .def( "is_geographic_coordinate_system_known",
+                &is_geographic_coordinate_system_known )
+            .def( "geographic_coordinate_system_type",
+                &geographic_coordinate_system_type )
+            .def( "geographic_coordinate_systems_with_name_prefix",
+                &geographic_coordinate_systems_with_name_prefix,
+                pybind11::arg( "prefix" ),
+                pybind11::arg( "type" ) = std::nullopt )
+            .def( "geographic_coordinate_systems_with_name_containing",
+                &geographic_coordinate_systems_with_name_containing,
+                pybind11::arg( "text" ),
+                pybind11::arg( "type" ) = std::nullopt )
+            .def( "geographic_coordinate_systems_of_type",
+                &geographic_coordinate_systems_of_type );
     }
 } // namespace geode
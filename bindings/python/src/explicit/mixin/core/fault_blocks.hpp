@@ -32,6 +32,10 @@
         .def( "nb_fault_blocks", &FaultBlocks##dimension##D::nb_fault_blocks ) \
         .def( "fault_block", &FaultBlocks##dimension##D::fault_block,          \
             pybind11::return_value_policy::reference )                         \
+        .def( "fault_block_id_from_name",                                      \
+            &FaultBlocks##dimension##D::fault_block_id_from_name )             \
+        .def( "fault_block_ids_from_names",                                    \
+            &FaultBlocks##dimension##D::fault_block_ids_from_names )           \
         .def(                                                                  \
             "fault_blocks",                                                    \
             []( const FaultBlocks##dimension##D& self ) {                      \
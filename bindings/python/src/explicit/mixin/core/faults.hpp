@@ -31,6 +31,10 @@
         .def( "nb_faults", &Faults##dimension##D::nb_faults )                  \
         .def( "fault", &Faults##dimension##D::fault,                           \
             pybind11::return_value_policy::reference )                         \
+        .def( "fault_id_from_name",                                            \
+            &Faults##dimension##D::fault_id_from_name )                        \
+        .def( "fault_ids_from_names",                                          \
+            &Faults##dimension##D::fault_ids_from_names )                      \
         .def(                                                                  \
             "faults",                                                          \
             []( const Faults##dimension##D& self ) {                           \
@@ -32,6 +32,10 @@
         .def( "nb_horizons", &Horizons##dimension##D::nb_horizons )            \
         .def( "horizon", &Horizons##dimension##D::horizon,                     \
             pybind11::return_value_policy::reference )                         \
+        .def( "horizon_id_from_name",                                          \
+            &Horizons##dimension##D::horizon_id_from_name )                    \
+        .def( "horizon_ids_from_names",                                        \
+            &Horizons##dimension##D::horizon_ids_from_names )                  \
         .def(                                                                  \
             "horizons",                                                        \
             []( const Horizons##dimension##D& self ) {                         \
@@ -34,6 +34,12 @@
         .def( "stratigraphic_unit",                                            \
             &StratigraphicUnits##dimension##D::stratigraphic_unit,             \
             pybind11::return_value_policy::reference )                         \
+        .def( "stratigraphic_unit_id_from_name",                               \
+            &StratigraphicUnits##dimension##D::                                \
+                stratigraphic_unit_id_from_name )                              \
+        .def( "stratigraphic_unit_ids_from_names",                             \
+            &StratigraphicUnits##dimension##D::                                \
+                stratigraphic_unit_ids_from_names )                            \
         .def(                                                                  \
             "stratigraphic_units",                                             \
             []( const StratigraphicUnits##dimension##D& self ) {               \
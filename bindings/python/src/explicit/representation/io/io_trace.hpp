@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/explicit/representation/io/io_trace.hpp>
+
+namespace geode
+{
+    void define_io_trace( pybind11::module& module )
+    {
+        pybind11::class_< IOTraceEvent >( module, "IOTraceEvent" )
+            .def_readonly( "category", &IOTraceEvent::category )
+            .def_readonly( "name", &IOTraceEvent::name )
+            .def_readonly( "start_seconds", &IOTraceEvent::start_seconds )
+            .def_readonly(
+                "duration_seconds", &IOTraceEvent::duration_seconds )
+            .def_readonly( "thread", &IOTraceEvent::thread );
+        module.def( "start_io_trace", &start_io_trace )
+            .def( "stop_io_trace", &stop_io_trace )
+            .def( "save_io_trace",
+                []( const std::vector< IOTraceEvent >& events,
+                    std::string_view filename ) {
+                    save_io_trace( events, filename );
+                } );
+    }
+} // namespace geode
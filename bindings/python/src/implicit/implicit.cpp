@@ -35,12 +35,15 @@
 #include "representation/builder/implicit_structural_model_builder.hpp"
 #include "representation/builder/stratigraphic_model_builder.hpp"
 #include "representation/builder/stratigraphic_section_builder.hpp"
+#include "representation/core/batch_queries.hpp"
 #include "representation/core/helpers.hpp"
 #include "representation/core/horizons_stack.hpp"
 #include "representation/core/implicit_cross_section.hpp"
 #include "representation/core/implicit_structural_model.hpp"
+#include "representation/core/instrumentation.hpp"
 #include "representation/core/stratigraphic_model.hpp"
 #include "representation/core/stratigraphic_section.hpp"
+#include "representation/core/volumetrics.hpp"
 #include "representation/io/horizons_stack.hpp"
 #include "representation/io/implicit_cross_section.hpp"
 #include "representation/io/implicit_structural_model.hpp"
@@ -78,4 +81,7 @@ PYBIND11_MODULE( opengeode_geosciences_py_implicit, module )
     geode::define_horizons_stack_io( module );
 
     geode::detail::define_implicit_model_helpers( module );
+    geode::define_instrumentation( module );
+    geode::define_batch_queries( module );
+    geode::define_volumetrics( module );
 }
\ No newline at end of file
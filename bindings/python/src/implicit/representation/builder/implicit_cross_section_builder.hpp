@@ -42,6 +42,10 @@ namespace geode
                     instantiate_implicit_attribute_on_surfaces )
             .def( "set_implicit_value",
                 &ImplicitCrossSectionBuilder::set_implicit_value )
+            .def( "set_implicit_value_transform",
+                &ImplicitCrossSectionBuilder::set_implicit_value_transform )
+            .def( "bake_implicit_value_transform",
+                &ImplicitCrossSectionBuilder::bake_implicit_value_transform )
             .def( "set_horizons_stack",
                 []( ImplicitCrossSectionBuilder& builder,
                     HorizonsStack2D& horizons_stack ) {
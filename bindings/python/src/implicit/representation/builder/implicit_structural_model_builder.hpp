@@ -22,6 +22,7 @@
  */
 
 #include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
 
 #include <geode/geometry/point.hpp>
 
@@ -37,11 +38,20 @@ namespace geode
                     const ImplicitStructuralModel& other_model ) {
                     builder.copy( other_model );
                 } )
+            .def( "compute_stratigraphic_unit_labels",
+                &ImplicitStructuralModelBuilder::
+                    compute_stratigraphic_unit_labels )
             .def( "instantiate_implicit_attribute_on_blocks",
                 &ImplicitStructuralModelBuilder::
                     instantiate_implicit_attribute_on_blocks )
             .def( "set_implicit_value",
                 &ImplicitStructuralModelBuilder::set_implicit_value )
+            .def( "set_implicit_value_transform",
+                &ImplicitStructuralModelBuilder::set_implicit_value_transform )
+            .def( "bake_implicit_value_transform",
+                &ImplicitStructuralModelBuilder::bake_implicit_value_transform )
+            .def( "set_implicit_value_precision",
+                &ImplicitStructuralModelBuilder::set_implicit_value_precision )
             .def( "set_horizons_stack",
                 []( ImplicitStructuralModelBuilder& builder,
                     HorizonsStack3D& horizons_stack ) {
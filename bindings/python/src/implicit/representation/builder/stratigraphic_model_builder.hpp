@@ -44,6 +44,9 @@ namespace geode
                 &StratigraphicModelBuilder::set_stratigraphic_location )
             .def( "set_stratigraphic_coordinates",
                 &StratigraphicModelBuilder::set_stratigraphic_coordinates )
+            .def( "set_interleaved_stratigraphic_coordinates",
+                &StratigraphicModelBuilder::
+                    set_interleaved_stratigraphic_coordinates )
             .def(
                 "import_old_stratigraphic_attribute_values_from_attribute_name",
                 &StratigraphicModelBuilder::
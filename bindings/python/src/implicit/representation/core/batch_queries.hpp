@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <pybind11/numpy.h>
+
+#include <geode/geosciences/implicit/representation/core/batch_queries.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_section.hpp>
+
+namespace geode
+{
+    using BatchArray = pybind11::array_t< double,
+        pybind11::array::c_style | pybind11::array::forcecast >;
+
+    /*!
+     * Objects that can be viewed in place as nb_values contiguous doubles:
+     * Point and StratigraphicPoint only hold their coordinates.
+     */
+    template < typename Type, index_t nb_values >
+    constexpr bool is_batch_viewable_v =
+        std::is_standard_layout_v< Type >
+        && sizeof( Type ) == nb_values * sizeof( double )
+        && alignof( Type ) == alignof( double );
+
+    /*!
+     * Views a (N, nb_values) float64 array as N objects made of nb_values
+     * contiguous doubles. No copy is made when the array given from Python is
+     * already a C-contiguous float64 array, otherwise forcecast converts it
+     * once. The view is only valid while the array is alive.
+     */
+    template < typename Type, index_t nb_values >
+    absl::Span< const Type > batch_input( const BatchArray& array )
+    {
+        static_assert( is_batch_viewable_v< Type, nb_values > );
+        OpenGeodeGeosciencesImplicitException::check_exception(
+            array.ndim() == 2 && array.shape( 1 ) == nb_values, nullptr,
+            OpenGeodeException::TYPE::data,
+            "[batch_input] Array should be of shape (N, ", nb_values, ")." );
+        return { reinterpret_cast< const Type* >( array.data() ),
+            static_cast< std::size_t >( array.shape( 0 ) ) };
+    }
+
+    /*!
+     * Allocates a (size, nb_values) float64 array and views it as size
+     * objects made of nb_values contiguous doubles, so that native results
+     * are written straight into the returned array.
+     */
+    template < typename Type, index_t nb_values >
+    std::pair< pybind11::array_t< double >, absl::Span< Type > > batch_output(
+        std::size_t size )
+    {
+        static_assert( is_batch_viewable_v< Type, nb_values > );
+        pybind11::array_t< double > array(
+            { size, static_cast< std::size_t >( nb_values ) } );
+        absl::Span< Type > output{
+            reinterpret_cast< Type* >( array.mutable_data() ), size
+        };
+        return { std::move( array ), output };
+    }
+
+    /*!
+     * Read-only (N, 3) float64 view on a snapshot of the block interleaved
+     * store. The array owns the snapshot: later edits of the block copy the
+     * store before modifying it, so the view never dangles nor changes. An
+     * empty array is returned when the store is not in use.
+     */
+    inline pybind11::array_t< double > interleaved_coordinates_view(
+        const StratigraphicModel& model, const Block3D& block )
+    {
+        static_assert( is_batch_viewable_v< StratigraphicPoint3D, 3 > );
+        auto snapshot =
+            model.interleaved_stratigraphic_coordinates_snapshot( block );
+        if( !snapshot )
+        {
+            return pybind11::array_t< double >(
+                { std::size_t{ 0 }, std::size_t{ 3 } } );
+        }
+        const auto* data =
+            reinterpret_cast< const double* >( snapshot->data() );
+        const auto size = snapshot->size();
+        pybind11::capsule owner{
+            new std::shared_ptr< const std::vector< StratigraphicPoint3D > >{
+                std::move( snapshot ) },
+            []( void* pointer ) {
+                delete static_cast< std::shared_ptr<
+                    const std::vector< StratigraphicPoint3D > >* >( pointer );
+            }
+        };
+        pybind11::array_t< double > view{ { size, std::size_t{ 3 } },
+            { 3 * sizeof( double ), sizeof( double ) }, data, owner };
+        pybind11::detail::array_proxy( view.ptr() )->flags &=
+            ~pybind11::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        return view;
+    }
+
+    template < typename Model, typename Component, index_t dimension >
+    pybind11::array_t< double > batch_implicit_values_array(
+        const Model& model,
+        const Component& component,
+        const BatchArray& points )
+    {
+        const auto input =
+            batch_input< Point< dimension >, dimension >( points );
+        pybind11::array_t< double > values(
+            static_cast< pybind11::ssize_t >( input.size() ) );
+        const auto output =
+            absl::MakeSpan( values.mutable_data(), input.size() );
+        {
+            pybind11::gil_scoped_release release;
+            batch_implicit_values( model, component, input, output );
+        }
+        return values;
+    }
+
+    template < typename Model, typename Component, index_t dimension >
+    pybind11::array_t< double > batch_stratigraphic_coordinates_array(
+        const Model& model,
+        const Component& component,
+        const BatchArray& points )
+    {
+        const auto input =
+            batch_input< Point< dimension >, dimension >( points );
+        auto [coordinates, output] =
+            batch_output< StratigraphicPoint< dimension >, dimension >(
+                input.size() );
+        {
+            pybind11::gil_scoped_release release;
+            batch_stratigraphic_coordinates(
+                model, component, input, output );
+        }
+        return coordinates;
+    }
+
+    template < typename Model, typename Component, index_t dimension >
+    pybind11::array_t< double > batch_geometric_coordinates_array(
+        const Model& model,
+        const Component& component,
+        const BatchArray& stratigraphic_points )
+    {
+        const auto input =
+            batch_input< StratigraphicPoint< dimension >, dimension >(
+                stratigraphic_points );
+        auto [coordinates, output] =
+            batch_output< Point< dimension >, dimension >( input.size() );
+        {
+            pybind11::gil_scoped_release release;
+            batch_geometric_coordinates( model, component, input, output );
+        }
+        return coordinates;
+    }
+
+    void define_batch_queries( pybind11::module& module )
+    {
+        module
+            .def( "batch_implicit_values",
+                &batch_implicit_values_array< ImplicitStructuralModel, Block3D,
+                    3 > )
+            .def( "batch_implicit_values",
+                &batch_implicit_values_array< ImplicitCrossSection, Surface2D,
+                    2 > )
+            .def( "batch_stratigraphic_coordinates",
+                &batch_stratigraphic_coordinates_array< StratigraphicModel,
+                    Block3D, 3 > )
+            .def( "batch_stratigraphic_coordinates",
+                &batch_stratigraphic_coordinates_array< StratigraphicSection,
+                    Surface2D, 2 > )
+            .def( "batch_geometric_coordinates",
+                &batch_geometric_coordinates_array< StratigraphicModel, Block3D,
+                    3 > )
+            .def( "batch_geometric_coordinates",
+                &batch_geometric_coordinates_array< StratigraphicSection,
+                    Surface2D, 2 > )
+            .def( "block_implicit_values",
+                []( const ImplicitStructuralModel& model,
+                    const Block3D& block ) {
+                    pybind11::array_t< double > values(
+                        static_cast< pybind11::ssize_t >(
+                            block.mesh().nb_vertices() ) );
+                    const auto output = absl::MakeSpan(
+                        values.mutable_data(), block.mesh().nb_vertices() );
+                    {
+                        pybind11::gil_scoped_release release;
+                        block_implicit_values( model, block, output );
+                    }
+                    return values;
+                } )
+            .def( "interleaved_stratigraphic_coordinates",
+                &interleaved_coordinates_view, pybind11::keep_alive< 0, 1 >() );
+    }
+} // namespace geode
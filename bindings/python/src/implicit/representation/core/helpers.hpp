@@ -51,7 +51,13 @@ namespace geode
                         &rescale_implicit_value_to_bbox_scale ) )
                 .def( "save_stratigraphic_surfaces",
                     &save_stratigraphic_surfaces )
-                .def( "save_stratigraphic_blocks", &save_stratigraphic_blocks )
+                .def( "save_stratigraphic_blocks",
+                    static_cast< void ( * )( const StratigraphicModel&,
+                        std::string_view ) >( &save_stratigraphic_blocks ) )
+                .def( "save_stratigraphic_blocks_with_extension",
+                    static_cast< void ( * )( const StratigraphicModel&,
+                        std::string_view, std::string_view ) >(
+                        &save_stratigraphic_blocks ) )
                 .def( "horizons_stack_from_top_to_bottom_names_2d",
                     &horizons_stack_from_top_to_bottom_names< 2 > )
                 .def( "horizons_stack_from_top_to_bottom_names_3d",
@@ -50,6 +50,10 @@ namespace geode
                 static_cast< double ( ImplicitCrossSection::* )(
                     const Surface2D&, const Point2D&, index_t ) const >(
                     &ImplicitCrossSection::implicit_value ) )
+            .def( "implicit_value_scale",
+                &ImplicitCrossSection::implicit_value_scale )
+            .def( "implicit_value_offset",
+                &ImplicitCrossSection::implicit_value_offset )
             .def( "horizons_stack", &ImplicitCrossSection::horizons_stack,
                 pybind11::return_value_policy::reference )
             .def( "horizon_implicit_value",
@@ -31,9 +31,34 @@ namespace geode
 {
     void define_implicit_structural_model( pybind11::module& module )
     {
+        pybind11::class_< StratigraphicColumnInterval >(
+            module, "StratigraphicColumnInterval" )
+            .def_readonly( "stratigraphic_unit",
+                &StratigraphicColumnInterval::stratigraphic_unit )
+            .def_readonly( "top", &StratigraphicColumnInterval::top )
+            .def_readonly( "bottom", &StratigraphicColumnInterval::bottom )
+            .def( "thickness", &StratigraphicColumnInterval::thickness );
+        pybind11::class_< StratigraphicColumns >(
+            module, "StratigraphicColumns" )
+            .def( "nb_columns", &StratigraphicColumns::nb_columns )
+            .def( "column",
+                []( const StratigraphicColumns& columns, index_t column_id ) {
+                    const auto column = columns.column( column_id );
+                    return std::vector< StratigraphicColumnInterval >{
+                        column.begin(), column.end()
+                    };
+                } );
         pybind11::class_< ImplicitStructuralModel, StructuralModel,
-            pybind11::smart_holder >( module, "ImplicitStructuralModel" )
-            .def( pybind11::init<>() )
+            pybind11::smart_holder >
+            implicit_model( module, "ImplicitStructuralModel" );
+        pybind11::enum_< ImplicitStructuralModel::STORAGE_PRECISION >(
+            implicit_model, "STORAGE_PRECISION" )
+            .value( "double_precision",
+                ImplicitStructuralModel::STORAGE_PRECISION::double_precision )
+            .value( "single_precision",
+                ImplicitStructuralModel::STORAGE_PRECISION::single_precision )
+            .export_values();
+        implicit_model.def( pybind11::init<>() )
             .def( pybind11::init( []( StructuralModel& model ) {
                 return ImplicitStructuralModel{ model.clone() };
             } ) )
@@ -52,6 +77,16 @@ namespace geode
                 static_cast< double ( ImplicitStructuralModel::* )(
                     const Block3D&, const Point3D&, index_t ) const >(
                     &ImplicitStructuralModel::implicit_value ) )
+            .def( "stored_implicit_value",
+                &ImplicitStructuralModel::stored_implicit_value )
+            .def( "implicit_value_precision",
+                &ImplicitStructuralModel::implicit_value_precision )
+            .def( "implicit_value_scale",
+                &ImplicitStructuralModel::implicit_value_scale )
+            .def( "implicit_value_offset",
+                &ImplicitStructuralModel::implicit_value_offset )
+            .def( "compute_implicit_query_trees",
+                &ImplicitStructuralModel::compute_implicit_query_trees )
             .def( "horizons_stack", &ImplicitStructuralModel::horizons_stack,
                 pybind11::return_value_policy::reference )
             .def( "horizon_implicit_value",
@@ -60,6 +95,25 @@ namespace geode
                 &ImplicitStructuralModel::implicit_value_is_above_horizon )
             .def( "containing_stratigraphic_unit",
                 &ImplicitStructuralModel::containing_stratigraphic_unit )
+            .def( "stratigraphic_columns",
+                []( const ImplicitStructuralModel& model,
+                    const std::vector< Point2D >& locations ) {
+                    return model.stratigraphic_columns( locations );
+                } )
+            .def( "has_stratigraphic_unit_labels",
+                &ImplicitStructuralModel::has_stratigraphic_unit_labels )
+            .def( "stratigraphic_unit_label_table",
+                []( const ImplicitStructuralModel& model ) {
+                    const auto table = model.stratigraphic_unit_label_table();
+                    return std::vector< std::optional< uuid > >{ table.begin(),
+                        table.end() };
+                } )
+            .def( "stratigraphic_unit_label",
+                &ImplicitStructuralModel::stratigraphic_unit_label )
+            .def( "tetrahedron_stratigraphic_unit",
+                &ImplicitStructuralModel::tetrahedron_stratigraphic_unit )
+            .def( "is_cut_by_horizon",
+                &ImplicitStructuralModel::is_cut_by_horizon )
             .def( "implicit_structural_model_component",
                 &ImplicitStructuralModel::component,
                 pybind11::return_value_policy::reference );
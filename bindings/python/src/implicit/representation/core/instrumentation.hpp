@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/core/instrumentation.hpp>
+
+namespace geode
+{
+    void define_instrumentation( pybind11::module& module )
+    {
+        pybind11::class_< InstrumentationRecord >(
+            module, "InstrumentationRecord" )
+            .def_readonly( "name", &InstrumentationRecord::name )
+            .def_readonly(
+                "component_id", &InstrumentationRecord::component_id )
+            .def_readonly( "count", &InstrumentationRecord::count )
+            .def_readonly( "seconds", &InstrumentationRecord::seconds );
+        module
+            .def( "is_instrumentation_enabled", &is_instrumentation_enabled )
+            .def( "instrumentation_snapshot", &instrumentation_snapshot )
+            .def( "reset_instrumentation", &reset_instrumentation );
+    }
+} // namespace geode
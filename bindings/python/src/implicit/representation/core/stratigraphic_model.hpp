@@ -71,8 +71,21 @@ namespace geode
                     &StratigraphicModel::geometric_coordinates ) )
             .def( "stratigraphic_surface",
                 &StratigraphicModel::stratigraphic_surface )
+            .def( "compute_stratigraphic_query_trees",
+                &StratigraphicModel::compute_stratigraphic_query_trees )
             .def( "stratigraphic_bounding_box",
                 &StratigraphicModel::stratigraphic_bounding_box )
+            .def( "interleaved_stratigraphic_coordinates",
+                []( const StratigraphicModel& model, const Block3D& block ) {
+                    const auto coordinates =
+                        model.interleaved_stratigraphic_coordinates( block );
+                    return std::vector< StratigraphicPoint3D >{
+                        coordinates.begin(), coordinates.end()
+                    };
+                } )
+            .def( "uses_interleaved_stratigraphic_coordinates",
+                &StratigraphicModel::
+                    uses_interleaved_stratigraphic_coordinates )
             .def( "native_extension", &StratigraphicModel::native_extension )
             .def( "stratigraphic_model_component",
                 &StratigraphicModel::component,
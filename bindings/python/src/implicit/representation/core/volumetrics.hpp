@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+#include <geode/geosciences/implicit/representation/core/volumetrics.hpp>
+
+namespace
+{
+    template < typename Value >
+    pybind11::dict to_python_dict(
+        const absl::flat_hash_map< geode::uuid, Value >& values )
+    {
+        pybind11::dict result;
+        for( const auto& [id, value] : values )
+        {
+            result[pybind11::str( id.string() )] = value;
+        }
+        return result;
+    }
+
+    pybind11::dict to_python_dict(
+        const absl::flat_hash_map< geode::uuid,
+            absl::flat_hash_map< geode::uuid, double > >& values )
+    {
+        pybind11::dict result;
+        for( const auto& [id, value] : values )
+        {
+            result[pybind11::str( id.string() )] = to_python_dict( value );
+        }
+        return result;
+    }
+} // namespace
+
+namespace geode
+{
+    void define_volumetrics( pybind11::module& module )
+    {
+        pybind11::class_< ImplicitModelVolumetrics >(
+            module, "ImplicitModelVolumetrics" )
+            .def_property_readonly( "block_volumes",
+                []( const ImplicitModelVolumetrics& volumetrics ) {
+                    return to_python_dict( volumetrics.block_volumes );
+                } )
+            .def_property_readonly( "fault_block_volumes",
+                []( const ImplicitModelVolumetrics& volumetrics ) {
+                    return to_python_dict( volumetrics.fault_block_volumes );
+                } )
+            .def_property_readonly( "stratigraphic_unit_volumes",
+                []( const ImplicitModelVolumetrics& volumetrics ) {
+                    return to_python_dict(
+                        volumetrics.stratigraphic_unit_volumes );
+                } )
+            .def_property_readonly( "block_stratigraphic_unit_volumes",
+                []( const ImplicitModelVolumetrics& volumetrics ) {
+                    return to_python_dict(
+                        volumetrics.block_stratigraphic_unit_volumes );
+                } )
+            .def_property_readonly( "fault_block_stratigraphic_unit_volumes",
+                []( const ImplicitModelVolumetrics& volumetrics ) {
+                    return to_python_dict(
+                        volumetrics.fault_block_stratigraphic_unit_volumes );
+                } );
+        pybind11::class_< StratigraphicUnitThicknessStatistics >(
+            module, "StratigraphicUnitThicknessStatistics" )
+            .def_readonly( "nb_columns",
+                &StratigraphicUnitThicknessStatistics::nb_columns )
+            .def_readonly( "min", &StratigraphicUnitThicknessStatistics::min )
+            .def_readonly( "max", &StratigraphicUnitThicknessStatistics::max )
+            .def_readonly( "mean", &StratigraphicUnitThicknessStatistics::mean )
+            .def_readonly( "standard_deviation",
+                &StratigraphicUnitThicknessStatistics::standard_deviation );
+        module
+            .def( "implicit_model_volumetrics", &implicit_model_volumetrics )
+            .def( "stratigraphic_unit_thickness_statistics",
+                []( const ImplicitStructuralModel& model,
+                    const std::vector< Point2D >& locations ) {
+                    return to_python_dict(
+                        stratigraphic_unit_thickness_statistics(
+                            model, locations ) );
+                } );
+    }
+} // namespace geode
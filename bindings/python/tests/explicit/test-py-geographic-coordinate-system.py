@@ -59,3 +59,11 @@ if __name__ == "__main__":
     for p in range(nb_points):
         if not lambert2.point(p).inexact_equal(answers[p]):
             raise ValueError("[Test] Wrong coordinate conversion")
+
+    if not geosciences.is_geographic_coordinate_system_known("EPSG:27572"):
+        raise ValueError("[Test] Lambert zone II should be in the catalogue")
+    projected = geosciences.geographic_coordinate_systems_with_name_containing(
+        "lambert zone ii", geosciences.GeographicCoordinateSystemType.projected
+    )
+    if not any(info.authority_code() == "EPSG:27572" for info in projected):
+        raise ValueError("[Test] Lambert zone II should be found by name")
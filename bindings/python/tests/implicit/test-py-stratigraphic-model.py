@@ -27,6 +27,8 @@ if sys.version_info >= (3, 8, 0) and platform.system() == "Windows":
     for path in [x.strip() for x in os.environ["PATH"].split(";") if x]:
         os.add_dll_directory(path)
 
+import numpy
+
 import opengeode as geode
 import opengeode_geosciences_py_explicit as geode_exp
 import opengeode_geosciences_py_implicit as geode_imp
@@ -101,6 +103,62 @@ def test_model(model):
         )
 
 
+def test_batch_queries(model):
+    block = model.block(geode.uuid("00000000-c271-42e7-8000-00002c3147ed"))
+    points = numpy.array(
+        [[1, 0, 1], [0.480373621, 0.5420120955, 0.6765933633], [1e5, 1e5, 1e5]]
+    )
+    strati_points = geode_imp.batch_stratigraphic_coordinates(model, block, points)
+    if strati_points.shape != (3, 3):
+        raise ValueError("[Test] Wrong shape of batch stratigraphic coordinates")
+    expected = numpy.array(
+        [[0.386272, -0.109477, 0.0], [0.03380647978, -0.002759957825, 0.3080064376]]
+    )
+    if not numpy.allclose(strati_points[:2], expected, atol=1e-5):
+        raise ValueError("[Test] Wrong batch stratigraphic coordinates")
+    if not numpy.isnan(strati_points[2]).all():
+        raise ValueError("[Test] Point outside the block should give NaN")
+    values = geode_imp.batch_implicit_values(model, block, points)
+    if not numpy.allclose(values[:2], expected[:, 2], atol=1e-5):
+        raise ValueError("[Test] Wrong batch implicit values")
+    geom_points = geode_imp.batch_geometric_coordinates(
+        model, block, strati_points[:2]
+    )
+    if not numpy.allclose(geom_points, points[:2], atol=1e-5):
+        raise ValueError("[Test] Wrong batch geometric coordinates")
+    vertex_values = geode_imp.block_implicit_values(model, block)
+    if vertex_values[59] != model.implicit_value_from_vertex_id(block, 59):
+        raise ValueError("[Test] Wrong block implicit values")
+    coordinates = geode_imp.interleaved_stratigraphic_coordinates(model, block)
+    if coordinates.shape != (0, 3):
+        raise ValueError("[Test] Interleaved store should be disabled by default")
+    builder = geode_imp.StratigraphicModelBuilder(model)
+    builder.set_interleaved_stratigraphic_coordinates(True)
+    coordinates = geode_imp.interleaved_stratigraphic_coordinates(model, block)
+    if coordinates.shape != (block.mesh().nb_vertices(), 3) or not numpy.allclose(
+        coordinates[59], [-0.213112, -0.188148, 0.472047], atol=1e-5
+    ):
+        raise ValueError("[Test] Wrong interleaved stratigraphic coordinates")
+    if coordinates.flags.writeable:
+        raise ValueError("[Test] Interleaved view should be read-only")
+    location = geode.Point2D([coordinates[59][0], coordinates[59][1]])
+    builder.set_stratigraphic_location(block, 59, geode.Point2D([1, 2]))
+    if not numpy.allclose(coordinates[59], [-0.213112, -0.188148, 0.472047], atol=1e-5):
+        raise ValueError("[Test] Interleaved view should not follow later edits")
+    edited = geode_imp.interleaved_stratigraphic_coordinates(model, block)
+    if not numpy.allclose(edited[59][:2], [1, 2]):
+        raise ValueError("[Test] Interleaved store should follow edits")
+    builder.set_stratigraphic_location(block, 59, location)
+    builder.set_interleaved_stratigraphic_coordinates(False)
+
+
+def test_volumetrics(model):
+    volumetrics = geode_imp.implicit_model_volumetrics(model)
+    block_volume = volumetrics.block_volumes["00000000-c271-42e7-8000-00002c3147ed"]
+    if block_volume <= 0:
+        raise ValueError("[Test] Wrong block volume")
+
+
 def test_save_stratigraphic_surfaces(model):
     counter = 0
     for model_block in model.blocks():
@@ -146,4 +204,6 @@ if __name__ == "__main__":
     builder_stratigraphic = geode_imp.StratigraphicModelBuilder(stratigraphic_model)
     builder_stratigraphic.import_old_stratigraphic_attribute_values_from_attribute_name("geode_stratigraphic_location")
     test_model(stratigraphic_model)
+    test_batch_queries(stratigraphic_model)
+    test_volumetrics(stratigraphic_model)
     test_save_stratigraphic_surfaces(stratigraphic_model)
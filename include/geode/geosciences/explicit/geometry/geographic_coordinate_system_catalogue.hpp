@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/geosciences/explicit/common.hpp>
+#include <geode/geosciences/explicit/geometry/geographic_coordinate_system.hpp>
+
+namespace geode
+{
+    enum struct GeographicCoordinateSystemType
+    {
+        geographic_2d,
+        geographic_3d,
+        geocentric,
+        projected,
+        vertical,
+        compound,
+        other
+    };
+
+    /*!
+     * All the coordinate reference systems of the GDAL/PROJ database.
+     * The database is read once per process, on the first call to any
+     * catalogue function, and shared by all threads afterwards.
+     */
+    [[nodiscard]] absl::Span< const GeographicCoordinateSystemInfo >
+        opengeode_geosciences_explicit_api
+        geographic_coordinate_system_catalogue();
+
+    /*!
+     * Return the catalogue entry matching the given authority code
+     * (e.g. "EPSG:27572"), if there is any.
+     */
+    [[nodiscard]] std::optional< GeographicCoordinateSystemInfo >
+        opengeode_geosciences_explicit_api find_geographic_coordinate_system(
+            std::string_view authority_code );
+
+    [[nodiscard]] bool opengeode_geosciences_explicit_api
+        is_geographic_coordinate_system_known(
+            std::string_view authority_code );
+
+    [[nodiscard]] std::optional< GeographicCoordinateSystemType >
+        opengeode_geosciences_explicit_api geographic_coordinate_system_type(
+            std::string_view authority_code );
+
+    /*!
+     * Return the catalogue entries whose name starts with the given prefix,
+     * ignoring case, sorted by name. Only the entries of the given type are
+     * returned if one is provided.
+     */
+    [[nodiscard]] std::vector< GeographicCoordinateSystemInfo >
+        opengeode_geosciences_explicit_api
+        geographic_coordinate_systems_with_name_prefix( std::string_view prefix,
+            std::optional< GeographicCoordinateSystemType > type =
+                std::nullopt );
+
+    /*!
+     * Return the catalogue entries whose name contains the given text,
+     * ignoring case, in catalogue order. Only the entries of the given type
+     * are returned if one is provided.
+     */
+    [[nodiscard]] std::vector< GeographicCoordinateSystemInfo >
+        opengeode_geosciences_explicit_api
+        geographic_coordinate_systems_with_name_containing(
+            std::string_view text,
+            std::optional< GeographicCoordinateSystemType > type =
+                std::nullopt );
+
+    [[nodiscard]] std::vector< GeographicCoordinateSystemInfo >
+        opengeode_geosciences_explicit_api
+        geographic_coordinate_systems_of_type(
+            GeographicCoordinateSystemType type );
+} // namespace geode
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/inlined_vector.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geosciences/explicit/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Name to uuid index of a component collection. It is built when the
+         * collection is loaded and kept up to date by the collection when a
+         * component is renamed or deleted, so that const lookups never modify
+         * it and can run concurrently. Unnamed components are not indexed.
+         * When several components share a name, the first one named is
+         * returned.
+         */
+        class ComponentNameIndex
+        {
+            using Ids = absl::InlinedVector< uuid, 1 >;
+
+        public:
+            [[nodiscard]] std::optional< uuid > find(
+                std::string_view name ) const
+            {
+                const auto it = index_.find( name );
+                if( it == index_.end() )
+                {
+                    return std::nullopt;
+                }
+                return it->second.front();
+            }
+
+            [[nodiscard]] std::vector< std::optional< uuid > > find(
+                absl::Span< const std::string > names ) const
+            {
+                std::vector< std::optional< uuid > > ids;
+                ids.reserve( names.size() );
+                for( const auto& name : names )
+                {
+                    ids.emplace_back( find( name ) );
+                }
+                return ids;
+            }
+
+            template < typename Range >
+            void build( Range components )
+            {
+                index_.clear();
+                for( const auto& component : components )
+                {
+                    if( const auto name = component.name() )
+                    {
+                        add( component.id(), name.value() );
+                    }
+                }
+            }
+
+            /*!
+             * Must be called before the component name is modified, while
+             * its previous name is still valid.
+             */
+            template < typename Component >
+            void rename( const Component& component, std::string_view name )
+            {
+                remove( component );
+                add( component.id(), name );
+            }
+
+            template < typename Component >
+            void remove( const Component& component )
+            {
+                const auto name = component.name();
+                if( !name )
+                {
+                    return;
+                }
+                const auto it = index_.find( name.value() );
+                if( it == index_.end() )
+                {
+                    return;
+                }
+                auto& ids = it->second;
+                const auto id = absl::c_find( ids, component.id() );
+                if( id != ids.end() )
+                {
+                    ids.erase( id );
+                }
+                if( ids.empty() )
+                {
+                    index_.erase( it );
+                }
+            }
+
+        private:
+            void add( const uuid& id, std::string_view name )
+            {
+                index_[name].push_back( id );
+            }
+
+        private:
+            absl::flat_hash_map< std::string, Ids > index_;
+        };
+    } // namespace detail
+} // namespace geode
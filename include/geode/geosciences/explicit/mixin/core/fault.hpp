@@ -92,6 +92,11 @@ namespace geode
             this->set_name( name );
         }
 
+        void set_fault_name( std::string_view name, FaultsKey )
+        {
+            this->set_name( name );
+        }
+
     private:
         Fault();
 
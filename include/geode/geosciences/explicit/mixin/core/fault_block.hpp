@@ -72,6 +72,11 @@ namespace geode
             this->set_name( name );
         }
 
+        void set_fault_block_name( std::string_view name, FaultBlocksKey )
+        {
+            this->set_name( name );
+        }
+
     private:
         FaultBlock();
 
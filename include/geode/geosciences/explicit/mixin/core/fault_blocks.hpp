@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -120,6 +126,21 @@ namespace geode
             return fault_block( id );
         }
 
+        /*!
+         * Returns the uuid of a FaultBlock with the given name, if any. Names
+         * are looked up in an index kept up to date on renaming.
+         */
+        [[nodiscard]] std::optional< uuid > fault_block_id_from_name(
+            std::string_view name ) const;
+
+        /*!
+         * Returns, for each given name, the uuid of a FaultBlock with this
+         * name, if any.
+         */
+        [[nodiscard]] std::vector< std::optional< uuid > >
+            fault_block_ids_from_names(
+                absl::Span< const std::string > names ) const;
+
         void save_fault_blocks( std::string_view directory ) const;
 
     protected:
@@ -167,6 +188,9 @@ namespace geode
         [[nodiscard]] FaultBlock< dimension >& modifiable_fault_block(
             const uuid& id, FaultBlocksBuilderKey key );
 
+        void set_fault_block_name(
+            const uuid& id, std::string_view name, FaultBlocksBuilderKey key );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
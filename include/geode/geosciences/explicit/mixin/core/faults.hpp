@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -119,6 +125,20 @@ namespace geode
             return fault( id );
         }
 
+        /*!
+         * Returns the uuid of a Fault with the given name, if any. Names
+         * are looked up in an index kept up to date on renaming.
+         */
+        [[nodiscard]] std::optional< uuid > fault_id_from_name(
+            std::string_view name ) const;
+
+        /*!
+         * Returns, for each given name, the uuid of a Fault with this
+         * name, if any.
+         */
+        [[nodiscard]] std::vector< std::optional< uuid > > fault_ids_from_names(
+            absl::Span< const std::string > names ) const;
+
         void save_faults( std::string_view directory ) const;
 
     protected:
@@ -171,6 +191,9 @@ namespace geode
         [[nodiscard]] Fault< dimension >& modifiable_fault(
             const uuid& id, FaultsBuilderKey key );
 
+        void set_fault_name(
+            const uuid& id, std::string_view name, FaultsBuilderKey key );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -90,6 +90,11 @@ namespace geode
             this->set_name( name );
         }
 
+        void set_horizon_name( std::string_view name, HorizonsKey )
+        {
+            this->set_name( name );
+        }
+
     private:
         Horizon();
         explicit Horizon( CONTACT_TYPE type );
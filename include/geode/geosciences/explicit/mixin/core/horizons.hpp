@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -121,6 +127,21 @@ namespace geode
             return horizon( id );
         }
 
+        /*!
+         * Returns the uuid of a Horizon with the given name, if any. Names
+         * are looked up in an index kept up to date on renaming.
+         */
+        [[nodiscard]] std::optional< uuid > horizon_id_from_name(
+            std::string_view name ) const;
+
+        /*!
+         * Returns, for each given name, the uuid of a Horizon with this
+         * name, if any.
+         */
+        [[nodiscard]] std::vector< std::optional< uuid > >
+            horizon_ids_from_names(
+                absl::Span< const std::string > names ) const;
+
         void save_horizons( std::string_view directory ) const;
 
     protected:
@@ -173,6 +194,9 @@ namespace geode
         [[nodiscard]] Horizon< dimension >& modifiable_horizon(
             const uuid& id, HorizonsBuilderKey key );
 
+        void set_horizon_name(
+            const uuid& id, std::string_view name, HorizonsBuilderKey key );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
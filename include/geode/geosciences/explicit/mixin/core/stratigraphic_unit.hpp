@@ -72,6 +72,12 @@ namespace geode
             this->set_name( name );
         }
 
+        void set_stratigraphic_unit_name(
+            std::string_view name, StratigraphicUnitsKey )
+        {
+            this->set_name( name );
+        }
+
     private:
         StratigraphicUnit();
 
@@ -23,6 +23,12 @@
 
 #pragma once
 
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <absl/types/span.h>
+
 #include <geode/basic/passkey.hpp>
 #include <geode/basic/pimpl.hpp>
 
@@ -126,6 +132,21 @@ namespace geode
             return stratigraphic_unit( id );
         }
 
+        /*!
+         * Returns the uuid of a StratigraphicUnit with the given name, if
+         * any. Names are looked up in an index kept up to date on renaming.
+         */
+        [[nodiscard]] std::optional< uuid > stratigraphic_unit_id_from_name(
+            std::string_view name ) const;
+
+        /*!
+         * Returns, for each given name, the uuid of a StratigraphicUnit with
+         * this name, if any.
+         */
+        [[nodiscard]] std::vector< std::optional< uuid > >
+            stratigraphic_unit_ids_from_names(
+                absl::Span< const std::string > names ) const;
+
         void save_stratigraphic_units( std::string_view directory ) const;
 
     protected:
@@ -177,6 +198,10 @@ namespace geode
             modifiable_stratigraphic_unit(
                 const uuid& id, StratigraphicUnitsBuilderKey key );
 
+        void set_stratigraphic_unit_name( const uuid& id,
+            std::string_view name,
+            StratigraphicUnitsBuilderKey key );
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
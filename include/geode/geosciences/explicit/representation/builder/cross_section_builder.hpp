@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/model/representation/builder/section_builder.hpp>
 
 #include <geode/geosciences/explicit/mixin/builder/fault_blocks_builder.hpp>
@@ -77,6 +79,12 @@ namespace geode
 
         index_t add_line_in_fault( const Line2D& line, const Fault2D& fault );
 
+        /*!
+         * Adds all the given lines in the Fault at once.
+         */
+        void add_lines_in_fault(
+            absl::Span< const uuid > line_ids, const Fault2D& fault );
+
         void remove_fault( const Fault2D& fault );
 
         [[nodiscard]] const uuid& add_horizon();
@@ -92,6 +100,12 @@ namespace geode
         index_t add_line_in_horizon(
             const Line2D& line, const Horizon2D& horizon );
 
+        /*!
+         * Adds all the given lines in the Horizon at once.
+         */
+        void add_lines_in_horizon(
+            absl::Span< const uuid > line_ids, const Horizon2D& horizon );
+
         void remove_horizon( const Horizon2D& horizon );
 
         [[nodiscard]] const uuid& add_fault_block();
@@ -101,6 +115,12 @@ namespace geode
         index_t add_surface_in_fault_block(
             const Surface2D& surface, const FaultBlock2D& fault_block );
 
+        /*!
+         * Adds all the given surfaces in the FaultBlock at once.
+         */
+        void add_surfaces_in_fault_block( absl::Span< const uuid > surface_ids,
+            const FaultBlock2D& fault_block );
+
         void remove_fault_block( const FaultBlock2D& fault_block );
 
         [[nodiscard]] const uuid& add_stratigraphic_unit();
@@ -110,6 +130,13 @@ namespace geode
         index_t add_surface_in_stratigraphic_unit( const Surface2D& surface,
             const StratigraphicUnit2D& stratigraphic_unit );
 
+        /*!
+         * Adds all the given surfaces in the StratigraphicUnit at once.
+         */
+        void add_surfaces_in_stratigraphic_unit(
+            absl::Span< const uuid > surface_ids,
+            const StratigraphicUnit2D& stratigraphic_unit );
+
         void remove_stratigraphic_unit(
             const StratigraphicUnit2D& stratigraphic_unit );
 
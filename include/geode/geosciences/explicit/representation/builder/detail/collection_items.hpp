@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+#include <absl/container/flat_hash_set.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/component_type.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+
+#include <geode/geosciences/explicit/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        template < typename Item, typename Model >
+        bool has_item( const Model& model, const uuid& item_id )
+        {
+            if constexpr( std::is_same_v< Item, Line< Model::dim > > )
+            {
+                return model.has_line( item_id );
+            }
+            else if constexpr( std::is_same_v< Item, Surface< Model::dim > > )
+            {
+                return model.has_surface( item_id );
+            }
+            else
+            {
+                return model.has_block( item_id );
+            }
+        }
+
+        /*!
+         * Adds all the given items in the collection. Every item is checked
+         * to exist in the model with the expected component type before any
+         * relation is added. Duplicated items and items already in the
+         * collection, gathered once before the insertion, are skipped.
+         */
+        template < typename Item, typename Model, typename Builder >
+        void add_items_in_collection( const Model& model,
+            Builder& builder,
+            absl::Span< const uuid > item_ids,
+            const ComponentID& collection_id )
+        {
+            absl::flat_hash_set< uuid > known_ids;
+            for( const auto& item : model.items( collection_id.id() ) )
+            {
+                known_ids.emplace( item.id() );
+            }
+            known_ids.reserve( known_ids.size() + item_ids.size() );
+            std::vector< ComponentID > items;
+            items.reserve( item_ids.size() );
+            for( const auto& item_id : item_ids )
+            {
+                OpenGeodeGeosciencesExplicitException::check_exception(
+                    has_item< Item >( model, item_id ), nullptr,
+                    OpenGeodeException::TYPE::data,
+                    "[add_items_in_collection] Component ", item_id.string(),
+                    " is not a ", Item::component_type_static().get() );
+                if( known_ids.emplace( item_id ).second )
+                {
+                    items.emplace_back(
+                        Item::component_type_static(), item_id );
+                }
+            }
+            for( const auto& item : items )
+            {
+                builder.add_item_in_collection( item, collection_id );
+            }
+        }
+    } // namespace detail
+} // namespace geode
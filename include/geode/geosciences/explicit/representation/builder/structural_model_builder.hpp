@@ -23,6 +23,8 @@
 
 #pragma once
 
+#include <absl/types/span.h>
+
 #include <geode/model/representation/builder/brep_builder.hpp>
 
 #include <geode/geosciences/explicit/mixin/builder/fault_blocks_builder.hpp>
@@ -78,6 +80,12 @@ namespace geode
         index_t add_surface_in_fault(
             const Surface3D& surface, const Fault3D& fault );
 
+        /*!
+         * Adds all the given surfaces in the Fault at once.
+         */
+        void add_surfaces_in_fault(
+            absl::Span< const uuid > surface_ids, const Fault3D& fault );
+
         void remove_fault( const Fault3D& fault );
 
         [[nodiscard]] const uuid& add_horizon();
@@ -93,6 +101,12 @@ namespace geode
         index_t add_surface_in_horizon(
             const Surface3D& surface, const Horizon3D& horizon );
 
+        /*!
+         * Adds all the given surfaces in the Horizon at once.
+         */
+        void add_surfaces_in_horizon(
+            absl::Span< const uuid > surface_ids, const Horizon3D& horizon );
+
         void remove_horizon( const Horizon3D& horizon );
 
         [[nodiscard]] const uuid& add_fault_block();
@@ -102,6 +116,12 @@ namespace geode
         index_t add_block_in_fault_block(
             const Block3D& block, const FaultBlock3D& fault_block );
 
+        /*!
+         * Adds all the given blocks in the FaultBlock at once.
+         */
+        void add_blocks_in_fault_block( absl::Span< const uuid > block_ids,
+            const FaultBlock3D& fault_block );
+
         void remove_fault_block( const FaultBlock3D& fault_block );
 
         [[nodiscard]] const uuid& add_stratigraphic_unit();
@@ -111,6 +131,13 @@ namespace geode
         index_t add_block_in_stratigraphic_unit( const Block3D& block,
             const StratigraphicUnit3D& stratigraphic_unit );
 
+        /*!
+         * Adds all the given blocks in the StratigraphicUnit at once.
+         */
+        void add_blocks_in_stratigraphic_unit(
+            absl::Span< const uuid > block_ids,
+            const StratigraphicUnit3D& stratigraphic_unit );
+
         void remove_stratigraphic_unit(
             const StratigraphicUnit3D& stratigraphic_unit );
 
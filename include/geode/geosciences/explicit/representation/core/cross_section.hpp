@@ -25,6 +25,7 @@
 
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/pimpl.hpp>
 
 #include <geode/model/mixin/core/corner.hpp>
 #include <geode/model/mixin/core/corner_collection.hpp>
@@ -40,6 +41,7 @@
 #include <geode/geosciences/explicit/mixin/core/faults.hpp>
 #include <geode/geosciences/explicit/mixin/core/horizons.hpp>
 #include <geode/geosciences/explicit/mixin/core/stratigraphic_units.hpp>
+#include <geode/geosciences/explicit/representation/core/geological_collection_index.hpp>
 
 namespace geode
 {
@@ -147,13 +149,14 @@ namespace geode
                 StratigraphicUnits2D > >;
         using Components = tuple_cat< MeshComponents, CollectionComponents >;
 
-        CrossSection() = default;
+        CrossSection();
         CrossSection( BITSERY );
-        CrossSection( CrossSection&& ) noexcept = default;
+        CrossSection( CrossSection&& ) noexcept;
         explicit CrossSection( Section&& section ) noexcept;
         CrossSection( const CrossSection& initial_model,
             Section&& section,
             const ModelGenericMapping& initial_to_section_mappings ) noexcept;
+        ~CrossSection();
 
         [[nodiscard]] CrossSection clone() const;
 
@@ -180,5 +183,36 @@ namespace geode
 
         [[nodiscard]] StratigraphicUnitItemRange stratigraphic_unit_items(
             const StratigraphicUnit2D& stratigraphic_unit ) const;
+
+        /*!
+         * Return the index between Faults and their lines. It is computed
+         * on first access and recomputed after any relationship edit, made
+         * through any builder. Concurrent accesses are safe, but the returned
+         * reference is only valid until the next edit.
+         */
+        [[nodiscard]] const GeologicalCollectionIndex& fault_index() const;
+
+        /*!
+         * Return the index between Horizons and their lines.
+         * @see fault_index
+         */
+        [[nodiscard]] const GeologicalCollectionIndex& horizon_index() const;
+
+        /*!
+         * Return the index between FaultBlocks and their surfaces.
+         * @see fault_index
+         */
+        [[nodiscard]] const GeologicalCollectionIndex&
+            fault_block_index() const;
+
+        /*!
+         * Return the index between StratigraphicUnits and their surfaces.
+         * @see fault_index
+         */
+        [[nodiscard]] const GeologicalCollectionIndex&
+            stratigraphic_unit_index() const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
     };
 } // namespace geode
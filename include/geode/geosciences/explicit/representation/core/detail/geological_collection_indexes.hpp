@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/sparse_attribute.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geosciences/explicit/mixin/core/fault.hpp>
+#include <geode/geosciences/explicit/mixin/core/fault_block.hpp>
+#include <geode/geosciences/explicit/mixin/core/horizon.hpp>
+#include <geode/geosciences/explicit/mixin/core/stratigraphic_unit.hpp>
+#include <geode/geosciences/explicit/representation/core/geological_collection_index.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Lazily computed GeologicalCollectionIndex of each geological
+         * collection type of a StructuralModel or a CrossSection.
+         * Relationship edits are detected whatever the builder used: the last
+         * relation is stamped when the indexes are checked, and new relations
+         * are always appended after the remaining ones. An edit therefore
+         * changes either the number of relations or the last relation, and
+         * resets all the indexes. Accesses are serialized by a mutex.
+         */
+        template < typename Model >
+        class GeologicalCollectionIndexes
+        {
+            static constexpr auto STAMP_ATTRIBUTE_NAME =
+                "geode_geological_indexes_stamp";
+            static constexpr index_t NO_STAMP{ 0 };
+
+            struct CachedIndex
+            {
+                std::optional< GeologicalCollectionIndex > index;
+                index_t nb_collections{ 0 };
+            };
+
+        public:
+            const GeologicalCollectionIndex& fault_index(
+                const Model& model ) const
+            {
+                return index(
+                    model, fault_index_, model.nb_faults(), model.faults() );
+            }
+
+            const GeologicalCollectionIndex& horizon_index(
+                const Model& model ) const
+            {
+                return index( model, horizon_index_, model.nb_horizons(),
+                    model.horizons() );
+            }
+
+            const GeologicalCollectionIndex& fault_block_index(
+                const Model& model ) const
+            {
+                return index( model, fault_block_index_,
+                    model.nb_fault_blocks(), model.fault_blocks() );
+            }
+
+            const GeologicalCollectionIndex& stratigraphic_unit_index(
+                const Model& model ) const
+            {
+                return index( model, stratigraphic_unit_index_,
+                    model.nb_stratigraphic_units(),
+                    model.stratigraphic_units() );
+            }
+
+        private:
+            template < typename Range >
+            const GeologicalCollectionIndex& index( const Model& model,
+                CachedIndex& cached,
+                index_t nb_collections,
+                const Range& collections ) const
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                check_relationships( model );
+                if( !cached.index || cached.nb_collections != nb_collections )
+                {
+                    std::vector< uuid > collection_ids;
+                    collection_ids.reserve( nb_collections );
+                    for( const auto& collection : collections )
+                    {
+                        collection_ids.push_back( collection.id() );
+                    }
+                    cached.index.emplace( model, collection_ids );
+                    cached.nb_collections = nb_collections;
+                }
+                return cached.index.value();
+            }
+
+            void check_relationships( const Model& model ) const
+            {
+                auto& manager = model.relation_attribute_manager();
+                const auto nb_relations = manager.nb_elements();
+                if( nb_relations == nb_stamped_relations_
+                    && ( nb_relations == 0
+                         || stamp_value( manager, nb_relations - 1 )
+                                == stamp_ ) )
+                {
+                    return;
+                }
+                fault_index_.index.reset();
+                horizon_index_.index.reset();
+                fault_block_index_.index.reset();
+                stratigraphic_unit_index_.index.reset();
+                stamp_last_relation( manager, nb_relations );
+            }
+
+            index_t stamp_value(
+                const AttributeManager& manager, index_t relation ) const
+            {
+                if( !stamp_attribute_id_
+                    || !manager.attribute_exists(
+                        stamp_attribute_id_.value() ) )
+                {
+                    return NO_STAMP;
+                }
+                return manager
+                    .find_read_only_attribute< index_t >(
+                        stamp_attribute_id_.value() )
+                    ->value( relation );
+            }
+
+            void stamp_last_relation(
+                AttributeManager& manager, index_t nb_relations ) const
+            {
+                nb_stamped_relations_ = nb_relations;
+                if( nb_relations == 0 )
+                {
+                    return;
+                }
+                auto attribute = stamp_attribute( manager );
+                if( stamped_relation_ < nb_relations
+                    && attribute->value( stamped_relation_ ) == stamp_ )
+                {
+                    attribute->set_value( stamped_relation_, NO_STAMP );
+                }
+                static std::atomic< index_t > counter{ NO_STAMP };
+                stamp_ = ++counter;
+                stamped_relation_ = nb_relations - 1;
+                attribute->set_value( stamped_relation_, stamp_ );
+            }
+
+            std::shared_ptr< SparseAttribute< index_t > > stamp_attribute(
+                AttributeManager& manager ) const
+            {
+                if( !stamp_attribute_id_
+                    || !manager.attribute_exists(
+                        stamp_attribute_id_.value() ) )
+                {
+                    if( const auto ids = manager.attribute_ids_matching_name(
+                            STAMP_ATTRIBUTE_NAME ) )
+                    {
+                        stamp_attribute_id_ = ids->front();
+                    }
+                    else
+                    {
+                        AttributeValues< index_t > default_values;
+                        default_values.default_value = NO_STAMP;
+                        default_values.no_value = NO_STAMP;
+                        AttributeProperties properties;
+                        properties.assignable = false;
+                        properties.interpolable = false;
+                        properties.transferable = false;
+                        stamp_attribute_id_ =
+                            manager.create_attribute< SparseAttribute,
+                                index_t >( STAMP_ATTRIBUTE_NAME,
+                                default_values, properties );
+                    }
+                }
+                return manager.find_attribute< SparseAttribute, index_t >(
+                    stamp_attribute_id_.value() );
+            }
+
+        private:
+            mutable std::mutex mutex_;
+            mutable CachedIndex fault_index_;
+            mutable CachedIndex horizon_index_;
+            mutable CachedIndex fault_block_index_;
+            mutable CachedIndex stratigraphic_unit_index_;
+            mutable std::optional< uuid > stamp_attribute_id_;
+            mutable index_t nb_stamped_relations_{ 0 };
+            mutable index_t stamped_relation_{ 0 };
+            mutable index_t stamp_{ NO_STAMP };
+        };
+    } // namespace detail
+} // namespace geode
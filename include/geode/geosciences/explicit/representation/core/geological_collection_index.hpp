@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/geosciences/explicit/common.hpp>
+
+namespace geode
+{
+    class Relationships;
+    struct uuid;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Compact bidirectional index between geological collections of a given
+     * type (faults, horizons, fault blocks or stratigraphic units) and their
+     * items. Items of a collection and collections of an item are stored
+     * contiguously, so both lookups are a single hash access returning a
+     * span of uuids.
+     */
+    class opengeode_geosciences_explicit_api GeologicalCollectionIndex
+    {
+    public:
+        GeologicalCollectionIndex();
+        GeologicalCollectionIndex( const Relationships& relationships,
+            absl::Span< const uuid > collection_ids );
+        GeologicalCollectionIndex( GeologicalCollectionIndex&& ) noexcept;
+        GeologicalCollectionIndex& operator=(
+            GeologicalCollectionIndex&& ) noexcept;
+        ~GeologicalCollectionIndex();
+
+        [[nodiscard]] index_t nb_collections() const;
+
+        /*!
+         * Return the uuids of the items in the given collection.
+         * The span is empty if the collection is unknown.
+         */
+        [[nodiscard]] absl::Span< const uuid > items(
+            const uuid& collection_id ) const;
+
+        /*!
+         * Return the uuids of the indexed collections containing the given
+         * item. The span is empty if the item is in none of them.
+         */
+        [[nodiscard]] absl::Span< const uuid > collections(
+            const uuid& item_id ) const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
+    };
+} // namespace geode
@@ -25,6 +25,7 @@
 
 #include <geode/basic/algorithm.hpp>
 #include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/pimpl.hpp>
 
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/block_collection.hpp>
@@ -42,6 +43,7 @@
 #include <geode/geosciences/explicit/mixin/core/faults.hpp>
 #include <geode/geosciences/explicit/mixin/core/horizons.hpp>
 #include <geode/geosciences/explicit/mixin/core/stratigraphic_units.hpp>
+#include <geode/geosciences/explicit/representation/core/geological_collection_index.hpp>
 
 namespace geode
 {
@@ -150,13 +152,14 @@ namespace geode
                 StratigraphicUnits3D > >;
         using Components = tuple_cat< MeshComponents, CollectionComponents >;
 
-        StructuralModel() = default;
+        StructuralModel();
         StructuralModel( BITSERY );
-        StructuralModel( StructuralModel&& ) noexcept = default;
+        StructuralModel( StructuralModel&& ) noexcept;
         explicit StructuralModel( BRep&& brep ) noexcept;
         StructuralModel( const StructuralModel& initial_model,
             BRep&& brep,
             const ModelGenericMapping& initial_to_brep_mappings ) noexcept;
+        ~StructuralModel();
 
         [[nodiscard]] StructuralModel clone() const;
 
@@ -183,5 +186,36 @@ namespace geode
 
         [[nodiscard]] StratigraphicUnitItemRange stratigraphic_unit_items(
             const StratigraphicUnit3D& stratigraphic_unit ) const;
+
+        /*!
+         * Return the index between Faults and their surfaces. It is computed
+         * on first access and recomputed after any relationship edit, made
+         * through any builder. Concurrent accesses are safe, but the returned
+         * reference is only valid until the next edit.
+         */
+        [[nodiscard]] const GeologicalCollectionIndex& fault_index() const;
+
+        /*!
+         * Return the index between Horizons and their surfaces.
+         * @see fault_index
+         */
+        [[nodiscard]] const GeologicalCollectionIndex& horizon_index() const;
+
+        /*!
+         * Return the index between FaultBlocks and their blocks.
+         * @see fault_index
+         */
+        [[nodiscard]] const GeologicalCollectionIndex&
+            fault_block_index() const;
+
+        /*!
+         * Return the index between StratigraphicUnits and their blocks.
+         * @see fault_index
+         */
+        [[nodiscard]] const GeologicalCollectionIndex&
+            stratigraphic_unit_index() const;
+
+    private:
+        IMPLEMENTATION_MEMBER( impl_ );
     };
 } // namespace geode
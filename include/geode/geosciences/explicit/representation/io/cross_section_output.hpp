@@ -36,6 +36,7 @@
 namespace geode
 {
     class CrossSection;
+    class GeodeArchiveOptions;
 } // namespace geode
 
 namespace geode
@@ -50,6 +51,16 @@ namespace geode
         opengeode_geosciences_explicit_api save_cross_section(
             const CrossSection& cross_section, std::string_view filename );
 
+    /*!
+     * API function for saving a CrossSection with the given archive options.
+     * Only the native geode writer supports other options than the
+     * default ones.
+     */
+    std::vector< std::string > opengeode_geosciences_explicit_api
+        save_cross_section( const CrossSection& cross_section,
+            std::string_view filename,
+            const GeodeArchiveOptions& archive_options );
+
     class CrossSectionOutput : public Output< CrossSection >
     {
     public:
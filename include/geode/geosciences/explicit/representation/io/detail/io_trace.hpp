@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string_view>
+
+#include <geode/geosciences/explicit/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Record the lifetime of this object as one IOTraceEvent if an IO
+         * trace is running. Category and name must outlive the scope.
+         */
+        class opengeode_geosciences_explicit_api IOTraceScope
+        {
+            OPENGEODE_DISABLE_COPY_AND_MOVE( IOTraceScope );
+
+        public:
+            IOTraceScope( std::string_view category, std::string_view name );
+            ~IOTraceScope();
+
+        private:
+            std::string_view category_;
+            std::string_view name_;
+            bool active_;
+            std::chrono::steady_clock::time_point start_;
+        };
+    } // namespace detail
+} // namespace geode
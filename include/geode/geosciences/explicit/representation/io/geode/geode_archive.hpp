@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <geode/basic/detail/geode_output_impl.hpp>
+
+#include <geode/geosciences/explicit/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Layout of the files written by the native geosciences writers.
+     */
+    enum struct ARCHIVE_MODE
+    {
+        /*!
+         * Zip archive whose entries are compressed in parallel with the
+         * compression level of the GeodeArchiveOptions.
+         */
+        compressed,
+        /*!
+         * Zip archive whose entries are stored without compression, same as
+         * a compressed archive with a compression level of 0.
+         */
+        stored,
+        /*!
+         * Plain directory named after the file, without any archive. Meant
+         * for local temporaries. Only a directory previously written in
+         * this mode may be replaced.
+         */
+        directory
+    };
+
+    /*!
+     * Archive options shared by the native geosciences writers.
+     */
+    class opengeode_geosciences_explicit_api GeodeArchiveOptions
+    {
+    public:
+        static constexpr local_index_t DEFAULT_COMPRESSION_LEVEL{ 6 };
+        static constexpr local_index_t MAX_COMPRESSION_LEVEL{ 9 };
+
+        void set_archive_mode( ARCHIVE_MODE mode )
+        {
+            archive_mode_ = mode;
+        }
+
+        [[nodiscard]] ARCHIVE_MODE archive_mode() const
+        {
+            return archive_mode_;
+        }
+
+        /*!
+         * Set the deflate level of the entries of compressed archives, from
+         * 0 (no compression) to MAX_COMPRESSION_LEVEL (smallest archive).
+         */
+        void set_compression_level( local_index_t level )
+        {
+            OpenGeodeGeosciencesExplicitException::check_exception(
+                level <= MAX_COMPRESSION_LEVEL, nullptr,
+                OpenGeodeException::TYPE::data,
+                "[GeodeArchiveOptions::set_compression_level] Compression "
+                "level should be at most ",
+                MAX_COMPRESSION_LEVEL );
+            compression_level_ = level;
+        }
+
+        [[nodiscard]] local_index_t compression_level() const
+        {
+            return compression_level_;
+        }
+
+        [[nodiscard]] bool is_default() const
+        {
+            return archive_mode_ == ARCHIVE_MODE::compressed
+                   && compression_level_ == DEFAULT_COMPRESSION_LEVEL;
+        }
+
+    private:
+        ARCHIVE_MODE archive_mode_{ ARCHIVE_MODE::compressed };
+        local_index_t compression_level_{ DEFAULT_COMPRESSION_LEVEL };
+    };
+
+    namespace detail
+    {
+        /*!
+         * Saves the object with the writer matching the filename extension
+         * with the given archive options. Only native geode writers support
+         * other options than the default ones.
+         */
+        template < typename Factory, typename Object >
+        std::vector< std::string > save_geode_archive( const Object& object,
+            std::string_view filename,
+            const GeodeArchiveOptions& archive_options )
+        {
+            const auto output =
+                geode_object_output_writer< Factory >( filename );
+            auto* options =
+                dynamic_cast< GeodeArchiveOptions* >( output.get() );
+            OpenGeodeGeosciencesExplicitException::check_exception(
+                options != nullptr || archive_options.is_default(), nullptr,
+                OpenGeodeException::TYPE::data,
+                "[save_geode_archive] Archive options are only supported by "
+                "native geode files, cannot save file: ",
+                filename );
+            if( options )
+            {
+                *options = archive_options;
+            }
+            return output->write( object );
+        }
+
+        /*!
+         * Saves the files in a directory with the given function, then turns
+         * them into the given file according to the archive options. Zip
+         * entries are compressed in parallel, then gathered in a sibling
+         * archive renamed over the output once complete. In directory mode,
+         * the files are saved in a sibling directory renamed over the output
+         * once complete, and an existing output is only replaced if it was
+         * written in directory mode.
+         */
+        void opengeode_geosciences_explicit_api write_geode_archive(
+            std::string_view filename,
+            const GeodeArchiveOptions& options,
+            const std::function< void( std::string_view ) >& save_files );
+
+        /*!
+         * Calls the load function with a directory holding the files of the
+         * given zip archive, or with the given directory itself if the file
+         * was written in directory mode.
+         */
+        void opengeode_geosciences_explicit_api read_geode_archive(
+            std::string_view filename,
+            std::string_view type,
+            const std::function< void( std::string_view ) >& load_files );
+
+        /*!
+         * Returns the content of the given entry of a geode archive without
+         * extracting the other entries, the last one if the entry was
+         * updated. Returns std::nullopt if there is no such entry.
+         */
+        [[nodiscard]] std::optional< std::string >
+            opengeode_geosciences_explicit_api read_geode_archive_entry(
+                std::string_view filename, std::string_view entry );
+
+        /*!
+         * Returns the size of the files held by a geode archive once
+         * extracted: the sum of the uncompressed sizes of the zip entries, or
+         * of the sizes of the files of a directory archive.
+         */
+        [[nodiscard]] std::uint64_t opengeode_geosciences_explicit_api
+            geode_archive_payload_size( std::string_view filename );
+
+        /*!
+         * Adds every file of the directory, recursively, to a geode archive,
+         * replacing the entries of the same name. New entries are compressed
+         * in parallel according to the options, then appended in place of
+         * the zip central directory, which is written again after them. The
+         * other entries are neither read nor moved. Replaced entries stay in
+         * the zip archive, but are overridden by the appended ones when it
+         * is extracted: writing the whole model again compacts it.
+         */
+        void opengeode_geosciences_explicit_api update_geode_archive(
+            std::string_view filename,
+            std::string_view directory,
+            const GeodeArchiveOptions& options );
+    } // namespace detail
+} // namespace geode
@@ -28,6 +28,7 @@
 
 #include <geode/geosciences/explicit/representation/core/cross_section.hpp>
 #include <geode/geosciences/explicit/representation/io/cross_section_output.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 
 namespace geode
 {
@@ -37,7 +38,8 @@ namespace geode
 namespace geode
 {
     class opengeode_geosciences_explicit_api OpenGeodeCrossSectionOutput final
-        : public CrossSectionOutput
+        : public CrossSectionOutput,
+          public GeodeArchiveOptions
     {
     public:
         explicit OpenGeodeCrossSectionOutput( std::string_view filename );
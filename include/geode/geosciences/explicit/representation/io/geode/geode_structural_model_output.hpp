@@ -27,6 +27,7 @@
 #include <vector>
 
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/explicit/representation/io/structural_model_output.hpp>
 
 namespace geode
@@ -37,7 +38,8 @@ namespace geode
 namespace geode
 {
     class opengeode_geosciences_explicit_api OpenGeodeStructuralModelOutput
-        final : public StructuralModelOutput
+        final : public StructuralModelOutput,
+                public GeodeArchiveOptions
     {
     public:
         explicit OpenGeodeStructuralModelOutput( std::string_view filename );
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <absl/types/span.h>
+
+#include <geode/geosciences/explicit/common.hpp>
+
+namespace geode
+{
+    /*!
+     * One timed phase of a geosciences reader or writer.
+     * The category is the saved or loaded object type (e.g. StructuralModel,
+     * HorizonsStack) and the name is the phase and component type (e.g.
+     * "save Faults", "load BRep", "archive").
+     * Start time is relative to the call to start_io_trace.
+     */
+    struct IOTraceEvent
+    {
+        std::string category;
+        std::string name;
+        double start_seconds{ 0 };
+        double duration_seconds{ 0 };
+        std::uint32_t thread{ 0 };
+    };
+
+    /*!
+     * Start recording the phases of every geosciences reader and writer.
+     * Previously recorded events are discarded.
+     */
+    void opengeode_geosciences_explicit_api start_io_trace();
+
+    /*!
+     * Stop recording and return the recorded phases sorted by start time.
+     */
+    [[nodiscard]] std::vector< IOTraceEvent >
+        opengeode_geosciences_explicit_api stop_io_trace();
+
+    /*!
+     * Save the events in the Chrome trace event format, readable by
+     * chrome://tracing or Perfetto.
+     */
+    void opengeode_geosciences_explicit_api save_io_trace(
+        absl::Span< const IOTraceEvent > events, std::string_view filename );
+} // namespace geode
@@ -36,6 +36,7 @@
 namespace geode
 {
     class StructuralModel;
+    class GeodeArchiveOptions;
 } // namespace geode
 
 namespace geode
@@ -50,6 +51,16 @@ namespace geode
         save_structural_model( const StructuralModel& structural_model,
             std::string_view filename );
 
+    /*!
+     * API function for saving a StructuralModel with the given archive options.
+     * Only the native geode writer supports other options than the
+     * default ones.
+     */
+    std::vector< std::string > opengeode_geosciences_explicit_api
+        save_structural_model( const StructuralModel& structural_model,
+            std::string_view filename,
+            const GeodeArchiveOptions& archive_options );
+
     class StructuralModelOutput : public Output< StructuralModel >
     {
     public:
@@ -56,6 +56,21 @@ namespace geode
          */
         void remove_above_relation( const uuid& id1, const uuid& id2 );
 
+        /*!
+         * Starts a batch of edits. Until end_batch_edition is called, removed
+         * relations and components are ignored by queries but are not yet
+         * deleted from the relationships. Prefer a scope object such as
+         * HorizonsStackBatchEdition, which ends the batch even if an
+         * exception is thrown.
+         */
+        void start_batch_edition();
+
+        /*!
+         * Deletes all the relations and components removed since
+         * start_batch_edition in a single pass.
+         */
+        void end_batch_edition();
+
         void copy_stratigraphic_relationships( const ModelCopyMapping& mapping,
             const StratigraphicRelationships& relationships );
 
@@ -101,6 +101,21 @@ namespace geode
             const uuid& id2,
             StratigraphicRelationshipsBuilderKey );
 
+        /*!
+         * Starts a batch of edits: removed relations and components are only
+         * flagged until the matching end_batch_edition is called, and queries
+         * already ignore them. Added relations are created immediately.
+         * Batches may be nested, only the outermost end applies the removals.
+         */
+        void start_batch_edition( StratigraphicRelationshipsBuilderKey );
+
+        /*!
+         * Ends a batch of edits. When the outermost batch ends, all the
+         * flagged removals are applied with a single compaction of the
+         * relationships.
+         */
+        void end_batch_edition( StratigraphicRelationshipsBuilderKey );
+
         void copy_stratigraphic_relationships( const ModelCopyMapping& mapping,
             const StratigraphicRelationships& relationships,
             StratigraphicRelationshipsBuilderKey );
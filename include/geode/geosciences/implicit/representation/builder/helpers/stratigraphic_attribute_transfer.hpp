@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    class StratigraphicModel;
+} // namespace geode
+
+namespace geode
+{
+    struct opengeode_geosciences_implicit_api
+        StratigraphicAttributeTransferResult
+    {
+        /*!
+         * Target block vertices whose stratigraphic coordinates are not
+         * contained in any source block, indexed by target block uuid.
+         * Their attribute values are left unchanged.
+         */
+        absl::flat_hash_map< uuid, std::vector< index_t > > unmapped_vertices;
+        index_t nb_mapped_vertices{ 0 };
+    };
+
+    /*!
+     * Transfers the given scalar vertex attributes from the source model
+     * blocks to the target model blocks through their shared stratigraphic
+     * space. Each target vertex is located in the source stratigraphic space
+     * and the source attributes are interpolated in the found tetrahedron.
+     * Lookups and interpolations are batched per target block and run in
+     * parallel. Missing target attributes are created.
+     */
+    StratigraphicAttributeTransferResult opengeode_geosciences_implicit_api
+        transfer_attributes_through_stratigraphic_space(
+            const StratigraphicModel& source,
+            StratigraphicModel& target,
+            absl::Span< const std::string > attribute_names );
+} // namespace geode
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    class Plane;
+    class StratigraphicModel;
+    class StratigraphicSection;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Slices every block of the model with the given plane and returns the
+     * result as a StratigraphicSection, ready to be queried.
+     * Section coordinates are given in an orthonormal frame of the plane
+     * centered on the plane origin: for a vertical plane, the abscissa is
+     * horizontal and the ordinate is the model vertical axis.
+     * Each sliced block becomes a triangulated surface carrying the
+     * interpolated implicit values. Its stratigraphic location is the
+     * interpolated block location projected on the abscissa direction.
+     * Horizon and fault surfaces become lines, and the horizons stack, the
+     * horizon implicit values and the membership of horizons, faults,
+     * stratigraphic units and fault blocks are copied with the model uuids.
+     * Blocks and surfaces are sliced in parallel. Section components are not
+     * linked by boundary relations.
+     */
+    [[nodiscard]] StratigraphicSection opengeode_geosciences_implicit_api
+        slice_stratigraphic_model(
+            const StratigraphicModel& model, const Plane& plane );
+} // namespace geode
@@ -116,8 +116,35 @@ namespace geode
 
         void compute_top_and_bottom_horizons();
 
+        /*!
+         * Ends the batch of edits started with start_batch_edition: removed
+         * relations and components are deleted in a single pass, then top
+         * and bottom horizons are computed once.
+         */
+        void end_batch_edition();
+
     private:
         HorizonsStack< dimension >& horizons_stack_;
     };
     ALIAS_2D_AND_3D( HorizonsStackBuilder );
+
+    /*!
+     * Scope of a batch of edits on a HorizonsStack: the batch is started on
+     * construction and ended on destruction, even if an exception is thrown
+     * in between.
+     */
+    template < index_t dimension >
+    class HorizonsStackBatchEdition
+    {
+        OPENGEODE_DISABLE_COPY_AND_MOVE( HorizonsStackBatchEdition );
+
+    public:
+        explicit HorizonsStackBatchEdition(
+            HorizonsStackBuilder< dimension >& builder );
+        ~HorizonsStackBatchEdition();
+
+    private:
+        HorizonsStackBuilder< dimension >& builder_;
+    };
+    ALIAS_2D_AND_3D( HorizonsStackBatchEdition );
 } // namespace geode
@@ -35,6 +35,12 @@ namespace geode
     ALIAS_2D( HorizonsStack );
     FORWARD_DECLARATION_DIMENSION_CLASS( HorizonsStackBuilder );
     ALIAS_2D( HorizonsStackBuilder );
+    namespace detail
+    {
+        template < index_t dimension >
+        struct QueryTreeBoxes;
+        ALIAS_2D( QueryTreeBoxes );
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -65,11 +71,32 @@ namespace geode
 
         void reinitialize_implicit_query_trees();
 
+        /*!
+         * Keeps the given bounding boxes of the surface polygons, typically
+         * loaded from a section archive, to build the surface query tree on
+         * its first query.
+         */
+        void set_implicit_query_tree_boxes( const Surface2D& surface,
+            detail::QueryTreeBoxes2D&& polygon_boxes );
+
         void instantiate_implicit_attribute_on_surfaces();
 
         void set_implicit_value(
             const Surface2D& surface, index_t vertex_id, double value );
 
+        /*!
+         * Set the affine transform (scale and offset) applied on the fly to
+         * the stored implicit values. Previous transform is replaced, no
+         * vertex value is modified.
+         */
+        void set_implicit_value_transform( double scale, double offset );
+
+        /*!
+         * Apply the current implicit value transform to every stored vertex
+         * value and reset the transform to identity.
+         */
+        void bake_implicit_value_transform();
+
         void set_horizons_stack( HorizonsStack2D&& stack );
 
         void set_horizon_implicit_value(
@@ -23,16 +23,27 @@
 
 #pragma once
 
+#include <memory>
+
+#include <absl/types/span.h>
+
 #include <geode/geosciences/explicit/representation/builder/structural_model_builder.hpp>
 #include <geode/geosciences/implicit/common.hpp>
 
 namespace geode
 {
     class ImplicitStructuralModel;
+    enum struct IMPLICIT_STORAGE_PRECISION;
     FORWARD_DECLARATION_DIMENSION_CLASS( HorizonsStack );
     ALIAS_3D( HorizonsStack );
     FORWARD_DECLARATION_DIMENSION_CLASS( HorizonsStackBuilder );
     ALIAS_3D( HorizonsStackBuilder );
+    namespace detail
+    {
+        template < index_t dimension >
+        struct QueryTreeBoxes;
+        ALIAS_3D( QueryTreeBoxes );
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -60,11 +71,83 @@ namespace geode
 
         void reinitialize_implicit_query_trees();
 
+        /*!
+         * Keeps the given bounding boxes of the block polyhedra, typically
+         * loaded from a model archive, to build the block query tree on its
+         * first query.
+         */
+        void set_implicit_query_tree_boxes( const Block3D& block,
+            detail::QueryTreeBoxes3D&& polyhedron_boxes );
+
+        /*!
+         * Keeps the given bounding boxes of the block polyhedra in
+         * stratigraphic space, for a StratigraphicModel built from the model.
+         */
+        void set_stratigraphic_query_tree_boxes( const Block3D& block,
+            detail::QueryTreeBoxes3D&& polyhedron_boxes );
+
+        /*!
+         * Labels every block tetrahedron with the StratigraphicUnit containing
+         * its barycenter and flags the tetrahedra cut by a horizon isovalue.
+         * Tetrahedra are classified in parallel. Labels are invalidated by
+         * any later modification of the implicit values, of the horizon
+         * isovalues or of the HorizonsStack.
+         */
+        void compute_stratigraphic_unit_labels();
+
         void instantiate_implicit_attribute_on_blocks();
 
         void set_implicit_value(
             const Block3D& block, index_t vertex_id, double value );
 
+        /*!
+         * Set the stored implicit values of every block vertex, before the
+         * implicit value transform is applied, typically loaded from a model
+         * archive.
+         */
+        void set_block_stored_implicit_values(
+            const Block3D& block, absl::Span< const double > values );
+
+        /*!
+         * Must be called after editing the mesh of the block through its mesh
+         * builder: the stratigraphic unit labels, the query trees of the block
+         * and its mapped implicit values are dropped.
+         */
+        void notify_block_mesh_change( const Block3D& block );
+
+        /*!
+         * Read the implicit values of the block from the given read-only
+         * array, e.g. memory mapped from a model archive, instead of its
+         * attribute. The array must hold the stored values of every block
+         * vertex and stays alive as long as owner is held. The mapping is
+         * dropped by any modification of the block implicit values.
+         */
+        void map_implicit_values( const Block3D& block,
+            absl::Span< const double > values,
+            std::shared_ptr< const void > owner );
+
+        /*!
+         * Set the affine transform (scale and offset) applied on the fly to
+         * the stored implicit values. Previous transform is replaced, no
+         * vertex value is modified.
+         */
+        void set_implicit_value_transform( double scale, double offset );
+
+        /*!
+         * Apply the current implicit value transform to every stored vertex
+         * value and reset the transform to identity.
+         */
+        void bake_implicit_value_transform();
+
+        /*!
+         * Convert the implicit values of every block to the given storage
+         * precision. Single precision halves the memory used by the implicit
+         * attribute. Stratigraphic locations of a StratigraphicModel are
+         * always stored in double precision.
+         */
+        void set_implicit_value_precision(
+            IMPLICIT_STORAGE_PRECISION precision );
+
         void set_horizons_stack( HorizonsStack3D&& stack );
 
         void set_horizon_implicit_value(
@@ -60,6 +60,13 @@ namespace geode
             index_t vertex_id,
             const StratigraphicPoint3D& value );
 
+        /*!
+         * Enables or disables the interleaved (u, v, w) store used by the
+         * stratigraphic kernels. Enabling it builds the store of every block,
+         * disabling it releases the stored coordinates.
+         */
+        void set_interleaved_stratigraphic_coordinates( bool use );
+
         void import_old_stratigraphic_attribute_values_from_attribute_name(
             std::string_view attribute_name );
 
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <absl/types/span.h>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Block );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    FORWARD_DECLARATION_DIMENSION_CLASS( StratigraphicPoint );
+    FORWARD_DECLARATION_DIMENSION_CLASS( Surface );
+    ALIAS_3D( Block );
+    ALIAS_2D_AND_3D( Point );
+    ALIAS_2D_AND_3D( StratigraphicPoint );
+    ALIAS_2D( Surface );
+    class ImplicitCrossSection;
+    class ImplicitStructuralModel;
+    class StratigraphicSection;
+    class StratigraphicModel;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Computes the implicit value of each given point in the given block.
+     * Points are processed in parallel, those outside the block get NaN.
+     * Output span must have the same size as the input span.
+     */
+    void opengeode_geosciences_implicit_api batch_implicit_values(
+        const ImplicitStructuralModel& model,
+        const Block3D& block,
+        absl::Span< const Point3D > points,
+        absl::Span< double > values );
+
+    /*!
+     * Computes the implicit value of each given point in the given surface.
+     * Points are processed in parallel, those outside the surface get NaN.
+     * Output span must have the same size as the input span.
+     */
+    void opengeode_geosciences_implicit_api batch_implicit_values(
+        const ImplicitCrossSection& section,
+        const Surface2D& surface,
+        absl::Span< const Point2D > points,
+        absl::Span< double > values );
+
+    /*!
+     * Copies the implicit value of every vertex of the given block into the
+     * output span, which size must be the number of block vertices.
+     */
+    void opengeode_geosciences_implicit_api block_implicit_values(
+        const ImplicitStructuralModel& model,
+        const Block3D& block,
+        absl::Span< double > values );
+
+    /*!
+     * Computes the stratigraphic coordinates of each given point in the given
+     * block. Points are processed in parallel, those outside the block get
+     * NaN coordinates.
+     */
+    void opengeode_geosciences_implicit_api batch_stratigraphic_coordinates(
+        const StratigraphicModel& model,
+        const Block3D& block,
+        absl::Span< const Point3D > points,
+        absl::Span< StratigraphicPoint3D > stratigraphic_points );
+
+    /*!
+     * Computes the stratigraphic coordinates of each given point in the given
+     * surface. Points are processed in parallel, those outside the surface
+     * get NaN coordinates.
+     */
+    void opengeode_geosciences_implicit_api batch_stratigraphic_coordinates(
+        const StratigraphicSection& section,
+        const Surface2D& surface,
+        absl::Span< const Point2D > points,
+        absl::Span< StratigraphicPoint2D > stratigraphic_points );
+
+    /*!
+     * Computes the geometric coordinates of each given stratigraphic point in
+     * the given block. Points are processed in parallel, those outside the
+     * block stratigraphic space get NaN coordinates.
+     */
+    void opengeode_geosciences_implicit_api batch_geometric_coordinates(
+        const StratigraphicModel& model,
+        const Block3D& block,
+        absl::Span< const StratigraphicPoint3D > stratigraphic_points,
+        absl::Span< Point3D > points );
+
+    /*!
+     * Computes the geometric coordinates of each given stratigraphic point in
+     * the given surface. Points are processed in parallel, those outside the
+     * surface stratigraphic space get NaN coordinates.
+     */
+    void opengeode_geosciences_implicit_api batch_geometric_coordinates(
+        const StratigraphicSection& section,
+        const Surface2D& surface,
+        absl::Span< const StratigraphicPoint2D > stratigraphic_points,
+        absl::Span< Point2D > points );
+} // namespace geode
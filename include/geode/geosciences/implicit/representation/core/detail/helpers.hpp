@@ -50,6 +50,11 @@ namespace geode
 {
     namespace detail
     {
+        /*!
+         * Multiplies the implicit values by the given factor. The factor is
+         * composed with the section implicit value transform, vertex values
+         * are left untouched until the transform is baked.
+         */
         void opengeode_geosciences_implicit_api rescale_implicit_value(
             ImplicitCrossSection& section, double scaling_factor );
 
@@ -57,6 +62,11 @@ namespace geode
             rescale_implicit_value_to_bbox_scale(
                 StratigraphicSection& section );
 
+        /*!
+         * Multiplies the implicit values by the given factor. The factor is
+         * composed with the model implicit value transform, vertex values are
+         * left untouched until the transform is baked.
+         */
         void opengeode_geosciences_implicit_api rescale_implicit_value(
             ImplicitStructuralModel& model, double scaling_factor );
 
@@ -66,9 +76,26 @@ namespace geode
         void opengeode_geosciences_implicit_api save_stratigraphic_surfaces(
             const StratigraphicSection& section, std::string_view prefix );
 
+        /*!
+         * Saves each block in stratigraphic space as a native
+         * TetrahedralSolid3D file named prefix + block index, with the
+         * geometric coordinates stored in the "geode_xyz" attribute.
+         */
         void opengeode_geosciences_implicit_api save_stratigraphic_blocks(
             const StratigraphicModel& model, std::string_view prefix );
 
+        /*!
+         * Saves each block in stratigraphic space through the
+         * TetrahedralSolid3D output registered for the given extension, e.g.
+         * "vtu" when OpenGeode-IO is loaded. Only the vertices, tetrahedra and
+         * adjacencies of the block meshes are copied, not their attributes,
+         * and blocks are processed in parallel.
+         */
+        void opengeode_geosciences_implicit_api save_stratigraphic_blocks(
+            const StratigraphicModel& model,
+            std::string_view prefix,
+            std::string_view extension );
+
         [[nodiscard]] ImplicitCrossSection opengeode_geosciences_implicit_api
             implicit_section_from_cross_section_scalar_field(
                 CrossSection&& section, const uuid& scalar_attribute_id );
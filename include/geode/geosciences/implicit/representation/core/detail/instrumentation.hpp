@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/functional/function_ref.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        class opengeode_geosciences_implicit_api InstrumentationCounter
+        {
+            OPENGEODE_DISABLE_COPY_AND_MOVE( InstrumentationCounter );
+
+        public:
+            /*!
+             * Counter of a whole model event, registered in the
+             * instrumentation snapshot for its whole lifetime.
+             */
+            explicit InstrumentationCounter( std::string_view name );
+
+            /*!
+             * Counter of one component, owned and reported by an
+             * InstrumentationComponentCounters.
+             */
+            InstrumentationCounter(
+                std::string_view name, std::string component_id );
+
+            ~InstrumentationCounter();
+
+            void increment()
+            {
+                count_.fetch_add( 1, std::memory_order_relaxed );
+            }
+
+            void add( std::chrono::nanoseconds duration )
+            {
+                count_.fetch_add( 1, std::memory_order_relaxed );
+                nanoseconds_.fetch_add(
+                    duration.count(), std::memory_order_relaxed );
+            }
+
+            [[nodiscard]] std::string_view name() const
+            {
+                return name_;
+            }
+
+            [[nodiscard]] std::string_view component_id() const
+            {
+                return component_id_;
+            }
+
+            [[nodiscard]] std::uint64_t count() const
+            {
+                return count_.load( std::memory_order_relaxed );
+            }
+
+            [[nodiscard]] std::chrono::nanoseconds duration() const
+            {
+                return std::chrono::nanoseconds{ nanoseconds_.load(
+                    std::memory_order_relaxed ) };
+            }
+
+            void reset()
+            {
+                count_.store( 0, std::memory_order_relaxed );
+                nanoseconds_.store( 0, std::memory_order_relaxed );
+            }
+
+        private:
+            std::string_view name_;
+            std::string component_id_;
+            bool registered_;
+            std::atomic< std::uint64_t > count_{ 0 };
+            std::atomic< std::int64_t > nanoseconds_{ 0 };
+        };
+
+        /*!
+         * Set of counters sharing one event name, one per model component.
+         * Counters are created on first use, up to MAX_COMPONENTS. Events of
+         * further components are gathered in one counter identified by
+         * OTHER_COMPONENTS. The set is registered in the instrumentation
+         * snapshot and emptied by reset_instrumentation(), counters still
+         * used by a timer being released when the timer ends.
+         */
+        class opengeode_geosciences_implicit_api
+            InstrumentationComponentCounters
+        {
+            OPENGEODE_DISABLE_COPY_AND_MOVE( InstrumentationComponentCounters );
+
+        public:
+            static constexpr std::size_t MAX_COMPONENTS{ 1024 };
+            static constexpr auto OTHER_COMPONENTS = "other";
+
+            explicit InstrumentationComponentCounters( std::string_view name );
+
+            ~InstrumentationComponentCounters();
+
+            [[nodiscard]] std::shared_ptr< InstrumentationCounter > counter(
+                const uuid& component_id );
+
+            void visit( absl::FunctionRef< void(
+                    const InstrumentationCounter& ) > visitor ) const;
+
+            void clear();
+
+        private:
+            std::string_view name_;
+            mutable std::shared_mutex mutex_;
+            absl::flat_hash_map< uuid,
+                std::shared_ptr< InstrumentationCounter > >
+                counters_;
+            std::shared_ptr< InstrumentationCounter > other_counter_;
+        };
+
+        class InstrumentationTimer
+        {
+            OPENGEODE_DISABLE_COPY_AND_MOVE( InstrumentationTimer );
+
+        public:
+            explicit InstrumentationTimer( InstrumentationCounter& counter )
+                : counter_( counter ),
+                  start_( std::chrono::steady_clock::now() )
+            {
+            }
+
+            explicit InstrumentationTimer(
+                std::shared_ptr< InstrumentationCounter > counter )
+                : counter_( *counter ),
+                  counter_owner_( std::move( counter ) ),
+                  start_( std::chrono::steady_clock::now() )
+            {
+            }
+
+            ~InstrumentationTimer()
+            {
+                counter_.add( std::chrono::steady_clock::now() - start_ );
+            }
+
+        private:
+            InstrumentationCounter& counter_;
+            std::shared_ptr< InstrumentationCounter > counter_owner_;
+            std::chrono::steady_clock::time_point start_;
+        };
+    } // namespace detail
+} // namespace geode
+
+#ifdef OPENGEODE_GEOSCIENCES_INSTRUMENTATION
+#    define OPENGEODE_GEOSCIENCES_COUNT_EVENT( name )                          \
+        do                                                                     \
+        {                                                                      \
+            static ::geode::detail::InstrumentationCounter                     \
+                instrumentation_counter{ name };                               \
+            instrumentation_counter.increment();                               \
+        } while( false )
+#    define OPENGEODE_GEOSCIENCES_TIME_SCOPE( name )                           \
+        static ::geode::detail::InstrumentationCounter                         \
+            instrumentation_scope_counter{ name };                             \
+        const ::geode::detail::InstrumentationTimer                            \
+            instrumentation_scope_timer( instrumentation_scope_counter )
+#    define OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT( name, component_id )  \
+        do                                                                     \
+        {                                                                      \
+            static ::geode::detail::InstrumentationComponentCounters           \
+                instrumentation_counters{ name };                              \
+            instrumentation_counters.counter( component_id )->increment();     \
+        } while( false )
+#    define OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE( name, component_id )   \
+        static ::geode::detail::InstrumentationComponentCounters               \
+            instrumentation_scope_counters{ name };                            \
+        const ::geode::detail::InstrumentationTimer                            \
+            instrumentation_component_scope_timer(                             \
+                instrumentation_scope_counters.counter( component_id ) )
+#else
+#    define OPENGEODE_GEOSCIENCES_COUNT_EVENT( name )
+#    define OPENGEODE_GEOSCIENCES_TIME_SCOPE( name )
+#    define OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT( name, component_id )
+#    define OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE( name, component_id )
+#endif
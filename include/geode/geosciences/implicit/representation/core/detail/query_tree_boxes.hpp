@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/functional/function_ref.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geometry/bounding_box.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Bounding boxes of the elements of a component mesh, as given to
+         * the AABBTree constructor, with the fingerprint of the vertex
+         * coordinates they were computed from.
+         */
+        template < index_t dimension >
+        struct QueryTreeBoxes
+        {
+            std::uint64_t fingerprint{ 0 };
+            std::vector< BoundingBox< dimension > > boxes;
+        };
+        ALIAS_2D_AND_3D( QueryTreeBoxes );
+
+        /*!
+         * Query tree boxes loaded from a file, kept per component until the
+         * component tree is first built.
+         * Boxes of different components may be taken concurrently.
+         */
+        template < index_t dimension >
+        class SavedQueryTreeBoxes
+        {
+        public:
+            void set( const uuid& component_id,
+                QueryTreeBoxes< dimension >&& boxes )
+            {
+                saved_[component_id] = std::move( boxes );
+            }
+
+            /*!
+             * Returns the saved boxes of the component, at most once, if
+             * their number and fingerprint still match the component mesh.
+             * The fingerprint is only computed when boxes are saved.
+             */
+            [[nodiscard]] std::optional<
+                std::vector< BoundingBox< dimension > > >
+                take( const uuid& component_id,
+                    index_t nb_boxes,
+                    absl::FunctionRef< std::uint64_t() > fingerprint ) const
+            {
+                const auto saved = saved_.find( component_id );
+                if( saved == saved_.end() || saved->second.boxes.empty() )
+                {
+                    return std::nullopt;
+                }
+                auto boxes = std::move( saved->second.boxes );
+                saved->second.boxes.clear();
+                if( boxes.size() != nb_boxes
+                    || fingerprint() != saved->second.fingerprint )
+                {
+                    return std::nullopt;
+                }
+                return boxes;
+            }
+
+        private:
+            mutable absl::flat_hash_map< uuid, QueryTreeBoxes< dimension > >
+                saved_;
+        };
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    class ImplicitStructuralModel;
+} // namespace geode
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Sorted horizon isovalues and the StratigraphicUnit lying between
+         * each pair of consecutive isovalues, and beyond the first and last
+         * ones. Interval i lies between isovalues i - 1 and i.
+         */
+        struct StratigraphicUnitIntervals
+        {
+            [[nodiscard]] index_t interval( double value ) const
+            {
+                const auto position = absl::c_upper_bound( isovalues, value );
+                return static_cast< index_t >( position - isovalues.begin() );
+            }
+
+            [[nodiscard]] std::optional< uuid > unit( double value ) const
+            {
+                return units[interval( value )];
+            }
+
+            /*!
+             * Returns true if an isovalue lies strictly between the given
+             * values.
+             */
+            [[nodiscard]] bool is_cut(
+                double min_value, double max_value ) const
+            {
+                const auto position =
+                    absl::c_upper_bound( isovalues, min_value );
+                return position != isovalues.end() && *position < max_value;
+            }
+
+            std::vector< double > isovalues;
+            std::vector< std::optional< uuid > > units;
+        };
+
+        [[nodiscard]] StratigraphicUnitIntervals
+            opengeode_geosciences_implicit_api stratigraphic_unit_intervals(
+                const ImplicitStructuralModel& model );
+    } // namespace detail
+} // namespace geode
@@ -39,6 +39,12 @@ namespace geode
     ALIAS_2D( Point );
     ALIAS_2D( HorizonsStack );
     class ImplicitCrossSectionBuilder;
+    namespace detail
+    {
+        template < index_t dimension >
+        struct QueryTreeBoxes;
+        ALIAS_2D( QueryTreeBoxes );
+    } // namespace detail
 } // namespace geode
 
 namespace geode
@@ -53,6 +59,11 @@ namespace geode
     {
     public:
         PASSKEY( ImplicitCrossSectionBuilder, ImplicitCrossSectionBuilderKey );
+        /*!
+         * Name of the vertex attribute holding the implicit values. The section
+         * implicit value transform is stored beside it: until the transform
+         * is baked, the attribute holds the values before the transform.
+         */
         static constexpr auto IMPLICIT_ATTRIBUTE_NAME =
             "geode_implicit_attribute";
         using implicit_attribute_type = double;
@@ -106,6 +117,19 @@ namespace geode
             const Point2D& point,
             index_t polygon_id ) const;
 
+        /*!
+         * Return the scale of the affine transform applied to the stored
+         * implicit attribute values: implicit values returned by the section
+         * are equal to scale * stored_value + offset.
+         */
+        [[nodiscard]] double implicit_value_scale() const;
+
+        /*!
+         * Return the offset of the affine transform applied to the stored
+         * implicit attribute values.
+         */
+        [[nodiscard]] double implicit_value_offset() const;
+
         /*!
          * Returns the surface polygon containing the given point, if there is
          * any.
@@ -113,6 +137,13 @@ namespace geode
         [[nodiscard]] std::optional< index_t > containing_polygon(
             const Surface2D& surface, const Point2D& point ) const;
 
+        /*!
+         * Builds every surface query tree not yet computed, surfaces being
+         * processed in parallel. Trees are otherwise built lazily on the
+         * first query in each surface.
+         */
+        void compute_implicit_query_trees() const;
+
         [[nodiscard]] const HorizonsStack2D& horizons_stack() const;
 
         [[nodiscard]] std::optional< implicit_attribute_type >
@@ -127,6 +158,16 @@ namespace geode
     public:
         void initialize_implicit_query_trees( ImplicitCrossSectionBuilderKey );
 
+        /*!
+         * Keeps the given bounding boxes of the surface polygons to build the
+         * surface query tree on its first query, instead of computing them
+         * from the surface mesh. The boxes are ignored if the fingerprint of
+         * the surface mesh vertices no longer matches.
+         */
+        void set_implicit_query_tree_boxes( const Surface2D& surface,
+            detail::QueryTreeBoxes2D&& polygon_boxes,
+            ImplicitCrossSectionBuilderKey );
+
         void instantiate_implicit_attribute_on_surfaces(
             ImplicitCrossSectionBuilderKey );
 
@@ -135,6 +176,11 @@ namespace geode
             double value,
             ImplicitCrossSectionBuilderKey );
 
+        void set_implicit_value_transform(
+            double scale, double offset, ImplicitCrossSectionBuilderKey );
+
+        void bake_implicit_value_transform( ImplicitCrossSectionBuilderKey );
+
         void set_horizons_stack(
             HorizonsStack2D&& stack, ImplicitCrossSectionBuilderKey );
 
@@ -149,6 +195,9 @@ namespace geode
         virtual void do_set_implicit_value(
             const Surface2D& surface, index_t vertex_id, double value );
 
+        virtual void do_set_implicit_value_transform(
+            double scale, double offset );
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -23,27 +23,95 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <vector>
+
+#include <absl/types/span.h>
 
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl.hpp>
+#include <geode/basic/uuid.hpp>
 
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
 #include <geode/geosciences/implicit/common.hpp>
 
 namespace geode
 {
+    FORWARD_DECLARATION_DIMENSION_CLASS( BoundingBox );
     FORWARD_DECLARATION_DIMENSION_CLASS( Point );
     FORWARD_DECLARATION_DIMENSION_CLASS( HorizonsStack );
     FORWARD_DECLARATION_DIMENSION_CLASS( Horizon );
-    ALIAS_3D( Point );
+    ALIAS_3D( BoundingBox );
+    ALIAS_2D_AND_3D( Point );
     ALIAS_3D( HorizonsStack );
     ALIAS_3D( Horizon );
     class ImplicitStructuralModelBuilder;
+    namespace detail
+    {
+        template < index_t dimension >
+        struct QueryTreeBoxes;
+        template < index_t dimension >
+        class SavedQueryTreeBoxes;
+        ALIAS_3D( QueryTreeBoxes );
+        ALIAS_3D( SavedQueryTreeBoxes );
+    } // namespace detail
 } // namespace geode
 
 namespace geode
 {
+    /*!
+     * Storage type of the implicit values on block vertices. Values stored
+     * in single precision are widened to double for interpolation.
+     */
+    enum struct IMPLICIT_STORAGE_PRECISION
+    {
+        double_precision,
+        single_precision
+    };
+
+    /*!
+     * Part of a vertical column lying in a single StratigraphicUnit, between
+     * the top and bottom elevations of the unit along the column.
+     */
+    struct StratigraphicColumnInterval
+    {
+        [[nodiscard]] double thickness() const
+        {
+            return top - bottom;
+        }
+
+        uuid stratigraphic_unit;
+        double top;
+        double bottom;
+    };
+
+    /*!
+     * Intervals of a set of vertical columns, stored contiguously. Intervals
+     * of the column c are those between offsets[c] and offsets[c + 1], sorted
+     * from top to bottom.
+     */
+    struct StratigraphicColumns
+    {
+        [[nodiscard]] index_t nb_columns() const
+        {
+            return offsets.empty()
+                       ? 0
+                       : static_cast< index_t >( offsets.size() - 1 );
+        }
+
+        [[nodiscard]] absl::Span< const StratigraphicColumnInterval > column(
+            index_t column_id ) const
+        {
+            return absl::MakeConstSpan( intervals )
+                .subspan( offsets[column_id],
+                    offsets[column_id + 1] - offsets[column_id] );
+        }
+
+        std::vector< index_t > offsets;
+        std::vector< StratigraphicColumnInterval > intervals;
+    };
+
     /*!
      * An Implicit Model is a Structural model where each block has a specific
      * attribute to store the implicit value on its vertices. Moreover, an
@@ -59,9 +127,20 @@ namespace geode
     public:
         PASSKEY(
             ImplicitStructuralModelBuilder, ImplicitStructuralModelBuilderKey );
+        /*!
+         * Name of the vertex attribute holding the implicit values. The model
+         * implicit value transform is stored beside it: until the transform
+         * is baked, the attribute holds the values before the transform.
+         */
         static constexpr auto IMPLICIT_ATTRIBUTE_NAME =
             "geode_implicit_attribute";
+        static constexpr auto STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME =
+            "geode_stratigraphic_unit_label";
+        static constexpr auto HORIZON_CUT_ATTRIBUTE_NAME = "geode_horizon_cut";
         using implicit_attribute_type = double;
+
+        using STORAGE_PRECISION = IMPLICIT_STORAGE_PRECISION;
+
         ImplicitStructuralModel();
         ImplicitStructuralModel( BITSERY );
         ImplicitStructuralModel(
@@ -90,12 +169,29 @@ namespace geode
 
         [[nodiscard]] const uuid& implicit_attribute_id() const;
 
+        [[nodiscard]] STORAGE_PRECISION implicit_value_precision() const;
+
         /*!
          * Return the implicit value at the given vertex of the given block.
          */
         [[nodiscard]] implicit_attribute_type implicit_value(
             const Block3D& block, index_t vertex_id ) const;
 
+        /*!
+         * Return the value stored at the given vertex of the given block,
+         * before applying the implicit value transform.
+         */
+        [[nodiscard]] implicit_attribute_type stored_implicit_value(
+            const Block3D& block, index_t vertex_id ) const;
+
+        /*!
+         * Return true if the implicit values of the given block are read from
+         * a read-only memory mapped array.
+         * @see ImplicitStructuralModelBuilder::map_implicit_values
+         */
+        [[nodiscard]] bool has_mapped_implicit_values(
+            const Block3D& block ) const;
+
         /*!
          * Return the implicit value on the point, computed in the polyhedron
          * containing the given point in the given block, if there is any.
@@ -112,6 +208,19 @@ namespace geode
             const Point3D& point,
             index_t polyhedron_id ) const;
 
+        /*!
+         * Return the scale of the affine transform applied to the stored
+         * implicit attribute values: implicit values returned by the model
+         * are equal to scale * stored_value + offset.
+         */
+        [[nodiscard]] double implicit_value_scale() const;
+
+        /*!
+         * Return the offset of the affine transform applied to the stored
+         * implicit attribute values.
+         */
+        [[nodiscard]] double implicit_value_offset() const;
+
         /*!
          * Returns the block polyhedron containing the given point, if there is
          * any.
@@ -119,6 +228,19 @@ namespace geode
         [[nodiscard]] std::optional< index_t > containing_polyhedron(
             const Block3D& block, const Point3D& point ) const;
 
+        /*!
+         * Builds every block query tree not yet computed, blocks being
+         * processed in parallel. Trees are otherwise built lazily on the
+         * first query in each block.
+         */
+        void compute_implicit_query_trees() const;
+
+        /*!
+         * Returns true if the query tree of the given block is built.
+         */
+        [[nodiscard]] bool has_implicit_query_tree(
+            const Block3D& block ) const;
+
         [[nodiscard]] const HorizonsStack3D& horizons_stack() const;
 
         [[nodiscard]] std::optional< implicit_attribute_type >
@@ -130,10 +252,106 @@ namespace geode
         [[nodiscard]] std::optional< uuid > containing_stratigraphic_unit(
             implicit_attribute_type implicit_function_value ) const;
 
+        /*!
+         * Returns the StratigraphicUnits crossed by vertical lines going
+         * through the given map locations. Each tetrahedron crossed by a line
+         * is split at the exact crossings of the horizon isovalues, and
+         * contiguous parts of the same unit are merged over tetrahedra and
+         * blocks. Parts outside of any unit are left out. Columns are
+         * computed in parallel.
+         */
+        [[nodiscard]] StratigraphicColumns stratigraphic_columns(
+            absl::Span< const Point2D > locations ) const;
+
+        /*!
+         * Returns true if the block tetrahedra are labelled with their
+         * StratigraphicUnit, and if the labels are up to date with the
+         * implicit values and the horizon isovalues. Every implicit value
+         * edit, and every block mesh edit notified to the builder, bumps a
+         * version that makes the labels out of date. The per tetrahedron
+         * accessors below throw on out of date labels.
+         */
+        [[nodiscard]] bool has_stratigraphic_unit_labels() const;
+
+        /*!
+         * Returns the StratigraphicUnit of each label. Label i is the interval
+         * between the i-th and (i+1)-th sorted horizon isovalues, no unit
+         * meaning the interval lies outside of the HorizonsStack.
+         */
+        [[nodiscard]] absl::Span< const std::optional< uuid > >
+            stratigraphic_unit_label_table() const;
+
+        /*!
+         * Returns the label of the given tetrahedron, stored in the
+         * STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME polyhedron attribute and
+         * computed from the implicit value at the tetrahedron barycenter.
+         */
+        [[nodiscard]] local_index_t stratigraphic_unit_label(
+            const Block3D& block, index_t tetrahedron_id ) const;
+
+        [[nodiscard]] std::optional< uuid > tetrahedron_stratigraphic_unit(
+            const Block3D& block, index_t tetrahedron_id ) const;
+
+        /*!
+         * Returns true if a horizon isovalue lies strictly between the
+         * implicit values of the tetrahedron vertices. The flag is stored in
+         * the HORIZON_CUT_ATTRIBUTE_NAME polyhedron attribute.
+         */
+        [[nodiscard]] bool is_cut_by_horizon(
+            const Block3D& block, index_t tetrahedron_id ) const;
+
     public:
         void initialize_implicit_query_trees(
             ImplicitStructuralModelBuilderKey );
 
+        /*!
+         * Keeps the given bounding boxes of the block polyhedra to build the
+         * block query tree on its first query, instead of computing them
+         * from the block mesh. The boxes are ignored if the fingerprint of
+         * the block mesh vertices no longer matches.
+         */
+        void set_implicit_query_tree_boxes( const Block3D& block,
+            detail::QueryTreeBoxes3D&& polyhedron_boxes,
+            ImplicitStructuralModelBuilderKey );
+
+        /*!
+         * Keeps the given bounding boxes of the block polyhedra in
+         * stratigraphic space, used by a StratigraphicModel built from this
+         * model to build its block stratigraphic query tree.
+         */
+        void set_stratigraphic_query_tree_boxes( const Block3D& block,
+            detail::QueryTreeBoxes3D&& polyhedron_boxes,
+            ImplicitStructuralModelBuilderKey );
+
+        void compute_stratigraphic_unit_labels(
+            ImplicitStructuralModelBuilderKey );
+
+        /*!
+         * Drops the labels and removes their polyhedron attributes from the
+         * block meshes, so that out of date labels are never saved.
+         */
+        void reset_stratigraphic_unit_labels(
+            ImplicitStructuralModelBuilderKey );
+
+        /*!
+         * Drops everything derived from the implicit values of the given
+         * block after its stored values were written directly.
+         */
+        void notify_block_implicit_values_change(
+            const Block3D& block, ImplicitStructuralModelBuilderKey );
+
+        /*!
+         * Drops everything derived from the mesh of the given block after it
+         * was edited through its mesh builder.
+         */
+        void notify_block_mesh_change(
+            const Block3D& block, ImplicitStructuralModelBuilderKey );
+
+        void map_implicit_values( const Block3D& block,
+            absl::Span< const double > values,
+            std::shared_ptr< const void > owner,
+            ImplicitStructuralModelBuilderKey );
+
         void instantiate_implicit_attribute_on_blocks(
             ImplicitStructuralModelBuilderKey );
 
@@ -142,6 +360,15 @@ namespace geode
             implicit_attribute_type value,
             ImplicitStructuralModelBuilderKey );
 
+        void set_implicit_value_transform( double scale,
+            double offset,
+            ImplicitStructuralModelBuilderKey );
+
+        void bake_implicit_value_transform( ImplicitStructuralModelBuilderKey );
+
+        void set_implicit_value_precision(
+            STORAGE_PRECISION precision, ImplicitStructuralModelBuilderKey );
+
         void set_horizons_stack(
             HorizonsStack3D&& stack, ImplicitStructuralModelBuilderKey );
 
@@ -153,10 +380,36 @@ namespace geode
             ImplicitStructuralModelBuilderKey );
 
     protected:
+        [[nodiscard]] const detail::SavedQueryTreeBoxes3D&
+            saved_stratigraphic_query_tree_boxes() const;
+
         virtual void do_set_implicit_value( const Block3D& block,
             index_t vertex_id,
             implicit_attribute_type value );
 
+        virtual void do_set_implicit_value_transform(
+            double scale, double offset );
+
+        /*!
+         * Called after the implicit value of the given block vertex changed.
+         * Calls implicit_values_changed( block ) by default.
+         */
+        virtual void implicit_value_changed(
+            const Block3D& block, index_t vertex_id );
+
+        /*!
+         * Called after the implicit values of the given block changed. Does
+         * nothing by default.
+         */
+        virtual void implicit_values_changed( const Block3D& block );
+
+        /*!
+         * Called after the implicit values of every block changed, e.g. when
+         * the transform or the storage precision is modified. Does nothing
+         * by default.
+         */
+        virtual void implicit_values_changed();
+
     private:
         friend class bitsery::Access;
         template < typename Archive >
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    /*!
+     * Accumulated count and duration of one instrumented event.
+     * Duration is zero for events that are only counted.
+     * Events attributed to a model component (Block or Surface) have one
+     * record per component, identified by its uuid string, up to 1024
+     * components per event, the next ones sharing the "other" record. The
+     * component id is empty for events of the whole model.
+     */
+    struct InstrumentationRecord
+    {
+        std::string name;
+        std::string component_id;
+        std::uint64_t count{ 0 };
+        double seconds{ 0 };
+    };
+
+    /*!
+     * Return true if the library was compiled with
+     * OPENGEODE_GEOSCIENCES_WITH_INSTRUMENTATION. Otherwise no event is
+     * recorded and the snapshot is always empty.
+     */
+    [[nodiscard]] bool opengeode_geosciences_implicit_api
+        is_instrumentation_enabled();
+
+    /*!
+     * Return the current value of every instrumented event (query tree
+     * builds and resets, point location queries and their failures, unit
+     * lookups and stack traversals), sorted by event name then component.
+     */
+    [[nodiscard]] std::vector< InstrumentationRecord >
+        opengeode_geosciences_implicit_api instrumentation_snapshot();
+
+    /*!
+     * Set all instrumentation counters and timers back to zero and drop the
+     * records of every model component.
+     */
+    void opengeode_geosciences_implicit_api reset_instrumentation();
+} // namespace geode
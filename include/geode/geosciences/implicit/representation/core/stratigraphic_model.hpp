@@ -23,8 +23,15 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl.hpp>
+#include <geode/basic/uuid.hpp>
 
 #include <geode/geosciences/implicit/common.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
@@ -141,8 +148,63 @@ namespace geode
             stratigraphic_surface(
                 const Block3D& block, const Surface3D& surface ) const;
 
+        /*!
+         * Returns the stratigraphic surfaces of every boundary and internal
+         * surface of the given block, indexed by surface uuid. Results are
+         * the same as calling stratigraphic_surface on each surface, but the
+         * block facets are indexed only once and surfaces are processed in
+         * parallel.
+         */
+        [[nodiscard]] absl::flat_hash_map< uuid,
+            absl::InlinedVector< std::unique_ptr< TriangulatedSurface3D >, 2 > >
+            stratigraphic_surfaces( const Block3D& block ) const;
+
+        /*!
+         * Builds every block query tree, geometric and stratigraphic, not yet
+         * computed. Blocks are processed in parallel.
+         */
+        void compute_stratigraphic_query_trees() const;
+
+        /*!
+         * Returns true if the stratigraphic query tree of the given block is
+         * built.
+         */
+        [[nodiscard]] bool has_stratigraphic_query_tree(
+            const Block3D& block ) const;
+
         [[nodiscard]] BoundingBox3D stratigraphic_bounding_box() const;
 
+        /*!
+         * Returns the stratigraphic coordinates of every vertex of the given
+         * block, stored contiguously and indexed by block vertex, or an empty
+         * span if the interleaved store is not in use. The store is built
+         * when enabled and kept up to date by the builder edits: single
+         * vertex edits update it in place, block wide edits rebuild the block
+         * store. Const queries never modify it. The returned span dangles
+         * after any modification of the model, it must not be kept across
+         * edits.
+         */
+        [[nodiscard]] absl::Span< const StratigraphicPoint3D >
+            interleaved_stratigraphic_coordinates( const Block3D& block ) const;
+
+        /*!
+         * Shares the interleaved store of the given block, or returns nullptr
+         * if the store is not in use. Later edits never modify a shared
+         * store: they copy it first, so the snapshot stays valid and
+         * unchanged for as long as it is held.
+         */
+        [[nodiscard]] std::shared_ptr<
+            const std::vector< StratigraphicPoint3D > >
+            interleaved_stratigraphic_coordinates_snapshot(
+                const Block3D& block ) const;
+
+        /*!
+         * Returns true if the stratigraphic query trees, inverse mappings and
+         * stratigraphic surfaces read vertex coordinates from the interleaved
+         * store instead of the location and implicit attributes.
+         */
+        [[nodiscard]] bool uses_interleaved_stratigraphic_coordinates() const;
+
         [[nodiscard]] const uuid& stratigraphic_location_attribute_id() const;
 
     public:
@@ -157,10 +219,24 @@ namespace geode
             stratigraphic_location_type value,
             StratigraphicModelBuilderKey );
 
+        void set_interleaved_stratigraphic_coordinates(
+            bool use, StratigraphicModelBuilderKey );
+
+        /*!
+         * Drops the stratigraphic query trees and rebuilds the interleaved
+         * store after the stratigraphic location attributes were written
+         * directly.
+         */
+        void notify_stratigraphic_locations_change(
+            StratigraphicModelBuilderKey );
+
     private:
-        void do_set_implicit_value( const Block3D& block,
-            index_t vertex_id,
-            implicit_attribute_type value ) override;
+        void implicit_value_changed(
+            const Block3D& block, index_t vertex_id ) override;
+
+        void implicit_values_changed( const Block3D& block ) override;
+
+        void implicit_values_changed() override;
 
     private:
         IMPLEMENTATION_MEMBER( impl_ );
@@ -144,6 +144,12 @@ namespace geode
             stratigraphic_line(
                 const Surface2D& surface, const Line2D& line ) const;
 
+        /*!
+         * Builds every surface query tree, geometric and stratigraphic, not
+         * yet computed. Surfaces are processed in parallel.
+         */
+        void compute_stratigraphic_query_trees() const;
+
         [[nodiscard]] BoundingBox2D stratigraphic_bounding_box() const;
 
         [[nodiscard]] const uuid& stratigraphic_location_attribute_id() const;
@@ -165,6 +171,9 @@ namespace geode
             index_t vertex_id,
             double value ) override;
 
+        void do_set_implicit_value_transform(
+            double scale, double offset ) override;
+
     private:
         IMPLEMENTATION_MEMBER( impl_ );
     };
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <limits>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Point );
+    ALIAS_2D( Point );
+    class ImplicitStructuralModel;
+} // namespace geode
+
+namespace geode
+{
+    /*!
+     * Gross volumes of the tetrahedral blocks of an ImplicitStructuralModel.
+     * Unit volumes only account for the parts of the blocks lying between
+     * horizon isovalues bounding a StratigraphicUnit.
+     */
+    struct opengeode_geosciences_implicit_api ImplicitModelVolumetrics
+    {
+        absl::flat_hash_map< uuid, double > block_volumes;
+        absl::flat_hash_map< uuid, double > fault_block_volumes;
+        absl::flat_hash_map< uuid, double > stratigraphic_unit_volumes;
+
+        /*!
+         * Volume of each StratigraphicUnit in each block, indexed by block
+         * uuid then by unit uuid.
+         */
+        absl::flat_hash_map< uuid, absl::flat_hash_map< uuid, double > >
+            block_stratigraphic_unit_volumes;
+
+        /*!
+         * Volume of each StratigraphicUnit in each FaultBlock, indexed by
+         * fault block uuid then by unit uuid.
+         */
+        absl::flat_hash_map< uuid, absl::flat_hash_map< uuid, double > >
+            fault_block_stratigraphic_unit_volumes;
+    };
+
+    struct StratigraphicUnitThicknessStatistics
+    {
+        index_t nb_columns{ 0 };
+        double min{ std::numeric_limits< double >::max() };
+        double max{ 0 };
+        double mean{ 0 };
+        double standard_deviation{ 0 };
+    };
+
+    /*!
+     * Computes the volumes of the model blocks, fault blocks and
+     * StratigraphicUnits. Each tetrahedron is split at the exact crossings of
+     * the horizon isovalues by the linear implicit field, and each part is
+     * assigned to the unit containing it. Tetrahedra are processed in
+     * parallel by fixed-size chunks whose sums are reduced in a fixed order,
+     * so results do not depend on the number of threads.
+     * Up to date stratigraphic unit labels are used to skip the tetrahedra
+     * not cut by any horizon.
+     */
+    [[nodiscard]] ImplicitModelVolumetrics opengeode_geosciences_implicit_api
+        implicit_model_volumetrics( const ImplicitStructuralModel& model );
+
+    /*!
+     * Computes the thickness statistics of each StratigraphicUnit over the
+     * vertical columns going through the given map locations. The thickness
+     * of a unit in a column is the sum of the lengths of its intervals.
+     * Columns not crossing a unit are not accounted for in its statistics.
+     */
+    [[nodiscard]] absl::flat_hash_map< uuid,
+        StratigraphicUnitThicknessStatistics >
+        opengeode_geosciences_implicit_api
+        stratigraphic_unit_thickness_statistics(
+            const ImplicitStructuralModel& model,
+            absl::Span< const Point2D > locations );
+} // namespace geode
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * 64-bit FNV-1a hash, stable across executions. Values made of 64-bit
+         * words are hashed one word at a time instead of byte by byte.
+         */
+        class Fingerprint
+        {
+        public:
+            template < typename Type >
+            void add_value( const Type& value )
+            {
+                static_assert( std::is_trivially_copyable_v< Type > );
+                const auto* bytes =
+                    reinterpret_cast< const unsigned char* >( &value );
+                if constexpr( sizeof( Type ) % sizeof( std::uint64_t ) == 0 )
+                {
+                    for( std::size_t offset = 0; offset < sizeof( Type );
+                         offset += sizeof( std::uint64_t ) )
+                    {
+                        std::uint64_t word;
+                        std::memcpy( &word, bytes + offset, sizeof( word ) );
+                        add_word( word );
+                    }
+                }
+                else
+                {
+                    for( const auto byte : absl::Span< const unsigned char >{
+                             bytes, sizeof( Type ) } )
+                    {
+                        add_word( byte );
+                    }
+                }
+            }
+
+            void add_string( std::string_view value )
+            {
+                std::size_t offset{ 0 };
+                for( ; offset + sizeof( std::uint64_t ) <= value.size();
+                     offset += sizeof( std::uint64_t ) )
+                {
+                    std::uint64_t word;
+                    std::memcpy(
+                        &word, value.data() + offset, sizeof( word ) );
+                    add_word( word );
+                }
+                for( ; offset < value.size(); offset++ )
+                {
+                    add_word( static_cast< unsigned char >( value[offset] ) );
+                }
+            }
+
+            [[nodiscard]] std::uint64_t value() const
+            {
+                return value_;
+            }
+
+        private:
+            void add_word( std::uint64_t word )
+            {
+                value_ ^= word;
+                value_ *= 1099511628211ULL;
+            }
+
+        private:
+            std::uint64_t value_{ 14695981039346656037ULL };
+        };
+
+        template < typename Mesh >
+        [[nodiscard]] std::uint64_t mesh_vertices_fingerprint(
+            const Mesh& mesh )
+        {
+            Fingerprint fingerprint;
+            fingerprint.add_value( mesh.nb_vertices() );
+            for( const auto v : Range{ mesh.nb_vertices() } )
+            {
+                fingerprint.add_value( mesh.point( v ) );
+            }
+            return fingerprint.value();
+        }
+
+        /*!
+         * Fingerprint of the stratigraphic coordinates of the block vertices
+         * in the given StratigraphicModel.
+         */
+        template < typename Model, typename Block >
+        [[nodiscard]] std::uint64_t block_stratigraphic_coordinates_fingerprint(
+            const Model& model, const Block& block )
+        {
+            Fingerprint fingerprint;
+            const auto nb_vertices = block.mesh().nb_vertices();
+            fingerprint.add_value( nb_vertices );
+            for( const auto v : Range{ nb_vertices } )
+            {
+                fingerprint.add_value(
+                    model.stratigraphic_coordinates( block, v )
+                        .stratigraphic_coordinates() );
+            }
+            return fingerprint.value();
+        }
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include <absl/types/span.h>
+
+#include <geode/basic/pimpl.hpp>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Block );
+    ALIAS_3D( Block );
+    class ImplicitStructuralModel;
+} // namespace geode
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Saves, in the given directory, the stored implicit values of every
+         * tetrahedral block and, when the block has some, its stratigraphic
+         * locations as interleaved (u, v) pairs. Arrays are written as raw
+         * little-endian doubles aligned on 64 bytes and indexed by an offset
+         * table, so that they can be memory mapped.
+         */
+        void opengeode_geosciences_implicit_api save_implicit_model_fields(
+            const ImplicitStructuralModel& model, std::string_view directory );
+
+        /*!
+         * Return true if the given directory holds saved fields.
+         */
+        [[nodiscard]] bool opengeode_geosciences_implicit_api
+            has_implicit_model_fields( std::string_view directory );
+
+        /*!
+         * Read-only memory mapping of the fields saved by
+         * save_implicit_model_fields. Processes mapping the same file share
+         * the fields through the page cache.
+         */
+        class opengeode_geosciences_implicit_api MappedImplicitModelFields
+        {
+        public:
+            struct BlockFields
+            {
+                absl::Span< const double > implicit_values;
+                /*!
+                 * Interleaved (u, v) pairs, empty if the block had no
+                 * stratigraphic locations when saved.
+                 */
+                absl::Span< const double > stratigraphic_locations;
+            };
+
+        public:
+            explicit MappedImplicitModelFields( std::string_view filename );
+            MappedImplicitModelFields(
+                MappedImplicitModelFields&& other ) noexcept;
+            ~MappedImplicitModelFields();
+
+            [[nodiscard]] index_t nb_blocks() const;
+
+            /*!
+             * Return the mapped fields of the given block, if they were saved
+             * and its mesh vertices still match the saved ones.
+             */
+            [[nodiscard]] std::optional< BlockFields > block_fields(
+                const Block3D& block ) const;
+
+        private:
+            IMPLEMENTATION_MEMBER( impl_ );
+        };
+
+        /*!
+         * Memory maps the fields saved in the given directory, e.g. an
+         * archive written in directory mode, and makes the model read the
+         * implicit values of every matching block from the mapping. The
+         * mapping of a block is dropped as soon as its implicit values are
+         * modified. Returns the number of mapped blocks.
+         */
+        index_t opengeode_geosciences_implicit_api map_implicit_model_fields(
+            ImplicitStructuralModel& model, std::string_view directory );
+    } // namespace detail
+} // namespace geode
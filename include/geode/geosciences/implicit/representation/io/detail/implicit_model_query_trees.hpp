@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    class ImplicitCrossSection;
+    class ImplicitStructuralModel;
+} // namespace geode
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Saves, in the given directory, the bounding boxes of the polyhedra
+         * of every tetrahedral block with a fingerprint of the block mesh
+         * vertices. For a StratigraphicModel, the boxes of the polyhedra in
+         * stratigraphic space are also saved with a fingerprint of the
+         * vertex stratigraphic coordinates.
+         */
+        void opengeode_geosciences_implicit_api
+            save_implicit_model_query_trees(
+                const ImplicitStructuralModel& model,
+                std::string_view directory );
+
+        /*!
+         * Gives the boxes saved in the given directory to the model. No tree
+         * is built: each block tree is built from its boxes on the first
+         * query in the block, if the block mesh still matches the saved
+         * fingerprint, and from the block mesh otherwise.
+         * Returns the number of loaded box sets.
+         */
+        index_t opengeode_geosciences_implicit_api
+            load_implicit_model_query_trees(
+                ImplicitStructuralModel& model, std::string_view directory );
+
+        /*!
+         * Saves, in the given directory, the bounding boxes of the polygons
+         * of every triangulated surface with a fingerprint of the surface
+         * mesh vertices.
+         */
+        void opengeode_geosciences_implicit_api
+            save_implicit_section_query_trees(
+                const ImplicitCrossSection& section,
+                std::string_view directory );
+
+        /*!
+         * Gives the boxes saved in the given directory to the section, each
+         * surface tree being built from them on its first query.
+         * Returns the number of loaded box sets.
+         */
+        index_t opengeode_geosciences_implicit_api
+            load_implicit_section_query_trees(
+                ImplicitCrossSection& section, std::string_view directory );
+    } // namespace detail
+} // namespace geode
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    FORWARD_DECLARATION_DIMENSION_CLASS( Block );
+    ALIAS_3D( Block );
+    class ImplicitStructuralModel;
+    class StratigraphicModel;
+} // namespace geode
+
+namespace geode
+{
+    namespace detail
+    {
+        /*!
+         * Saves, in the given directory, the stored implicit values of the
+         * block as a standalone file. Used by archive updates to replace the
+         * values of a block without writing its mesh again.
+         */
+        void opengeode_geosciences_implicit_api save_block_implicit_values(
+            const ImplicitStructuralModel& model,
+            const Block3D& block,
+            std::string_view directory );
+
+        /*!
+         * Applies the block implicit values saved in the given directory on
+         * top of the values loaded with the block meshes. Returns the number
+         * of updated blocks.
+         */
+        index_t opengeode_geosciences_implicit_api load_block_implicit_values(
+            ImplicitStructuralModel& model, std::string_view directory );
+
+        /*!
+         * Saves, in the given directory, the stratigraphic locations of the
+         * block vertices as a standalone file. Used by archive updates of
+         * StratigraphicModels.
+         */
+        void opengeode_geosciences_implicit_api
+            save_block_stratigraphic_locations(
+                const StratigraphicModel& model,
+                const Block3D& block,
+                std::string_view directory );
+
+        /*!
+         * Applies the block stratigraphic locations saved in the given
+         * directory on top of the ones loaded with the block meshes. Returns
+         * the number of updated blocks.
+         */
+        index_t opengeode_geosciences_implicit_api
+            load_block_stratigraphic_locations(
+                StratigraphicModel& model, std::string_view directory );
+    } // namespace detail
+} // namespace geode
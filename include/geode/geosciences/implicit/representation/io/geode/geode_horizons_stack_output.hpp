@@ -32,6 +32,7 @@
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
 #include <geode/geosciences/implicit/representation/io/horizons_stack_output.hpp>
 
@@ -54,6 +55,7 @@ namespace geode
 
         void archive_horizons_stack_files( const ZipFile& zip_writer ) const
         {
+            const detail::IOTraceScope trace{ "HorizonsStack", "archive" };
             for( const auto& file :
                 std::filesystem::directory_iterator( zip_writer.directory() ) )
             {
@@ -67,14 +69,24 @@ namespace geode
         {
             async::parallel_invoke(
                 [&directory, &horizons_stack] {
+                    const detail::IOTraceScope trace{ "HorizonsStack",
+                        "save Identifier" };
                     horizons_stack.save_identifier( directory );
                 },
                 [&directory, &horizons_stack] {
+                    const detail::IOTraceScope trace{ "HorizonsStack",
+                        "save StratigraphicRelationships" };
                     horizons_stack.save_stratigraphic_relationships(
                         directory );
                 },
                 [&directory, &horizons_stack] {
-                    horizons_stack.save_horizons( directory );
+                    {
+                        const detail::IOTraceScope trace{ "HorizonsStack",
+                            "save Horizons" };
+                        horizons_stack.save_horizons( directory );
+                    }
+                    const detail::IOTraceScope trace{ "HorizonsStack",
+                        "save StratigraphicUnits" };
                     horizons_stack.save_stratigraphic_units( directory );
                 } );
         }
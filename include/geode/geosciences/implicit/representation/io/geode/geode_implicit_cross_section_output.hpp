@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_cross_section.hpp>
 #include <geode/geosciences/implicit/representation/io/implicit_cross_section_output.hpp>
 
@@ -37,7 +38,8 @@ namespace geode
 namespace geode
 {
     class opengeode_geosciences_implicit_api OpenGeodeImplicitCrossSectionOutput
-        final : public ImplicitCrossSectionOutput
+        final : public ImplicitCrossSectionOutput,
+                public GeodeArchiveOptions
     {
     public:
         explicit OpenGeodeImplicitCrossSectionOutput(
@@ -51,6 +53,21 @@ namespace geode
             return ImplicitCrossSection::native_extension_static();
         }
 
+        /*!
+         * Also store, when writing, the bounding boxes of the surface
+         * polygons so that reading the section does not recompute them
+         * before building each surface query tree. Disabled by default.
+         */
+        void set_save_query_trees( bool enabled )
+        {
+            save_query_trees_ = enabled;
+        }
+
+        [[nodiscard]] bool save_query_trees() const
+        {
+            return save_query_trees_;
+        }
+
         void archive_implicit_section_files( const ZipFile& zip_writer ) const;
 
         void save_implicit_section_files(
@@ -59,5 +76,8 @@ namespace geode
 
         std::vector< std::string > write(
             const ImplicitCrossSection& implicit_section ) const final;
+
+    private:
+        bool save_query_trees_{ false };
     };
 } // namespace geode
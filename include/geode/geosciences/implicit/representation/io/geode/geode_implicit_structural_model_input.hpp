@@ -67,5 +67,14 @@ namespace geode
         void opengeode_geosciences_implicit_api
             load_implicit_structural_model_files(
                 ImplicitStructuralModel& model, std::string_view directory );
+
+        /*!
+         * Loads every file of an extracted ImplicitStructuralModel archive:
+         * the structural model files, the implicit impl, the implicit value
+         * overlays and the stored query trees.
+         */
+        void opengeode_geosciences_implicit_api
+            load_implicit_structural_model_directory(
+                ImplicitStructuralModel& model, std::string_view directory );
     } // namespace detail
 } // namespace geode
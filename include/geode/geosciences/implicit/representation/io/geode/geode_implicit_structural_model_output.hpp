@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
 #include <geode/geosciences/implicit/representation/io/implicit_structural_model_output.hpp>
 
@@ -38,7 +39,8 @@ namespace geode
 {
     class opengeode_geosciences_implicit_api
         OpenGeodeImplicitStructuralModelOutput final
-        : public ImplicitStructuralModelOutput
+        : public ImplicitStructuralModelOutput,
+          public GeodeArchiveOptions
     {
     public:
         explicit OpenGeodeImplicitStructuralModelOutput(
@@ -52,6 +54,52 @@ namespace geode
             return ImplicitStructuralModel::native_extension_static();
         }
 
+        /*!
+         * Also store, when writing, the fingerprint of the model topology,
+         * geometry and implicit values needed by update(). Disabled by
+         * default since computing it is a full pass over every mesh.
+         */
+        void set_update_fingerprint( bool enabled )
+        {
+            update_fingerprint_ = enabled;
+        }
+
+        [[nodiscard]] bool update_fingerprint() const
+        {
+            return update_fingerprint_;
+        }
+
+        /*!
+         * Also store, when writing, the bounding boxes of the block
+         * polyhedra so that reading the model does not recompute them before
+         * building each block query tree. Disabled by default.
+         */
+        void set_save_query_trees( bool enabled )
+        {
+            save_query_trees_ = enabled;
+        }
+
+        [[nodiscard]] bool save_query_trees() const
+        {
+            return save_query_trees_;
+        }
+
+        /*!
+         * Also store, when writing, the implicit values and stratigraphic
+         * locations of the blocks as flat arrays that the reader memory maps
+         * for archives written in directory mode. Disabled by default.
+         * @see detail::save_implicit_model_fields
+         */
+        void set_save_mapped_fields( bool enabled )
+        {
+            save_mapped_fields_ = enabled;
+        }
+
+        [[nodiscard]] bool save_mapped_fields() const
+        {
+            return save_mapped_fields_;
+        }
+
         void archive_implicit_model_files( const ZipFile& zip_writer ) const;
 
         void save_implicit_model_files(
@@ -60,5 +108,26 @@ namespace geode
 
         std::vector< std::string > write(
             const ImplicitStructuralModel& implicit_model ) const final;
+
+        /*!
+         * Update an archive previously written from the same model geometry
+         * with the update fingerprint enabled. Only the implicit model impl,
+         * the horizons stack and the values of the blocks whose implicit
+         * values (or stratigraphic locations for a StratigraphicModel)
+         * changed are serialized again. They are appended in place after the
+         * existing entries, followed by a new central directory; the
+         * replaced entries are left in the file until the next write().
+         * The mapped fields are saved again if enabled or if the archive
+         * already holds some, so that they never get stale.
+         * Throws if the archive has no fingerprint or if the stored one does
+         * not match the model topology and geometry.
+         */
+        std::vector< std::string > update(
+            const ImplicitStructuralModel& implicit_model ) const;
+
+    private:
+        bool update_fingerprint_{ false };
+        bool save_query_trees_{ false };
+        bool save_mapped_fields_{ false };
     };
 } // namespace geode
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/io/stratigraphic_model_input.hpp>
+
+namespace geode
+{
+    class opengeode_geosciences_implicit_api OpenGeodeStratigraphicModelInput
+        final : public StratigraphicModelInput
+    {
+    public:
+        explicit OpenGeodeStratigraphicModelInput( std::string_view filename )
+            : StratigraphicModelInput( filename )
+        {
+        }
+
+        [[nodiscard]] static std::string_view extension()
+        {
+            return StratigraphicModel::native_extension_static();
+        }
+
+        [[nodiscard]] StratigraphicModel read() final;
+
+        [[nodiscard]] AdditionalFiles additional_files() const final
+        {
+            return {};
+        }
+
+        [[nodiscard]] index_t object_priority() const final
+        {
+            return 0;
+        }
+
+        [[nodiscard]] Percentage is_loadable() const final
+        {
+            return Percentage{ 1 };
+        }
+    };
+} // namespace geode
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/io/stratigraphic_model_output.hpp>
+
+namespace geode
+{
+    class opengeode_geosciences_implicit_api OpenGeodeStratigraphicModelOutput
+        final : public StratigraphicModelOutput,
+                public GeodeArchiveOptions
+    {
+    public:
+        explicit OpenGeodeStratigraphicModelOutput( std::string_view filename )
+            : StratigraphicModelOutput( filename )
+        {
+        }
+
+        [[nodiscard]] static std::string_view extension()
+        {
+            return StratigraphicModel::native_extension_static();
+        }
+
+        /*!
+         * Also store, when writing, the fingerprint needed by update().
+         * Disabled by default.
+         */
+        void set_update_fingerprint( bool enabled )
+        {
+            update_fingerprint_ = enabled;
+        }
+
+        [[nodiscard]] bool update_fingerprint() const
+        {
+            return update_fingerprint_;
+        }
+
+        /*!
+         * Also store, when writing, the bounding boxes of the block
+         * polyhedra. Disabled by default.
+         */
+        void set_save_query_trees( bool enabled )
+        {
+            save_query_trees_ = enabled;
+        }
+
+        [[nodiscard]] bool save_query_trees() const
+        {
+            return save_query_trees_;
+        }
+
+        /*!
+         * Also store, when writing, the implicit values and stratigraphic
+         * locations as memory mappable arrays. Disabled by default.
+         * @see OpenGeodeImplicitStructuralModelOutput::set_save_mapped_fields
+         */
+        void set_save_mapped_fields( bool enabled )
+        {
+            save_mapped_fields_ = enabled;
+        }
+
+        [[nodiscard]] bool save_mapped_fields() const
+        {
+            return save_mapped_fields_;
+        }
+
+        std::vector< std::string > write(
+            const StratigraphicModel& stratigraphic_model ) const final;
+
+        /*!
+         * Update an archive previously written with the update fingerprint
+         * enabled, appending only the implicit values and stratigraphic
+         * locations of the blocks that changed.
+         * @see OpenGeodeImplicitStructuralModelOutput::update
+         */
+        std::vector< std::string > update(
+            const StratigraphicModel& stratigraphic_model ) const;
+
+    private:
+        bool update_fingerprint_{ false };
+        bool save_query_trees_{ false };
+        bool save_mapped_fields_{ false };
+    };
+} // namespace geode
@@ -35,6 +35,7 @@
 namespace geode
 {
     class ImplicitCrossSection;
+    class GeodeArchiveOptions;
 } // namespace geode
 
 namespace geode
@@ -50,6 +51,17 @@ namespace geode
         save_implicit_cross_section( const ImplicitCrossSection& implicit_model,
             std::string_view filename );
 
+    /*!
+     * API function for saving an ImplicitCrossSection with the given
+     * archive options.
+     * Only the native geode writer supports other options than the
+     * default ones.
+     */
+    std::vector< std::string > opengeode_geosciences_implicit_api
+        save_implicit_cross_section( const ImplicitCrossSection& implicit_model,
+            std::string_view filename,
+            const GeodeArchiveOptions& archive_options );
+
     class ImplicitCrossSectionOutput : public Output< ImplicitCrossSection >
     {
     public:
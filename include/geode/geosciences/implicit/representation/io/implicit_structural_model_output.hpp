@@ -35,6 +35,7 @@
 namespace geode
 {
     class ImplicitStructuralModel;
+    class GeodeArchiveOptions;
 } // namespace geode
 
 namespace geode
@@ -51,6 +52,18 @@ namespace geode
             const ImplicitStructuralModel& implicit_model,
             std::string_view filename );
 
+    /*!
+     * API function for saving an ImplicitStructuralModel with the given
+     * archive options.
+     * Only the native geode writer supports other options than the
+     * default ones.
+     */
+    std::vector< std::string > opengeode_geosciences_implicit_api
+        save_implicit_structural_model(
+            const ImplicitStructuralModel& implicit_model,
+            std::string_view filename,
+            const GeodeArchiveOptions& archive_options );
+
     class opengeode_geosciences_implicit_api ImplicitStructuralModelOutput
         : public Output< ImplicitStructuralModel >
     {
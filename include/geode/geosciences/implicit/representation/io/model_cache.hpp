@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include <geode/geosciences/implicit/common.hpp>
+
+namespace geode
+{
+    class ImplicitStructuralModel;
+    class StratigraphicModel;
+} // namespace geode
+
+namespace geode
+{
+    struct ModelCacheStatistics
+    {
+        index_t nb_models{ 0 };
+        std::uint64_t nb_bytes{ 0 };
+        std::uint64_t memory_budget{ 0 };
+        std::uint64_t nb_hits{ 0 };
+        std::uint64_t nb_misses{ 0 };
+        std::uint64_t nb_evictions{ 0 };
+    };
+
+    /*!
+     * Returns a shared read-only StratigraphicModel loaded from the given
+     * file. Models are cached process-wide, keyed by the file path and a
+     * fingerprint of the file content: concurrent and later calls on the
+     * same content share a single instance, loaded once and returned with
+     * every query tree and lazily computed index already built, so that it
+     * can be queried from several threads. A file modified on disk is
+     * reloaded.
+     * @param[in] filename Path to the file to load.
+     */
+    [[nodiscard]] std::shared_ptr< const StratigraphicModel >
+        opengeode_geosciences_implicit_api cached_stratigraphic_model(
+            std::string_view filename );
+
+    /*!
+     * Returns a shared read-only ImplicitStructuralModel loaded from the given
+     * file, with the same caching policy as cached_stratigraphic_model.
+     * @param[in] filename Path to the file to load.
+     */
+    [[nodiscard]] std::shared_ptr< const ImplicitStructuralModel >
+        opengeode_geosciences_implicit_api cached_implicit_structural_model(
+            std::string_view filename );
+
+    /*!
+     * Sets the cache budget, in bytes. The size of a model is estimated from
+     * the uncompressed size of its files and the size of its query trees.
+     * Least recently used models are dropped from the cache when the
+     * budget is exceeded; handles already returned remain valid.
+     * Default budget is unlimited.
+     */
+    void opengeode_geosciences_implicit_api set_model_cache_memory_budget(
+        std::uint64_t nb_bytes );
+
+    [[nodiscard]] ModelCacheStatistics opengeode_geosciences_implicit_api
+        model_cache_statistics();
+
+    /*!
+     * Drops every model from the cache and resets the statistics.
+     * Handles already returned remain valid.
+     */
+    void opengeode_geosciences_implicit_api clear_model_cache();
+} // namespace geode
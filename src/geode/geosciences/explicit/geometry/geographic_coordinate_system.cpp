@@ -23,14 +23,105 @@
 
 #include <geode/geosciences/explicit/geometry/geographic_coordinate_system.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/container/fixed_array.h>
+
+#include <async++.h>
+
 #include <ogr_spatialref.h>
 #include <ogr_srs_api.h>
 
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
 
 #include <geode/mesh/core/internal/points_impl.hpp>
 
+#include <geode/geosciences/explicit/geometry/geographic_coordinate_system_catalogue.hpp>
+
+namespace
+{
+    constexpr geode::index_t POINT_CHUNK_SIZE{ 4096 };
+
+    struct TransformerDeleter
+    {
+        void operator()( OGRCoordinateTransformation* transformer ) const
+        {
+            OGRCoordinateTransformation::DestroyCT( transformer );
+        }
+    };
+
+    using Transformer =
+        std::unique_ptr< OGRCoordinateTransformation, TransformerDeleter >;
+
+    /*!
+     * Coordinate transformations are not thread safe: each chunk borrows a
+     * transformer that no other chunk is using. Transformers are only created
+     * when all existing ones are busy, so their number is bounded by the
+     * number of concurrent workers, and all of them are destroyed when the
+     * conversion ends.
+     */
+    class TransformerPool
+    {
+    public:
+        TransformerPool( std::string origin_code, std::string destination_code )
+            : origin_code_{ std::move( origin_code ) },
+              destination_code_{ std::move( destination_code ) }
+        {
+        }
+
+        Transformer acquire()
+        {
+            {
+                const std::lock_guard< std::mutex > lock{ mutex_ };
+                if( !available_.empty() )
+                {
+                    auto transformer = std::move( available_.back() );
+                    available_.pop_back();
+                    return transformer;
+                }
+            }
+            return create();
+        }
+
+        void release( Transformer transformer )
+        {
+            const std::lock_guard< std::mutex > lock{ mutex_ };
+            available_.emplace_back( std::move( transformer ) );
+        }
+
+    private:
+        Transformer create() const
+        {
+            OGRSpatialReference destination;
+            destination.SetFromUserInput( destination_code_.c_str() );
+            OGRSpatialReference origin;
+            origin.SetFromUserInput( origin_code_.c_str() );
+            Transformer transformer{ OGRCreateCoordinateTransformation(
+                &origin, &destination ) };
+            geode::OpenGeodeGeosciencesExplicitException::check_exception(
+                transformer != nullptr, nullptr,
+                geode::OpenGeodeException::TYPE::data,
+                "[GeographicCoordinateSystem::import_coordinates] Cannot "
+                "create a transformation from ",
+                origin_code_, " to ", destination_code_ );
+            return transformer;
+        }
+
+    private:
+        const std::string origin_code_;
+        const std::string destination_code_;
+        std::mutex mutex_;
+        std::vector< Transformer > available_;
+    };
+} // namespace
+
 namespace geode
 {
 
@@ -67,36 +158,60 @@ namespace geode
             const GeographicCoordinateSystem< dimension >& from,
             GeographicCoordinateSystem< dimension >& to )
         {
-            OGRSpatialReference destination;
-            destination.SetFromUserInput( info_.authority_code().c_str() );
-            OGRSpatialReference origin;
-            origin.SetFromUserInput( from.info().authority_code().c_str() );
-            auto* transformer =
-                OGRCreateCoordinateTransformation( &origin, &destination );
-            for( const auto p : Range{ from.nb_points() } )
+            TransformerPool transformers{ from.info().authority_code(),
+                info_.authority_code() };
+            const auto nb_points = from.nb_points();
+            const auto nb_chunks =
+                ( nb_points + POINT_CHUNK_SIZE - 1 ) / POINT_CHUNK_SIZE;
+            async::parallel_for( async::irange( index_t{ 0 }, nb_chunks ),
+                [&from, &to, &transformers, nb_points]( index_t chunk ) {
+                    auto transformer = transformers.acquire();
+                    import_chunk( from, to, *transformer,
+                        chunk * POINT_CHUNK_SIZE,
+                        std::min( ( chunk + 1 ) * POINT_CHUNK_SIZE,
+                            nb_points ) );
+                    transformers.release( std::move( transformer ) );
+                } );
+        }
+
+    private:
+        static void import_chunk(
+            const GeographicCoordinateSystem< dimension >& from,
+            GeographicCoordinateSystem< dimension >& to,
+            OGRCoordinateTransformation& transformer,
+            index_t begin,
+            index_t end )
+        {
+            std::array< absl::FixedArray< double >, 3 > values{
+                absl::FixedArray< double >( end - begin, 0 ),
+                absl::FixedArray< double >( end - begin, 0 ),
+                absl::FixedArray< double >( end - begin, 0 )
+            };
+            for( const auto p : Range{ begin, end } )
             {
-                auto point = from.point( p );
-                std::array< double, 3 > values{ 0, 0, 0 };
+                const auto point = from.point( p );
                 for( const auto d : LRange{ dimension } )
                 {
-                    values[d] = point.value( d );
+                    values[d][p - begin] = point.value( d );
                 }
-                const auto status = transformer->Transform(
-                    1, &values[0], &values[1], &values[2] );
-                OpenGeodeGeosciencesExplicitException::check_exception( status,
-                    nullptr, OpenGeodeException::TYPE::internal,
-                    "[GeographicCoordinateSystem::convert_geographic_"
-                    "coordinate_system] Failed to convert coordinates" );
+            }
+            const auto status = transformer.Transform( end - begin,
+                values[0].data(), values[1].data(), values[2].data() );
+            OpenGeodeGeosciencesExplicitException::check_exception( status,
+                nullptr, OpenGeodeException::TYPE::internal,
+                "[GeographicCoordinateSystem::convert_geographic_"
+                "coordinate_system] Failed to convert coordinates" );
+            for( const auto p : Range{ begin, end } )
+            {
+                Point< dimension > point;
                 for( const auto d : LRange{ dimension } )
                 {
-                    point.set_value( d, values[d] );
+                    point.set_value( d, values[d][p - begin] );
                 }
                 to.set_point( p, std::move( point ) );
             }
-            OGRCoordinateTransformation::DestroyCT( transformer );
         }
 
-    private:
         template < typename Archive >
         void serialize( Archive& archive )
         {
@@ -161,18 +276,8 @@ namespace geode
     absl::FixedArray< GeographicCoordinateSystemInfo >
         GeographicCoordinateSystem< dimension >::geographic_coordinate_systems()
     {
-        int nb_crs{ 0 };
-        auto** gdal_list =
-            OSRGetCRSInfoListFromDatabase( nullptr, nullptr, &nb_crs );
-        absl::FixedArray< GeographicCoordinateSystemInfo > infos( nb_crs );
-        for( const auto i : Range{ nb_crs } )
-        {
-            const auto* gdal_crs = gdal_list[i];
-            infos[i] = { gdal_crs->pszAuthName, gdal_crs->pszCode,
-                gdal_crs->pszName };
-        }
-        OSRDestroyCRSInfoList( gdal_list );
-        return infos;
+        const auto catalogue = geographic_coordinate_system_catalogue();
+        return { catalogue.begin(), catalogue.end() };
     }
 
     template < index_t dimension >
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/explicit/geometry/geographic_coordinate_system_catalogue.hpp>
+
+#include <string>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/ascii.h>
+#include <absl/strings/match.h>
+
+#include <ogr_srs_api.h>
+
+#include <geode/basic/range.hpp>
+
+namespace
+{
+    geode::GeographicCoordinateSystemType to_type( OSRCRSType type )
+    {
+        switch( type )
+        {
+        case OSR_CRS_TYPE_GEOGRAPHIC_2D:
+            return geode::GeographicCoordinateSystemType::geographic_2d;
+        case OSR_CRS_TYPE_GEOGRAPHIC_3D:
+            return geode::GeographicCoordinateSystemType::geographic_3d;
+        case OSR_CRS_TYPE_GEOCENTRIC:
+            return geode::GeographicCoordinateSystemType::geocentric;
+        case OSR_CRS_TYPE_PROJECTED:
+            return geode::GeographicCoordinateSystemType::projected;
+        case OSR_CRS_TYPE_VERTICAL:
+            return geode::GeographicCoordinateSystemType::vertical;
+        case OSR_CRS_TYPE_COMPOUND:
+            return geode::GeographicCoordinateSystemType::compound;
+        default:
+            return geode::GeographicCoordinateSystemType::other;
+        }
+    }
+
+    class GeographicCoordinateSystemCatalogue
+    {
+    public:
+        static const GeographicCoordinateSystemCatalogue& instance()
+        {
+            static const GeographicCoordinateSystemCatalogue catalogue;
+            return catalogue;
+        }
+
+        absl::Span< const geode::GeographicCoordinateSystemInfo > infos() const
+        {
+            return infos_;
+        }
+
+        std::optional< geode::index_t > find(
+            std::string_view authority_code ) const
+        {
+            const auto it = entries_.find( authority_code );
+            if( it == entries_.end() )
+            {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+        geode::GeographicCoordinateSystemType type( geode::index_t entry ) const
+        {
+            return types_[entry];
+        }
+
+        std::vector< geode::GeographicCoordinateSystemInfo > with_name_prefix(
+            std::string_view prefix,
+            std::optional< geode::GeographicCoordinateSystemType > type ) const
+        {
+            const auto lower_prefix = absl::AsciiStrToLower( prefix );
+            auto it = absl::c_lower_bound( sorted_by_name_, lower_prefix,
+                [this]( geode::index_t entry, const std::string& value ) {
+                    return lower_names_[entry] < value;
+                } );
+            std::vector< geode::GeographicCoordinateSystemInfo > result;
+            for( ; it != sorted_by_name_.end()
+                   && absl::StartsWith( lower_names_[*it], lower_prefix );
+                 ++it )
+            {
+                if( !type || types_[*it] == type.value() )
+                {
+                    result.push_back( infos_[*it] );
+                }
+            }
+            return result;
+        }
+
+        std::vector< geode::GeographicCoordinateSystemInfo >
+            with_name_containing( std::string_view text,
+                std::optional< geode::GeographicCoordinateSystemType > type )
+                const
+        {
+            const auto lower_text = absl::AsciiStrToLower( text );
+            std::vector< geode::GeographicCoordinateSystemInfo > result;
+            for( const auto entry : geode::Range{ infos_.size() } )
+            {
+                if( ( !type || types_[entry] == type.value() )
+                    && absl::StrContains( lower_names_[entry], lower_text ) )
+                {
+                    result.push_back( infos_[entry] );
+                }
+            }
+            return result;
+        }
+
+        std::vector< geode::GeographicCoordinateSystemInfo > of_type(
+            geode::GeographicCoordinateSystemType type ) const
+        {
+            std::vector< geode::GeographicCoordinateSystemInfo > result;
+            for( const auto entry : geode::Range{ infos_.size() } )
+            {
+                if( types_[entry] == type )
+                {
+                    result.push_back( infos_[entry] );
+                }
+            }
+            return result;
+        }
+
+    private:
+        GeographicCoordinateSystemCatalogue()
+        {
+            int nb_crs{ 0 };
+            auto** gdal_list =
+                OSRGetCRSInfoListFromDatabase( nullptr, nullptr, &nb_crs );
+            infos_.reserve( nb_crs );
+            types_.reserve( nb_crs );
+            lower_names_.reserve( nb_crs );
+            entries_.reserve( nb_crs );
+            for( const auto i : geode::Range{ nb_crs } )
+            {
+                const auto* gdal_crs = gdal_list[i];
+                const auto& info = infos_.emplace_back( gdal_crs->pszAuthName,
+                    gdal_crs->pszCode, gdal_crs->pszName );
+                types_.push_back( to_type( gdal_crs->eType ) );
+                lower_names_.push_back( absl::AsciiStrToLower( info.name ) );
+                entries_.try_emplace( info.authority_code(), i );
+            }
+            OSRDestroyCRSInfoList( gdal_list );
+            sorted_by_name_.resize( infos_.size() );
+            for( const auto entry : geode::Range{ infos_.size() } )
+            {
+                sorted_by_name_[entry] = entry;
+            }
+            absl::c_stable_sort( sorted_by_name_,
+                [this]( geode::index_t lhs, geode::index_t rhs ) {
+                    return lower_names_[lhs] < lower_names_[rhs];
+                } );
+        }
+
+    private:
+        std::vector< geode::GeographicCoordinateSystemInfo > infos_;
+        std::vector< geode::GeographicCoordinateSystemType > types_;
+        std::vector< std::string > lower_names_;
+        std::vector< geode::index_t > sorted_by_name_;
+        absl::flat_hash_map< std::string, geode::index_t > entries_;
+    };
+} // namespace
+
+namespace geode
+{
+    absl::Span< const GeographicCoordinateSystemInfo >
+        geographic_coordinate_system_catalogue()
+    {
+        return GeographicCoordinateSystemCatalogue::instance().infos();
+    }
+
+    std::optional< GeographicCoordinateSystemInfo >
+        find_geographic_coordinate_system( std::string_view authority_code )
+    {
+        const auto& catalogue = GeographicCoordinateSystemCatalogue::instance();
+        if( const auto entry = catalogue.find( authority_code ) )
+        {
+            return catalogue.infos()[entry.value()];
+        }
+        return std::nullopt;
+    }
+
+    bool is_geographic_coordinate_system_known(
+        std::string_view authority_code )
+    {
+        return GeographicCoordinateSystemCatalogue::instance()
+            .find( authority_code )
+            .has_value();
+    }
+
+    std::optional< GeographicCoordinateSystemType >
+        geographic_coordinate_system_type( std::string_view authority_code )
+    {
+        const auto& catalogue = GeographicCoordinateSystemCatalogue::instance();
+        if( const auto entry = catalogue.find( authority_code ) )
+        {
+            return catalogue.type( entry.value() );
+        }
+        return std::nullopt;
+    }
+
+    std::vector< GeographicCoordinateSystemInfo >
+        geographic_coordinate_systems_with_name_prefix( std::string_view prefix,
+            std::optional< GeographicCoordinateSystemType > type )
+    {
+        return GeographicCoordinateSystemCatalogue::instance().with_name_prefix(
+            prefix, type );
+    }
+
+    std::vector< GeographicCoordinateSystemInfo >
+        geographic_coordinate_systems_with_name_containing(
+            std::string_view text,
+            std::optional< GeographicCoordinateSystemType > type )
+    {
+        return GeographicCoordinateSystemCatalogue::instance()
+            .with_name_containing( text, type );
+    }
+
+    std::vector< GeographicCoordinateSystemInfo >
+        geographic_coordinate_systems_of_type(
+            GeographicCoordinateSystemType type )
+    {
+        return GeographicCoordinateSystemCatalogue::instance().of_type( type );
+    }
+} // namespace geode
@@ -23,6 +23,13 @@
 
 #include <geode/geosciences/explicit/geometry/geographic_coordinate_system_helper.hpp>
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.hpp>
 
 #include <geode/mesh/builder/coordinate_reference_system_manager_builder.hpp>
@@ -48,6 +55,28 @@
 
 namespace
 {
+    /*!
+     * Mesh builders are fetched sequentially since the model builder is not
+     * thread safe, then each component mesh is processed in parallel.
+     */
+    template < typename Range, typename GetMeshBuilder, typename Task >
+    void parallel_components_task(
+        Range range, GetMeshBuilder get_mesh_builder, Task task )
+    {
+        using Component = std::remove_reference_t< decltype( *range.begin() ) >;
+        using MeshBuilder = decltype( get_mesh_builder(
+            std::declval< const Component& >() ) );
+        std::vector< std::pair< const Component*, MeshBuilder > > components;
+        for( const auto& component : range )
+        {
+            components.emplace_back(
+                &component, get_mesh_builder( component ) );
+        }
+        async::parallel_for( components, [&task]( auto& component ) {
+            task( component.first->mesh(), *component.second );
+        } );
+    }
+
     template < typename Mesh >
     void convert_coordinate_reference_system( const Mesh& mesh,
         typename Mesh::Builder& builder,
@@ -91,13 +120,11 @@ namespace
         Range range,
         GetMeshBuilder get_mesh_builder )
     {
-        for( const auto& component : range )
-        {
-            const auto& mesh = component.mesh();
-            auto builder = get_mesh_builder( component );
-            convert_coordinate_reference_system(
-                mesh, *builder, crs_name, info );
-        }
+        parallel_components_task( range, get_mesh_builder,
+            [&info, crs_name]( const auto& mesh, auto& builder ) {
+                convert_coordinate_reference_system(
+                    mesh, builder, crs_name, info );
+            } );
     }
 
     template < typename Mesh >
@@ -139,13 +166,11 @@ namespace
         Range range,
         GetMeshBuilder get_mesh_builder )
     {
-        for( const auto& component : range )
-        {
-            const auto& mesh = component.mesh();
-            auto builder = get_mesh_builder( component );
-            convert_attribute_to_geographic_coordinate_reference_system(
-                mesh, *builder, crs_name, info );
-        }
+        parallel_components_task( range, get_mesh_builder,
+            [&info, crs_name]( const auto& mesh, auto& builder ) {
+                convert_attribute_to_geographic_coordinate_reference_system(
+                    mesh, builder, crs_name, info );
+            } );
     }
 } // namespace
 
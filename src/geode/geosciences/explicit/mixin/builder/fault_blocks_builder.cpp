@@ -63,11 +63,8 @@ namespace geode
     void FaultBlocksBuilder< dimension >::set_fault_block_name(
         const FaultBlock< dimension >& fault_block, std::string_view name )
     {
-        fault_blocks_
-            .modifiable_fault_block( fault_block.id(),
-                typename FaultBlock< dimension >::FaultBlocksBuilderKey{} )
-            .set_fault_block_name( name,
-                typename FaultBlock< dimension >::FaultBlocksBuilderKey{} );
+        fault_blocks_.set_fault_block_name( fault_block.id(), name,
+            typename FaultBlock< dimension >::FaultBlocksBuilderKey{} );
     }
 
     template class opengeode_geosciences_explicit_api FaultBlocksBuilder< 2 >;
@@ -88,11 +88,8 @@ namespace geode
     void FaultsBuilder< dimension >::set_fault_name(
         const Fault< dimension >& fault, std::string_view name )
     {
-        faults_
-            .modifiable_fault(
-                fault.id(), typename Fault< dimension >::FaultsBuilderKey{} )
-            .set_fault_name(
-                name, typename Fault< dimension >::FaultsBuilderKey{} );
+        faults_.set_fault_name( fault.id(), name,
+            typename Fault< dimension >::FaultsBuilderKey{} );
     }
 
     template class opengeode_geosciences_explicit_api FaultsBuilder< 2 >;
@@ -89,11 +89,8 @@ namespace geode
     void HorizonsBuilder< dimension >::set_horizon_name(
         const Horizon< dimension >& horizon, std::string_view name )
     {
-        horizons_
-            .modifiable_horizon( horizon.id(),
-                typename Horizon< dimension >::HorizonsBuilderKey{} )
-            .set_horizon_name(
-                name, typename Horizon< dimension >::HorizonsBuilderKey{} );
+        horizons_.set_horizon_name( horizon.id(), name,
+            typename Horizon< dimension >::HorizonsBuilderKey{} );
     }
 
     template class opengeode_geosciences_explicit_api HorizonsBuilder< 2 >;
@@ -69,13 +69,10 @@ namespace geode
         const StratigraphicUnit< dimension >& stratigraphic_unit,
         std::string_view name )
     {
-        stratigraphic_units_
-            .modifiable_stratigraphic_unit( stratigraphic_unit.id(),
-                typename StratigraphicUnit<
-                    dimension >::StratigraphicUnitsBuilderKey{} )
-            .set_stratigraphic_unit_name(
-                name, typename StratigraphicUnit<
-                          dimension >::StratigraphicUnitsBuilderKey{} );
+        stratigraphic_units_.set_stratigraphic_unit_name(
+            stratigraphic_unit.id(), name,
+            typename StratigraphicUnit<
+                dimension >::StratigraphicUnitsBuilderKey{} );
     }
 
     template class opengeode_geosciences_explicit_api
@@ -30,6 +30,7 @@
 
 #include <geode/model/mixin/core/detail/components_storage.hpp>
 
+#include <geode/geosciences/explicit/mixin/core/detail/component_name_index.hpp>
 #include <geode/geosciences/explicit/mixin/core/fault.hpp>
 
 namespace geode
@@ -38,6 +39,19 @@ namespace geode
     class FaultBlocks< dimension >::Impl
         : public detail::ComponentsStorage< FaultBlock< dimension > >
     {
+    public:
+        const detail::ComponentNameIndex& name_index() const
+        {
+            return name_index_;
+        }
+
+        detail::ComponentNameIndex& modifiable_name_index()
+        {
+            return name_index_;
+        }
+
+    private:
+        detail::ComponentNameIndex name_index_;
     };
 
     template < index_t dimension >
@@ -85,6 +99,32 @@ namespace geode
         return impl_->component( id );
     }
 
+    template < index_t dimension >
+    void FaultBlocks< dimension >::set_fault_block_name( const uuid& id,
+        std::string_view name,
+        FaultBlocksBuilderKey /*unused*/ )
+    {
+        auto& fault_block = impl_->component( id );
+        impl_->modifiable_name_index().rename( fault_block, name );
+        fault_block.set_fault_block_name(
+            name, typename FaultBlock< dimension >::FaultBlocksKey{} );
+    }
+
+    template < index_t dimension >
+    std::optional< uuid > FaultBlocks< dimension >::fault_block_id_from_name(
+        std::string_view name ) const
+    {
+        return impl_->name_index().find( name );
+    }
+
+    template < index_t dimension >
+    std::vector< std::optional< uuid > >
+        FaultBlocks< dimension >::fault_block_ids_from_names(
+            absl::Span< const std::string > names ) const
+    {
+        return impl_->name_index().find( names );
+    }
+
     template < index_t dimension >
     void FaultBlocks< dimension >::save_fault_blocks(
         std::string_view directory ) const
@@ -97,6 +137,7 @@ namespace geode
         std::string_view directory, FaultBlocksBuilderKey /*unused*/ )
     {
         impl_->load_components( absl::StrCat( directory, "/fault_blocks" ) );
+        impl_->modifiable_name_index().build( fault_blocks() );
     }
 
     template < index_t dimension >
@@ -151,6 +192,7 @@ namespace geode
         const FaultBlock< dimension >& fault_block,
         FaultBlocksBuilderKey /*unused*/ )
     {
+        impl_->modifiable_name_index().remove( fault_block );
         impl_->delete_component( fault_block.id() );
     }
 
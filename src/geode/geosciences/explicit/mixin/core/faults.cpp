@@ -30,6 +30,7 @@
 
 #include <geode/model/mixin/core/detail/components_storage.hpp>
 
+#include <geode/geosciences/explicit/mixin/core/detail/component_name_index.hpp>
 #include <geode/geosciences/explicit/mixin/core/fault.hpp>
 
 namespace geode
@@ -38,6 +39,19 @@ namespace geode
     class Faults< dimension >::Impl
         : public detail::ComponentsStorage< Fault< dimension > >
     {
+    public:
+        const detail::ComponentNameIndex& name_index() const
+        {
+            return name_index_;
+        }
+
+        detail::ComponentNameIndex& modifiable_name_index()
+        {
+            return name_index_;
+        }
+
+    private:
+        detail::ComponentNameIndex name_index_;
     };
 
     template < index_t dimension >
@@ -84,6 +98,31 @@ namespace geode
         return impl_->component( id );
     }
 
+    template < index_t dimension >
+    void Faults< dimension >::set_fault_name( const uuid& id,
+        std::string_view name,
+        FaultsBuilderKey /*unused*/ )
+    {
+        auto& fault = impl_->component( id );
+        impl_->modifiable_name_index().rename( fault, name );
+        fault.set_fault_name( name, typename Fault< dimension >::FaultsKey{} );
+    }
+
+    template < index_t dimension >
+    std::optional< uuid > Faults< dimension >::fault_id_from_name(
+        std::string_view name ) const
+    {
+        return impl_->name_index().find( name );
+    }
+
+    template < index_t dimension >
+    std::vector< std::optional< uuid > >
+        Faults< dimension >::fault_ids_from_names(
+            absl::Span< const std::string > names ) const
+    {
+        return impl_->name_index().find( names );
+    }
+
     template < index_t dimension >
     void Faults< dimension >::save_faults( std::string_view directory ) const
     {
@@ -95,6 +134,7 @@ namespace geode
         std::string_view directory, FaultsBuilderKey /*unused*/ )
     {
         impl_->load_components( absl::StrCat( directory, "/faults" ) );
+        impl_->modifiable_name_index().build( faults() );
     }
 
     template < index_t dimension >
@@ -171,6 +211,7 @@ namespace geode
     void Faults< dimension >::delete_fault(
         const Fault< dimension >& fault, FaultsBuilderKey /*unused*/ )
     {
+        impl_->modifiable_name_index().remove( fault );
         impl_->delete_component( fault.id() );
     }
 
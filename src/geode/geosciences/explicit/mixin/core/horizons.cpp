@@ -30,6 +30,7 @@
 
 #include <geode/model/mixin/core/detail/components_storage.hpp>
 
+#include <geode/geosciences/explicit/mixin/core/detail/component_name_index.hpp>
 #include <geode/geosciences/explicit/mixin/core/horizon.hpp>
 
 namespace geode
@@ -38,6 +39,19 @@ namespace geode
     class Horizons< dimension >::Impl
         : public detail::ComponentsStorage< Horizon< dimension > >
     {
+    public:
+        const detail::ComponentNameIndex& name_index() const
+        {
+            return name_index_;
+        }
+
+        detail::ComponentNameIndex& modifiable_name_index()
+        {
+            return name_index_;
+        }
+
+    private:
+        detail::ComponentNameIndex name_index_;
     };
 
     template < index_t dimension >
@@ -85,6 +99,32 @@ namespace geode
         return impl_->component( id );
     }
 
+    template < index_t dimension >
+    void Horizons< dimension >::set_horizon_name( const uuid& id,
+        std::string_view name,
+        HorizonsBuilderKey /*unused*/ )
+    {
+        auto& horizon = impl_->component( id );
+        impl_->modifiable_name_index().rename( horizon, name );
+        horizon.set_horizon_name(
+            name, typename Horizon< dimension >::HorizonsKey{} );
+    }
+
+    template < index_t dimension >
+    std::optional< uuid > Horizons< dimension >::horizon_id_from_name(
+        std::string_view name ) const
+    {
+        return impl_->name_index().find( name );
+    }
+
+    template < index_t dimension >
+    std::vector< std::optional< uuid > >
+        Horizons< dimension >::horizon_ids_from_names(
+            absl::Span< const std::string > names ) const
+    {
+        return impl_->name_index().find( names );
+    }
+
     template < index_t dimension >
     void Horizons< dimension >::save_horizons(
         std::string_view directory ) const
@@ -97,6 +137,7 @@ namespace geode
         std::string_view directory, HorizonsBuilderKey /*unused*/ )
     {
         impl_->load_components( absl::StrCat( directory, "/horizons" ) );
+        impl_->modifiable_name_index().build( horizons() );
     }
 
     template < index_t dimension >
@@ -175,6 +216,7 @@ namespace geode
     void Horizons< dimension >::delete_horizon(
         const Horizon< dimension >& horizon, HorizonsBuilderKey /*unused*/ )
     {
+        impl_->modifiable_name_index().remove( horizon );
         impl_->delete_component( horizon.id() );
     }
 
@@ -30,6 +30,7 @@
 
 #include <geode/model/mixin/core/detail/components_storage.hpp>
 
+#include <geode/geosciences/explicit/mixin/core/detail/component_name_index.hpp>
 #include <geode/geosciences/explicit/mixin/core/fault.hpp>
 
 namespace geode
@@ -38,6 +39,19 @@ namespace geode
     class StratigraphicUnits< dimension >::Impl
         : public detail::ComponentsStorage< StratigraphicUnit< dimension > >
     {
+    public:
+        const detail::ComponentNameIndex& name_index() const
+        {
+            return name_index_;
+        }
+
+        detail::ComponentNameIndex& modifiable_name_index()
+        {
+            return name_index_;
+        }
+
+    private:
+        detail::ComponentNameIndex name_index_;
     };
 
     template < index_t dimension >
@@ -90,6 +104,34 @@ namespace geode
         return impl_->component( id );
     }
 
+    template < index_t dimension >
+    void StratigraphicUnits< dimension >::set_stratigraphic_unit_name(
+        const uuid& id,
+        std::string_view name,
+        StratigraphicUnitsBuilderKey /*unused*/ )
+    {
+        auto& stratigraphic_unit = impl_->component( id );
+        impl_->modifiable_name_index().rename( stratigraphic_unit, name );
+        stratigraphic_unit.set_stratigraphic_unit_name( name,
+            typename StratigraphicUnit< dimension >::StratigraphicUnitsKey{} );
+    }
+
+    template < index_t dimension >
+    std::optional< uuid >
+        StratigraphicUnits< dimension >::stratigraphic_unit_id_from_name(
+            std::string_view name ) const
+    {
+        return impl_->name_index().find( name );
+    }
+
+    template < index_t dimension >
+    std::vector< std::optional< uuid > >
+        StratigraphicUnits< dimension >::stratigraphic_unit_ids_from_names(
+            absl::Span< const std::string > names ) const
+    {
+        return impl_->name_index().find( names );
+    }
+
     template < index_t dimension >
     void StratigraphicUnits< dimension >::save_stratigraphic_units(
         std::string_view directory ) const
@@ -104,6 +146,7 @@ namespace geode
     {
         impl_->load_components(
             absl::StrCat( directory, "/stratigraphic_units" ) );
+        impl_->modifiable_name_index().build( stratigraphic_units() );
     }
 
     template < index_t dimension >
@@ -161,6 +204,7 @@ namespace geode
         const StratigraphicUnit< dimension >& stratigraphic_unit,
         StratigraphicUnitsBuilderKey /*unused*/ )
     {
+        impl_->modifiable_name_index().remove( stratigraphic_unit );
         impl_->delete_component( stratigraphic_unit.id() );
     }
 
@@ -33,6 +33,7 @@
 #include <geode/geosciences/explicit/mixin/core/fault_block.hpp>
 #include <geode/geosciences/explicit/mixin/core/horizon.hpp>
 #include <geode/geosciences/explicit/mixin/core/stratigraphic_unit.hpp>
+#include <geode/geosciences/explicit/representation/builder/detail/collection_items.hpp>
 #include <geode/geosciences/explicit/representation/builder/detail/copy.hpp>
 #include <geode/geosciences/explicit/representation/core/cross_section.hpp>
 
@@ -112,6 +113,13 @@ namespace geode
             line.component_id(), fault.component_id() );
     }
 
+    void CrossSectionBuilder::add_lines_in_fault(
+        absl::Span< const uuid > line_ids, const Fault2D& fault )
+    {
+        detail::add_items_in_collection< Line2D >(
+            cross_section_, *this, line_ids, fault.component_id() );
+    }
+
     void CrossSectionBuilder::remove_fault( const Fault2D& fault )
     {
         detail::remove_collection_component( *this, fault );
@@ -155,6 +163,13 @@ namespace geode
             line.component_id(), horizon.component_id() );
     }
 
+    void CrossSectionBuilder::add_lines_in_horizon(
+        absl::Span< const uuid > line_ids, const Horizon2D& horizon )
+    {
+        detail::add_items_in_collection< Line2D >(
+            cross_section_, *this, line_ids, horizon.component_id() );
+    }
+
     void CrossSectionBuilder::remove_horizon( const Horizon2D& horizon )
     {
         detail::remove_collection_component( *this, horizon );
@@ -183,6 +198,13 @@ namespace geode
             surface.component_id(), fault_block.component_id() );
     }
 
+    void CrossSectionBuilder::add_surfaces_in_fault_block(
+        absl::Span< const uuid > surface_ids, const FaultBlock2D& fault_block )
+    {
+        detail::add_items_in_collection< Surface2D >(
+            cross_section_, *this, surface_ids, fault_block.component_id() );
+    }
+
     void CrossSectionBuilder::remove_fault_block(
         const FaultBlock2D& fault_block )
     {
@@ -214,6 +236,14 @@ namespace geode
             surface.component_id(), stratigraphic_unit.component_id() );
     }
 
+    void CrossSectionBuilder::add_surfaces_in_stratigraphic_unit(
+        absl::Span< const uuid > surface_ids,
+        const StratigraphicUnit2D& stratigraphic_unit )
+    {
+        detail::add_items_in_collection< Surface2D >( cross_section_, *this,
+            surface_ids, stratigraphic_unit.component_id() );
+    }
+
     void CrossSectionBuilder::remove_stratigraphic_unit(
         const StratigraphicUnit2D& stratigraphic_unit )
     {
@@ -25,6 +25,7 @@
 #include <geode/geosciences/explicit/representation/builder/structural_model_builder.hpp>
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
 #include <queue>
+#include <vector>
 
 namespace
 {
@@ -32,30 +33,27 @@ namespace
         const geode::StructuralModel& structural_model,
         const geode::Surface3D& surface )
     {
-        for( const auto& fault : structural_model.faults() )
+        const auto faults =
+            structural_model.fault_index().collections( surface.id() );
+        if( faults.empty() )
         {
-            for( const auto& fault_surface :
-                structural_model.fault_items( fault ) )
-            {
-                if( fault_surface.id() == surface.id() )
-                {
-                    return fault.id();
-                }
-            }
+            return std::nullopt;
         }
-        return std::nullopt;
+        return faults.front();
     }
 
     void add_all_blocks_to_single_fault_block(
         const geode::StructuralModel& structural_model,
         geode::StructuralModelBuilder& builder )
     {
-        const auto& fault_block =
-            structural_model.fault_block( builder.add_fault_block() );
+        std::vector< geode::uuid > block_ids;
+        block_ids.reserve( structural_model.nb_blocks() );
         for( const auto& block : structural_model.blocks() )
         {
-            builder.add_block_in_fault_block( block, fault_block );
+            block_ids.push_back( block.id() );
         }
+        builder.add_blocks_in_fault_block( block_ids,
+            structural_model.fault_block( builder.add_fault_block() ) );
     }
 
     void add_incident_blocks_to_queue(
@@ -75,11 +73,11 @@ namespace
         }
     }
 
-    void build_fault_blocks( const geode::StructuralModel& structural_model,
-        geode::StructuralModelBuilder& builder )
+    std::vector< std::vector< geode::uuid > > fault_blocks_block_ids(
+        const geode::StructuralModel& structural_model )
     {
+        std::vector< std::vector< geode::uuid > > fault_blocks;
         std::vector< geode::uuid > visited;
-        std::vector< geode::uuid > treated_faults;
         for( const auto& block : structural_model.blocks() )
         {
             std::queue< geode::uuid > block_queue;
@@ -90,17 +88,14 @@ namespace
             }
             block_queue.push( block_id );
             visited.push_back( block_id );
-            const auto& fault_block =
-                structural_model.fault_block( builder.add_fault_block() );
+            auto& block_ids = fault_blocks.emplace_back();
             while( !block_queue.empty() )
             {
                 const auto current_block_id = block_queue.front();
                 block_queue.pop();
-                const auto& curent_block =
-                    structural_model.block( current_block_id );
-                builder.add_block_in_fault_block( curent_block, fault_block );
-                for( const auto& boundary :
-                    structural_model.boundaries( curent_block ) )
+                block_ids.push_back( current_block_id );
+                for( const auto& boundary : structural_model.boundaries(
+                         structural_model.block( current_block_id ) ) )
                 {
                     const auto fault_id =
                         is_fault( structural_model, boundary );
@@ -112,6 +107,18 @@ namespace
                 }
             }
         }
+        return fault_blocks;
+    }
+
+    void build_fault_blocks( const geode::StructuralModel& structural_model,
+        geode::StructuralModelBuilder& builder )
+    {
+        for( const auto& block_ids :
+            fault_blocks_block_ids( structural_model ) )
+        {
+            builder.add_blocks_in_fault_block( block_ids,
+                structural_model.fault_block( builder.add_fault_block() ) );
+        }
     }
 
 } // namespace
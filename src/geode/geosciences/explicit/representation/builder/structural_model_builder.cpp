@@ -29,6 +29,7 @@
 #include <geode/model/representation/builder/detail/copy.hpp>
 #include <geode/model/representation/builder/detail/register.hpp>
 
+#include <geode/geosciences/explicit/representation/builder/detail/collection_items.hpp>
 #include <geode/geosciences/explicit/representation/builder/detail/copy.hpp>
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
 
@@ -111,6 +112,13 @@ namespace geode
             surface.component_id(), fault.component_id() );
     }
 
+    void StructuralModelBuilder::add_surfaces_in_fault(
+        absl::Span< const uuid > surface_ids, const Fault3D& fault )
+    {
+        detail::add_items_in_collection< Surface3D >(
+            structural_model_, *this, surface_ids, fault.component_id() );
+    }
+
     void StructuralModelBuilder::remove_fault( const Fault3D& fault )
     {
         detail::remove_collection_component( *this, fault );
@@ -156,6 +164,13 @@ namespace geode
             surface.component_id(), horizon.component_id() );
     }
 
+    void StructuralModelBuilder::add_surfaces_in_horizon(
+        absl::Span< const uuid > surface_ids, const Horizon3D& horizon )
+    {
+        detail::add_items_in_collection< Surface3D >(
+            structural_model_, *this, surface_ids, horizon.component_id() );
+    }
+
     void StructuralModelBuilder::remove_horizon( const Horizon3D& horizon )
     {
         detail::remove_collection_component( *this, horizon );
@@ -184,6 +199,13 @@ namespace geode
             block.component_id(), fault_block.component_id() );
     }
 
+    void StructuralModelBuilder::add_blocks_in_fault_block(
+        absl::Span< const uuid > block_ids, const FaultBlock3D& fault_block )
+    {
+        detail::add_items_in_collection< Block3D >(
+            structural_model_, *this, block_ids, fault_block.component_id() );
+    }
+
     void StructuralModelBuilder::remove_fault_block(
         const FaultBlock3D& fault_block )
     {
@@ -213,6 +235,14 @@ namespace geode
             block.component_id(), stratigraphic_unit.component_id() );
     }
 
+    void StructuralModelBuilder::add_blocks_in_stratigraphic_unit(
+        absl::Span< const uuid > block_ids,
+        const StratigraphicUnit3D& stratigraphic_unit )
+    {
+        detail::add_items_in_collection< Block3D >( structural_model_, *this,
+            block_ids, stratigraphic_unit.component_id() );
+    }
+
     void StructuralModelBuilder::remove_stratigraphic_unit(
         const StratigraphicUnit3D& stratigraphic_unit )
     {
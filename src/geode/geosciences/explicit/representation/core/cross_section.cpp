@@ -23,15 +23,23 @@
 
 #include <geode/geosciences/explicit/representation/core/cross_section.hpp>
 
+#include <geode/basic/pimpl_impl.hpp>
+
 #include <geode/model/representation/core/detail/clone.hpp>
 #include <geode/model/representation/core/detail/model_component.hpp>
 
 #include <geode/geosciences/explicit/representation/builder/cross_section_builder.hpp>
 #include <geode/geosciences/explicit/representation/core/detail/clone.hpp>
+#include <geode/geosciences/explicit/representation/core/detail/geological_collection_indexes.hpp>
 #include <geode/geosciences/explicit/representation/core/detail/helpers.hpp>
 
 namespace geode
 {
+    class CrossSection::Impl
+        : public detail::GeologicalCollectionIndexes< CrossSection >
+    {
+    };
+
     CrossSection::HorizonItemRange::HorizonItemRange(
         const CrossSection& cross_section, const Horizon2D& horizon )
         : Relationships::ItemRangeIterator( cross_section, horizon.id() ),
@@ -191,6 +199,12 @@ namespace geode
         return { *this, stratigraphic_unit };
     }
 
+    CrossSection::CrossSection() = default;
+
+    CrossSection::CrossSection( CrossSection&& ) noexcept = default;
+
+    CrossSection::~CrossSection() = default;
+
     CrossSection::CrossSection( BITSERY bitsery ) : Section{ bitsery } {}
 
     CrossSection::CrossSection( Section&& section ) noexcept
@@ -226,4 +240,25 @@ namespace geode
         clone_builder.copy_relationships( mappings, *this );
         return model_clone;
     }
+
+    const GeologicalCollectionIndex& CrossSection::fault_index() const
+    {
+        return impl_->fault_index( *this );
+    }
+
+    const GeologicalCollectionIndex& CrossSection::horizon_index() const
+    {
+        return impl_->horizon_index( *this );
+    }
+
+    const GeologicalCollectionIndex& CrossSection::fault_block_index() const
+    {
+        return impl_->fault_block_index( *this );
+    }
+
+    const GeologicalCollectionIndex&
+        CrossSection::stratigraphic_unit_index() const
+    {
+        return impl_->stratigraphic_unit_index( *this );
+    }
 } // namespace geode
\ No newline at end of file
@@ -44,6 +44,8 @@ namespace
         {
             const auto& horizon = modified_model.horizon(
                 horizon_mapping.in2out( initial_horizon.id() ) );
+            std::vector< geode::uuid > line_ids;
+            line_ids.reserve( initial_model.nb_items( initial_horizon.id() ) );
             for( const auto& initial_line_in_horizon :
                 initial_model.horizon_items( initial_horizon ) )
             {
@@ -55,10 +57,10 @@ namespace
                 for( const auto& line_id :
                     lines_mapping.in2out( initial_line_in_horizon.id() ) )
                 {
-                    builder.add_line_in_horizon(
-                        modified_model.line( line_id ), horizon );
+                    line_ids.push_back( line_id );
                 }
             }
+            builder.add_lines_in_horizon( line_ids, horizon );
         }
     }
     void copy_horizon_item_relations(
@@ -72,6 +74,9 @@ namespace
         {
             const auto& horizon = modified_model.horizon(
                 horizon_mapping.in2out( initial_horizon.id() ) );
+            std::vector< geode::uuid > surface_ids;
+            surface_ids.reserve(
+                initial_model.nb_items( initial_horizon.id() ) );
             for( const auto& initial_surface_in_horizon :
                 initial_model.horizon_items( initial_horizon ) )
             {
@@ -83,10 +88,10 @@ namespace
                 for( const auto& surface_id :
                     surfaces_mapping.in2out( initial_surface_in_horizon.id() ) )
                 {
-                    builder.add_surface_in_horizon(
-                        modified_model.surface( surface_id ), horizon );
+                    surface_ids.push_back( surface_id );
                 }
             }
+            builder.add_surfaces_in_horizon( surface_ids, horizon );
         }
     }
 
@@ -100,6 +105,8 @@ namespace
         {
             const auto& fault = modified_model.fault(
                 fault_mapping.in2out( initial_fault.id() ) );
+            std::vector< geode::uuid > line_ids;
+            line_ids.reserve( initial_model.nb_items( initial_fault.id() ) );
             for( const auto& initial_line_in_fault :
                 initial_model.fault_items( initial_fault ) )
             {
@@ -111,10 +118,10 @@ namespace
                 for( const auto& line_id :
                     lines_mapping.in2out( initial_line_in_fault.id() ) )
                 {
-                    builder.add_line_in_fault(
-                        modified_model.line( line_id ), fault );
+                    line_ids.push_back( line_id );
                 }
             }
+            builder.add_lines_in_fault( line_ids, fault );
         }
     }
 
@@ -128,6 +135,8 @@ namespace
         {
             const auto& fault = modified_model.fault(
                 fault_mapping.in2out( initial_fault.id() ) );
+            std::vector< geode::uuid > surface_ids;
+            surface_ids.reserve( initial_model.nb_items( initial_fault.id() ) );
             for( const auto& initial_surface_in_fault :
                 initial_model.fault_items( initial_fault ) )
             {
@@ -139,10 +148,10 @@ namespace
                 for( const auto& surface_id :
                     surfaces_mapping.in2out( initial_surface_in_fault.id() ) )
                 {
-                    builder.add_surface_in_fault(
-                        modified_model.surface( surface_id ), fault );
+                    surface_ids.push_back( surface_id );
                 }
             }
+            builder.add_surfaces_in_fault( surface_ids, fault );
         }
     }
 
@@ -160,6 +169,9 @@ namespace
             const auto& stratigraphic_unit = modified_model.stratigraphic_unit(
                 stratigraphic_unit_mapping.in2out(
                     initial_stratigraphic_unit.id() ) );
+            std::vector< geode::uuid > surface_ids;
+            surface_ids.reserve(
+                initial_model.nb_items( initial_stratigraphic_unit.id() ) );
             for( const auto& initial_surface_in_stratigraphic_unit :
                 initial_model.stratigraphic_unit_items(
                     initial_stratigraphic_unit ) )
@@ -172,11 +184,11 @@ namespace
                 for( const auto& surface_id : surfaces_mapping.in2out(
                          initial_surface_in_stratigraphic_unit.id() ) )
                 {
-                    builder.add_surface_in_stratigraphic_unit(
-                        modified_model.surface( surface_id ),
-                        stratigraphic_unit );
+                    surface_ids.push_back( surface_id );
                 }
             }
+            builder.add_surfaces_in_stratigraphic_unit(
+                surface_ids, stratigraphic_unit );
         }
     }
 
@@ -194,6 +206,9 @@ namespace
             const auto& stratigraphic_unit = modified_model.stratigraphic_unit(
                 stratigraphic_unit_mapping.in2out(
                     initial_stratigraphic_unit.id() ) );
+            std::vector< geode::uuid > block_ids;
+            block_ids.reserve(
+                initial_model.nb_items( initial_stratigraphic_unit.id() ) );
             for( const auto& initial_block_in_stratigraphic_unit :
                 initial_model.stratigraphic_unit_items(
                     initial_stratigraphic_unit ) )
@@ -206,10 +221,11 @@ namespace
                 for( const auto& block_id : blocks_mapping.in2out(
                          initial_block_in_stratigraphic_unit.id() ) )
                 {
-                    builder.add_block_in_stratigraphic_unit(
-                        modified_model.block( block_id ), stratigraphic_unit );
+                    block_ids.push_back( block_id );
                 }
             }
+            builder.add_blocks_in_stratigraphic_unit(
+                block_ids, stratigraphic_unit );
         }
     }
 
@@ -224,6 +240,9 @@ namespace
         {
             const auto& fault_block = modified_model.fault_block(
                 fault_block_mapping.in2out( initial_fault_block.id() ) );
+            std::vector< geode::uuid > surface_ids;
+            surface_ids.reserve(
+                initial_model.nb_items( initial_fault_block.id() ) );
             for( const auto& initial_surface_in_fault_block :
                 initial_model.fault_block_items( initial_fault_block ) )
             {
@@ -235,10 +254,10 @@ namespace
                 for( const auto& surface_id : surfaces_mapping.in2out(
                          initial_surface_in_fault_block.id() ) )
                 {
-                    builder.add_surface_in_fault_block(
-                        modified_model.surface( surface_id ), fault_block );
+                    surface_ids.push_back( surface_id );
                 }
             }
+            builder.add_surfaces_in_fault_block( surface_ids, fault_block );
         }
     }
 
@@ -253,6 +272,9 @@ namespace
         {
             const auto& fault_block = modified_model.fault_block(
                 fault_block_mapping.in2out( initial_fault_block.id() ) );
+            std::vector< geode::uuid > block_ids;
+            block_ids.reserve(
+                initial_model.nb_items( initial_fault_block.id() ) );
             for( const auto& initial_block_in_fault_block :
                 initial_model.fault_block_items( initial_fault_block ) )
             {
@@ -264,10 +286,10 @@ namespace
                 for( const auto& block_id :
                     blocks_mapping.in2out( initial_block_in_fault_block.id() ) )
                 {
-                    builder.add_block_in_fault_block(
-                        modified_model.block( block_id ), fault_block );
+                    block_ids.push_back( block_id );
                 }
             }
+            builder.add_blocks_in_fault_block( block_ids, fault_block );
         }
     }
 
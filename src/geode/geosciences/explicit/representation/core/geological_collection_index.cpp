@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/explicit/representation/core/geological_collection_index.hpp>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/model/mixin/core/relationships.hpp>
+
+namespace
+{
+    struct CompressedRows
+    {
+        absl::Span< const geode::uuid > row( const geode::uuid& id ) const
+        {
+            const auto it = rows.find( id );
+            if( it == rows.end() )
+            {
+                return {};
+            }
+            const auto begin = offsets[it->second];
+            return absl::MakeConstSpan( values ).subspan(
+                begin, offsets[it->second + 1] - begin );
+        }
+
+        absl::flat_hash_map< geode::uuid, geode::index_t > rows;
+        std::vector< geode::index_t > offsets;
+        std::vector< geode::uuid > values;
+    };
+
+    CompressedRows compress_rows(
+        absl::Span< const std::pair< geode::uuid, geode::uuid > > pairs )
+    {
+        CompressedRows result;
+        std::vector< geode::index_t > pair_rows;
+        pair_rows.reserve( pairs.size() );
+        for( const auto& pair : pairs )
+        {
+            const auto nb_rows =
+                static_cast< geode::index_t >( result.rows.size() );
+            const auto inserted =
+                result.rows.try_emplace( pair.first, nb_rows );
+            pair_rows.push_back( inserted.first->second );
+        }
+        const auto nb_rows =
+            static_cast< geode::index_t >( result.rows.size() );
+        result.offsets.assign( nb_rows + 1, 0 );
+        for( const auto row : pair_rows )
+        {
+            result.offsets[row + 1]++;
+        }
+        for( const auto row : geode::Range{ nb_rows } )
+        {
+            result.offsets[row + 1] += result.offsets[row];
+        }
+        auto positions = result.offsets;
+        std::vector< geode::index_t > sorted_pairs( pairs.size() );
+        for( const auto p : geode::Indices{ pairs } )
+        {
+            sorted_pairs[positions[pair_rows[p]]++] = p;
+        }
+        result.values.reserve( pairs.size() );
+        for( const auto p : sorted_pairs )
+        {
+            result.values.push_back( pairs[p].second );
+        }
+        return result;
+    }
+} // namespace
+
+namespace geode
+{
+    class GeologicalCollectionIndex::Impl
+    {
+    public:
+        Impl() = default;
+
+        Impl( const Relationships& relationships,
+            absl::Span< const uuid > collection_ids )
+        {
+            std::vector< std::pair< uuid, uuid > > collection_items;
+            for( const auto& collection_id : collection_ids )
+            {
+                collection_items.reserve( collection_items.size()
+                                          + relationships.nb_items(
+                                              collection_id ) );
+                for( const auto& item : relationships.items( collection_id ) )
+                {
+                    collection_items.emplace_back( collection_id, item.id );
+                }
+            }
+            std::vector< std::pair< uuid, uuid > > item_collections;
+            item_collections.reserve( collection_items.size() );
+            for( const auto& [collection_id, item_id] : collection_items )
+            {
+                item_collections.emplace_back( item_id, collection_id );
+            }
+            items_ = compress_rows( collection_items );
+            collections_ = compress_rows( item_collections );
+            nb_collections_ =
+                static_cast< index_t >( collection_ids.size() );
+        }
+
+        index_t nb_collections() const
+        {
+            return nb_collections_;
+        }
+
+        absl::Span< const uuid > items( const uuid& collection_id ) const
+        {
+            return items_.row( collection_id );
+        }
+
+        absl::Span< const uuid > collections( const uuid& item_id ) const
+        {
+            return collections_.row( item_id );
+        }
+
+    private:
+        index_t nb_collections_{ 0 };
+        CompressedRows items_;
+        CompressedRows collections_;
+    };
+
+    GeologicalCollectionIndex::GeologicalCollectionIndex() = default;
+
+    GeologicalCollectionIndex::GeologicalCollectionIndex(
+        const Relationships& relationships,
+        absl::Span< const uuid > collection_ids )
+        : impl_( relationships, collection_ids )
+    {
+    }
+
+    GeologicalCollectionIndex::GeologicalCollectionIndex(
+        GeologicalCollectionIndex&& ) noexcept = default;
+
+    GeologicalCollectionIndex& GeologicalCollectionIndex::operator=(
+        GeologicalCollectionIndex&& ) noexcept = default;
+
+    GeologicalCollectionIndex::~GeologicalCollectionIndex() = default;
+
+    index_t GeologicalCollectionIndex::nb_collections() const
+    {
+        return impl_->nb_collections();
+    }
+
+    absl::Span< const uuid > GeologicalCollectionIndex::items(
+        const uuid& collection_id ) const
+    {
+        return impl_->items( collection_id );
+    }
+
+    absl::Span< const uuid > GeologicalCollectionIndex::collections(
+        const uuid& item_id ) const
+    {
+        return impl_->collections( item_id );
+    }
+} // namespace geode
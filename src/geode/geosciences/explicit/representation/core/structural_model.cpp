@@ -23,15 +23,23 @@
 
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
 
+#include <geode/basic/pimpl_impl.hpp>
+
 #include <geode/model/representation/core/detail/clone.hpp>
 #include <geode/model/representation/core/detail/model_component.hpp>
 
 #include <geode/geosciences/explicit/representation/builder/structural_model_builder.hpp>
 #include <geode/geosciences/explicit/representation/core/detail/clone.hpp>
+#include <geode/geosciences/explicit/representation/core/detail/geological_collection_indexes.hpp>
 #include <geode/geosciences/explicit/representation/core/detail/helpers.hpp>
 
 namespace geode
 {
+    class StructuralModel::Impl
+        : public detail::GeologicalCollectionIndexes< StructuralModel >
+    {
+    };
+
     StructuralModel::HorizonItemRange::HorizonItemRange(
         const StructuralModel& structural_model, const Horizon3D& horizon )
         : Relationships::ItemRangeIterator( structural_model, horizon.id() ),
@@ -197,6 +205,12 @@ namespace geode
         return { *this, stratigraphic_unit };
     }
 
+    StructuralModel::StructuralModel() = default;
+
+    StructuralModel::StructuralModel( StructuralModel&& ) noexcept = default;
+
+    StructuralModel::~StructuralModel() = default;
+
     StructuralModel::StructuralModel( BITSERY bitery ) : BRep{ bitery } {}
 
     StructuralModel::StructuralModel( BRep&& brep ) noexcept
@@ -232,4 +246,25 @@ namespace geode
         clone_builder.copy_relationships( mappings, *this );
         return model_clone;
     }
+
+    const GeologicalCollectionIndex& StructuralModel::fault_index() const
+    {
+        return impl_->fault_index( *this );
+    }
+
+    const GeologicalCollectionIndex& StructuralModel::horizon_index() const
+    {
+        return impl_->horizon_index( *this );
+    }
+
+    const GeologicalCollectionIndex& StructuralModel::fault_block_index() const
+    {
+        return impl_->fault_block_index( *this );
+    }
+
+    const GeologicalCollectionIndex&
+        StructuralModel::stratigraphic_unit_index() const
+    {
+        return impl_->stratigraphic_unit_index( *this );
+    }
 } // namespace geode
\ No newline at end of file
@@ -34,6 +34,7 @@
 #include <geode/model/representation/io/section_output.hpp>
 
 #include <geode/geosciences/explicit/representation/core/cross_section.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 
 namespace geode
 {
@@ -58,6 +59,15 @@ namespace geode
         }
     }
 
+    std::vector< std::string > save_cross_section(
+        const CrossSection& cross_section,
+        std::string_view filename,
+        const GeodeArchiveOptions& archive_options )
+    {
+        return detail::save_geode_archive< CrossSectionOutputFactory >(
+            cross_section, filename, archive_options );
+    }
+
     bool is_cross_section_saveable(
         const CrossSection& cross_section, std::string_view filename )
     {
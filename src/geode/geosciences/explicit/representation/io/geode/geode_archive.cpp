@@ -0,0 +1,576 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/str_cat.h>
+
+#include <async++.h>
+
+#include <mz.h>
+#include <mz_zip.h>
+#include <mz_zip_rw.h>
+
+#include <geode/basic/uuid.hpp>
+#include <geode/basic/zip_file.hpp>
+
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+
+namespace
+{
+    constexpr auto DIRECTORY_ARCHIVE_MARKER = ".geode_archive";
+
+    struct ArchiveFile
+    {
+        std::filesystem::path path;
+        std::string name;
+    };
+
+    void check_zip_status( std::int32_t status,
+        std::string_view action,
+        const std::filesystem::path& filename )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::check_exception(
+            status == MZ_OK, nullptr, geode::OpenGeodeException::TYPE::data,
+            "[GeodeArchive] Cannot ", action, " zip archive ",
+            filename.string(), " (minizip error ", status, ")" );
+    }
+
+    class ZipReader
+    {
+    public:
+        explicit ZipReader( const std::filesystem::path& filename )
+            : handle_( mz_zip_reader_create() ), filename_( filename )
+        {
+            check_zip_status(
+                mz_zip_reader_open_file( handle_, filename_.string().c_str() ),
+                "open", filename_ );
+        }
+
+        ~ZipReader()
+        {
+            mz_zip_reader_delete( &handle_ );
+        }
+
+        void* handle()
+        {
+            return handle_;
+        }
+
+        void goto_first_entry()
+        {
+            check_zip_status( mz_zip_reader_goto_first_entry( handle_ ),
+                "read", filename_ );
+        }
+
+        template < typename Visitor >
+        void visit_entries( Visitor visitor )
+        {
+            auto status = mz_zip_reader_goto_first_entry( handle_ );
+            while( status == MZ_OK )
+            {
+                mz_zip_file* info{ nullptr };
+                check_zip_status(
+                    mz_zip_reader_entry_get_info( handle_, &info ), "read",
+                    filename_ );
+                visitor( *info );
+                status = mz_zip_reader_goto_next_entry( handle_ );
+            }
+            geode::OpenGeodeGeosciencesExplicitException::check_exception(
+                status == MZ_END_OF_LIST, nullptr,
+                geode::OpenGeodeException::TYPE::data,
+                "[GeodeArchive] Cannot read the entries of zip archive ",
+                filename_.string() );
+        }
+
+        std::string read_entry( const mz_zip_file& info )
+        {
+            std::string content(
+                static_cast< std::size_t >( info.uncompressed_size ), '\0' );
+            check_zip_status(
+                mz_zip_reader_entry_open( handle_ ), "read", filename_ );
+            std::size_t nb_read{ 0 };
+            while( nb_read < content.size() )
+            {
+                const auto chunk = static_cast< std::int32_t >(
+                    std::min< std::size_t >( content.size() - nb_read,
+                        std::numeric_limits< std::int32_t >::max() ) );
+                const auto status = mz_zip_reader_entry_read(
+                    handle_, content.data() + nb_read, chunk );
+                geode::OpenGeodeGeosciencesExplicitException::check_exception(
+                    status > 0, nullptr, geode::OpenGeodeException::TYPE::data,
+                    "[GeodeArchive] Cannot read entry ", info.filename,
+                    " of zip archive ", filename_.string() );
+                nb_read += static_cast< std::size_t >( status );
+            }
+            mz_zip_reader_entry_close( handle_ );
+            return content;
+        }
+
+    private:
+        void* handle_;
+        std::filesystem::path filename_;
+    };
+
+    class ZipWriter
+    {
+    public:
+        ZipWriter( const std::filesystem::path& filename,
+            geode::local_index_t compression_level,
+            bool append = false )
+            : handle_( mz_zip_writer_create() ), filename_( filename )
+        {
+            mz_zip_writer_set_compress_method( handle_,
+                compression_level == 0 ? MZ_COMPRESS_METHOD_STORE
+                                       : MZ_COMPRESS_METHOD_DEFLATE );
+            mz_zip_writer_set_compress_level(
+                handle_, static_cast< std::int16_t >( compression_level ) );
+            check_zip_status(
+                mz_zip_writer_open_file( handle_, filename_.string().c_str(),
+                    0, append ? 1 : 0 ),
+                "create", filename_ );
+        }
+
+        ~ZipWriter()
+        {
+            mz_zip_writer_delete( &handle_ );
+        }
+
+        void add_file( const ArchiveFile& file )
+        {
+            check_zip_status(
+                mz_zip_writer_add_file( handle_, file.path.string().c_str(),
+                    file.name.c_str() ),
+                "write", filename_ );
+        }
+
+        void copy_current_entry( ZipReader& reader )
+        {
+            check_zip_status(
+                mz_zip_writer_copy_from_reader( handle_, reader.handle() ),
+                "write", filename_ );
+        }
+
+        void close()
+        {
+            check_zip_status(
+                mz_zip_writer_close( handle_ ), "write", filename_ );
+        }
+
+    private:
+        void* handle_;
+        std::filesystem::path filename_;
+    };
+
+    std::vector< ArchiveFile > archive_files(
+        const std::filesystem::path& directory )
+    {
+        std::vector< ArchiveFile > files;
+        for( const auto& file :
+            std::filesystem::recursive_directory_iterator( directory ) )
+        {
+            if( !file.is_regular_file() )
+            {
+                continue;
+            }
+            auto& archive_file = files.emplace_back();
+            archive_file.path = file.path();
+            archive_file.name =
+                std::filesystem::relative( file.path(), directory )
+                    .generic_string();
+        }
+        return files;
+    }
+
+    std::filesystem::path sibling_path( const std::filesystem::path& path )
+    {
+        auto sibling = path;
+        sibling += absl::StrCat( ".", geode::uuid{}.string() );
+        return sibling;
+    }
+
+    /*!
+     * Compresses each file as the single entry of its own zip archive in the
+     * work directory, in parallel. Returns the paths of these archives.
+     */
+    std::vector< std::filesystem::path > compress_entries(
+        const std::vector< ArchiveFile >& files,
+        const std::filesystem::path& work_directory,
+        geode::local_index_t compression_level )
+    {
+        std::vector< std::filesystem::path > entries( files.size() );
+        async::parallel_for( async::irange( std::size_t{ 0 }, files.size() ),
+            [&files, &entries, &work_directory, compression_level](
+                std::size_t f ) {
+                entries[f] = work_directory / absl::StrCat( f, ".zip" );
+                ZipWriter writer{ entries[f], compression_level };
+                writer.add_file( files[f] );
+                writer.close();
+            } );
+        return entries;
+    }
+
+    void copy_compressed_entries(
+        ZipWriter& writer, const std::vector< std::filesystem::path >& entries )
+    {
+        for( const auto& entry : entries )
+        {
+            {
+                ZipReader reader{ entry };
+                reader.goto_first_entry();
+                writer.copy_current_entry( reader );
+            }
+            std::filesystem::remove( entry );
+        }
+    }
+
+    geode::local_index_t compression_level(
+        const geode::GeodeArchiveOptions& options )
+    {
+        return options.archive_mode() == geode::ARCHIVE_MODE::stored
+                   ? 0
+                   : options.compression_level();
+    }
+
+    /*!
+     * Writes a zip archive with the files of the directory. The archive is
+     * written next to the given file and renamed over it.
+     */
+    void write_zip_archive( const std::filesystem::path& filename,
+        const std::filesystem::path& directory,
+        const geode::GeodeArchiveOptions& options )
+    {
+        const auto work_directory = sibling_path( filename );
+        const auto temporary = sibling_path( filename );
+        std::filesystem::create_directories( work_directory );
+        try
+        {
+            const auto entries = compress_entries( archive_files( directory ),
+                work_directory, compression_level( options ) );
+            {
+                ZipWriter writer{ temporary, compression_level( options ) };
+                copy_compressed_entries( writer, entries );
+                writer.close();
+            }
+            std::filesystem::rename( temporary, filename );
+        }
+        catch( ... )
+        {
+            std::filesystem::remove_all( work_directory );
+            std::filesystem::remove( temporary );
+            throw;
+        }
+        std::filesystem::remove_all( work_directory );
+    }
+
+    /*!
+     * Copy of the end of a zip archive, large enough to hold its central
+     * directory and end records. Appending entries overwrites them, so
+     * restoring this copy gives back the original archive.
+     */
+    class ZipTailBackup
+    {
+    public:
+        explicit ZipTailBackup( const std::filesystem::path& filename )
+            : filename_( filename ),
+              size_( static_cast< std::uint64_t >(
+                  std::filesystem::file_size( filename ) ) )
+        {
+            // Central headers, end records with their ZIP64 versions, and the
+            // largest possible archive comment
+            std::uint64_t tail_size{ 22 + 56 + 20
+                                     + std::numeric_limits<
+                                         std::uint16_t >::max() };
+            ZipReader reader{ filename };
+            reader.visit_entries( [&tail_size]( const mz_zip_file& info ) {
+                tail_size += 46 + info.filename_size + info.extrafield_size
+                             + info.comment_size;
+            } );
+            tail_size = std::min( tail_size, size_ );
+            tail_.resize( static_cast< std::size_t >( tail_size ) );
+            std::ifstream file{ filename_, std::ifstream::binary };
+            file.seekg( static_cast< std::streamoff >( size_ - tail_size ) );
+            file.read(
+                tail_.data(), static_cast< std::streamsize >( tail_size ) );
+        }
+
+        void restore()
+        {
+            std::filesystem::resize_file( filename_, size_ );
+            std::fstream file{ filename_,
+                std::fstream::in | std::fstream::out | std::fstream::binary };
+            file.seekp( static_cast< std::streamoff >( size_ - tail_.size() ) );
+            file.write(
+                tail_.data(), static_cast< std::streamsize >( tail_.size() ) );
+        }
+
+    private:
+        std::filesystem::path filename_;
+        std::uint64_t size_;
+        std::string tail_;
+    };
+
+    /*!
+     * Appends the files of the directory to the zip archive, in place: the
+     * new entries are written over the old central directory, followed by a
+     * new central directory listing the old and the new entries. On failure,
+     * the original end of the archive is restored.
+     */
+    void append_zip_archive( const std::filesystem::path& filename,
+        const std::filesystem::path& directory,
+        const geode::GeodeArchiveOptions& options )
+    {
+        const auto work_directory = sibling_path( filename );
+        std::filesystem::create_directories( work_directory );
+        ZipTailBackup backup{ filename };
+        try
+        {
+            const auto entries = compress_entries( archive_files( directory ),
+                work_directory, compression_level( options ) );
+            ZipWriter writer{ filename, compression_level( options ), true };
+            copy_compressed_entries( writer, entries );
+            writer.close();
+        }
+        catch( ... )
+        {
+            std::filesystem::remove_all( work_directory );
+            backup.restore();
+            throw;
+        }
+        std::filesystem::remove_all( work_directory );
+    }
+
+    std::string read_file( const std::filesystem::path& path )
+    {
+        std::ifstream file{ path, std::ifstream::binary };
+        return { std::istreambuf_iterator< char >{ file },
+            std::istreambuf_iterator< char >{} };
+    }
+
+    bool is_directory_archive( const std::filesystem::path& directory )
+    {
+        return std::filesystem::is_regular_file(
+            directory / DIRECTORY_ARCHIVE_MARKER );
+    }
+
+    void replace_directory_archive( const std::filesystem::path& directory,
+        const std::filesystem::path& temporary )
+    {
+        if( !std::filesystem::exists( directory ) )
+        {
+            std::filesystem::rename( temporary, directory );
+            return;
+        }
+        const auto previous = sibling_path( directory );
+        std::filesystem::rename( directory, previous );
+        try
+        {
+            std::filesystem::rename( temporary, directory );
+        }
+        catch( ... )
+        {
+            std::filesystem::rename( previous, directory );
+            throw;
+        }
+        std::filesystem::remove_all( previous );
+    }
+
+    void write_directory_archive( const std::filesystem::path& directory,
+        const std::function< void( std::string_view ) >& save_files )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::check_exception(
+            !std::filesystem::exists( directory )
+                || is_directory_archive( directory ),
+            nullptr, geode::OpenGeodeException::TYPE::data,
+            "[write_geode_archive] Cannot replace ", directory.string(),
+            ", it was not written in directory archive mode." );
+        const auto temporary = sibling_path( directory );
+        std::filesystem::create_directories( temporary );
+        try
+        {
+            save_files( temporary.string() );
+            std::ofstream marker{ temporary / DIRECTORY_ARCHIVE_MARKER };
+            marker.close();
+            replace_directory_archive( directory, temporary );
+        }
+        catch( ... )
+        {
+            std::filesystem::remove_all( temporary );
+            throw;
+        }
+    }
+
+    void update_directory_archive( const std::filesystem::path& archive,
+        const std::vector< ArchiveFile >& files )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::check_exception(
+            is_directory_archive( archive ), nullptr,
+            geode::OpenGeodeException::TYPE::data,
+            "[update_geode_archive] Cannot update ", archive.string(),
+            ", it was not written in directory archive mode." );
+        for( const auto& file : files )
+        {
+            const auto target = archive / file.name;
+            std::filesystem::create_directories( target.parent_path() );
+            const auto temporary = sibling_path( target );
+            std::filesystem::copy_file( file.path, temporary );
+            std::filesystem::rename( temporary, target );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        void write_geode_archive( std::string_view filename,
+            const GeodeArchiveOptions& options,
+            const std::function< void( std::string_view ) >& save_files )
+        {
+            const std::filesystem::path path{ to_string( filename ) };
+            if( options.archive_mode() == ARCHIVE_MODE::directory )
+            {
+                write_directory_archive( path, save_files );
+                return;
+            }
+            const auto directory = sibling_path( path );
+            std::filesystem::create_directories( directory );
+            try
+            {
+                save_files( directory.string() );
+                const IOTraceScope trace{ "GeodeArchive", "archive" };
+                write_zip_archive( path, directory, options );
+            }
+            catch( ... )
+            {
+                std::filesystem::remove_all( directory );
+                throw;
+            }
+            std::filesystem::remove_all( directory );
+        }
+
+        void read_geode_archive( std::string_view filename,
+            std::string_view type,
+            const std::function< void( std::string_view ) >& load_files )
+        {
+            if( std::filesystem::is_directory( to_string( filename ) ) )
+            {
+                load_files( filename );
+                return;
+            }
+            const UnzipFile zip_reader{ filename, uuid{}.string() };
+            {
+                const IOTraceScope trace{ type, "extract" };
+                zip_reader.extract_all();
+            }
+            load_files( zip_reader.directory() );
+        }
+
+        std::optional< std::string > read_geode_archive_entry(
+            std::string_view filename, std::string_view entry )
+        {
+            const std::filesystem::path path{ to_string( filename ) };
+            if( std::filesystem::is_directory( path ) )
+            {
+                const auto file = path / to_string( entry );
+                if( !std::filesystem::is_regular_file( file ) )
+                {
+                    return std::nullopt;
+                }
+                return read_file( file );
+            }
+            if( !std::filesystem::is_regular_file( path ) )
+            {
+                return std::nullopt;
+            }
+            // Updates append entries, the last one of a name is the current
+            ZipReader reader{ path };
+            std::optional< std::string > content;
+            reader.visit_entries(
+                [&reader, &content, &entry]( const mz_zip_file& info ) {
+                    if( std::string_view{ info.filename } == entry )
+                    {
+                        content = reader.read_entry( info );
+                    }
+                } );
+            return content;
+        }
+
+        std::uint64_t geode_archive_payload_size( std::string_view filename )
+        {
+            const std::filesystem::path path{ to_string( filename ) };
+            std::uint64_t nb_bytes{ 0 };
+            if( std::filesystem::is_directory( path ) )
+            {
+                for( const auto& entry :
+                    std::filesystem::recursive_directory_iterator( path ) )
+                {
+                    if( entry.is_regular_file() )
+                    {
+                        nb_bytes += entry.file_size();
+                    }
+                }
+                return nb_bytes;
+            }
+            absl::flat_hash_map< std::string, std::uint64_t > entry_sizes;
+            ZipReader reader{ path };
+            reader.visit_entries( [&entry_sizes]( const mz_zip_file& info ) {
+                entry_sizes[info.filename] =
+                    static_cast< std::uint64_t >( info.uncompressed_size );
+            } );
+            for( const auto& [name, size] : entry_sizes )
+            {
+                nb_bytes += size;
+            }
+            return nb_bytes;
+        }
+
+        void update_geode_archive( std::string_view filename,
+            std::string_view directory,
+            const GeodeArchiveOptions& options )
+        {
+            const IOTraceScope trace{ "GeodeArchive", "update" };
+            const std::filesystem::path path{ to_string( filename ) };
+            const std::filesystem::path files_directory{ to_string(
+                directory ) };
+            if( std::filesystem::is_directory( path ) )
+            {
+                update_directory_archive(
+                    path, archive_files( files_directory ) );
+                return;
+            }
+            append_zip_archive( path, files_directory, options );
+        }
+    } // namespace detail
+} // namespace geode
@@ -41,6 +41,8 @@
 #include <geode/model/representation/io/geode/geode_section_input.hpp>
 
 #include <geode/geosciences/explicit/representation/builder/cross_section_builder.hpp>
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 
 namespace geode
 {
@@ -52,11 +54,11 @@ namespace geode
 
     CrossSection OpenGeodeCrossSectionInput::read()
     {
-        const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
         CrossSection cross_section{ BITSERY::constructor };
-        detail::load_cross_section_files(
-            cross_section, zip_reader.directory() );
+        detail::read_geode_archive( filename(), "CrossSection",
+            [&cross_section]( std::string_view directory ) {
+                detail::load_cross_section_files( cross_section, directory );
+            } );
         return cross_section;
     }
 
@@ -68,18 +70,30 @@ namespace geode
             CrossSectionBuilder builder{ cross_section };
             async::parallel_invoke(
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "CrossSection",
+                        "load Faults" };
                     builder.load_faults( directory );
                 },
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "CrossSection",
+                        "load Horizons" };
                     builder.load_horizons( directory );
                 },
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "CrossSection",
+                        "load FaultBlocks" };
                     builder.load_fault_blocks( directory );
                 },
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "CrossSection",
+                        "load StratigraphicUnits" };
                     builder.load_stratigraphic_units( directory );
                 } );
-            load_section_files( cross_section, directory );
+            {
+                const detail::IOTraceScope trace{ "CrossSection",
+                    "load Section" };
+                load_section_files( cross_section, directory );
+            }
         }
     } // namespace detail
 } // namespace geode
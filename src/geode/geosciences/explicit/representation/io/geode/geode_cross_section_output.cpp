@@ -35,6 +35,9 @@
 
 #include <geode/model/representation/io/geode/geode_section_output.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
+
 namespace geode
 {
     OpenGeodeCrossSectionOutput::OpenGeodeCrossSectionOutput(
@@ -48,19 +51,29 @@ namespace geode
     {
         async::parallel_invoke(
             [&directory, &cross_section] {
+                const detail::IOTraceScope trace{ "CrossSection",
+                    "save Section" };
                 OpenGeodeSectionOutput section_output{ "" };
                 section_output.save_section_files( cross_section, directory );
             },
             [&directory, &cross_section] {
+                const detail::IOTraceScope trace{ "CrossSection",
+                    "save Faults" };
                 cross_section.save_faults( directory );
             },
             [&directory, &cross_section] {
+                const detail::IOTraceScope trace{ "CrossSection",
+                    "save Horizons" };
                 cross_section.save_horizons( directory );
             },
             [&directory, &cross_section] {
+                const detail::IOTraceScope trace{ "CrossSection",
+                    "save FaultBlocks" };
                 cross_section.save_fault_blocks( directory );
             },
             [&directory, &cross_section] {
+                const detail::IOTraceScope trace{ "CrossSection",
+                    "save StratigraphicUnits" };
                 cross_section.save_stratigraphic_units( directory );
             } );
     }
@@ -68,6 +81,7 @@ namespace geode
     void OpenGeodeCrossSectionOutput::archive_cross_section_files(
         const ZipFile& zip_writer ) const
     {
+        const detail::IOTraceScope trace{ "CrossSection", "archive" };
         OpenGeodeSectionOutput section_output{ "" };
         section_output.archive_section_files( zip_writer );
     }
@@ -75,10 +89,10 @@ namespace geode
     std::vector< std::string > OpenGeodeCrossSectionOutput::write(
         const CrossSection& cross_section ) const
     {
-        const ZipFile zip_writer{ filename(), uuid{}.string() };
-        save_cross_section_files(
-            cross_section, to_string( zip_writer.directory() ) );
-        archive_cross_section_files( zip_writer );
+        detail::write_geode_archive( filename(), *this,
+            [&cross_section, this]( std::string_view directory ) {
+                save_cross_section_files( cross_section, directory );
+            } );
         return { to_string( filename() ) };
     }
 } // namespace geode
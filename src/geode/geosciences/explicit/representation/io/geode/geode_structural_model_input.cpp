@@ -43,6 +43,8 @@
 #include <geode/model/representation/io/geode/geode_brep_input.hpp>
 
 #include <geode/geosciences/explicit/representation/builder/structural_model_builder.hpp>
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 
 namespace geode
 {
@@ -54,11 +56,12 @@ namespace geode
 
     StructuralModel OpenGeodeStructuralModelInput::read()
     {
-        const UnzipFile zip_reader{ filename(), uuid{}.string() };
-        zip_reader.extract_all();
         StructuralModel structural_model{ BITSERY::constructor };
-        detail::load_structural_model_files(
-            structural_model, zip_reader.directory() );
+        detail::read_geode_archive( filename(), "StructuralModel",
+            [&structural_model]( std::string_view directory ) {
+                detail::load_structural_model_files(
+                    structural_model, directory );
+            } );
         return structural_model;
     }
 
@@ -70,18 +73,30 @@ namespace geode
             StructuralModelBuilder builder{ structural_model };
             async::parallel_invoke(
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "StructuralModel",
+                        "load Faults" };
                     builder.load_faults( directory );
                 },
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "StructuralModel",
+                        "load Horizons" };
                     builder.load_horizons( directory );
                 },
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "StructuralModel",
+                        "load FaultBlocks" };
                     builder.load_fault_blocks( directory );
                 },
                 [&builder, &directory] {
+                    const detail::IOTraceScope trace{ "StructuralModel",
+                        "load StratigraphicUnits" };
                     builder.load_stratigraphic_units( directory );
                 } );
-            load_brep_files( structural_model, directory );
+            {
+                const detail::IOTraceScope trace{ "StructuralModel",
+                    "load BRep" };
+                load_brep_files( structural_model, directory );
+            }
         }
     } // namespace detail
 } // namespace geode
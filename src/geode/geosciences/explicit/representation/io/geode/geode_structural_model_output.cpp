@@ -35,6 +35,9 @@
 
 #include <geode/model/representation/io/geode/geode_brep_output.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
+
 namespace geode
 {
     OpenGeodeStructuralModelOutput::OpenGeodeStructuralModelOutput(
@@ -49,19 +52,29 @@ namespace geode
     {
         async::parallel_invoke(
             [&directory, &structural_model] {
+                const detail::IOTraceScope trace{ "StructuralModel",
+                    "save BRep" };
                 OpenGeodeBRepOutput brep_output{ "" };
                 brep_output.save_brep_files( structural_model, directory );
             },
             [&directory, &structural_model] {
+                const detail::IOTraceScope trace{ "StructuralModel",
+                    "save Faults" };
                 structural_model.save_faults( directory );
             },
             [&directory, &structural_model] {
+                const detail::IOTraceScope trace{ "StructuralModel",
+                    "save Horizons" };
                 structural_model.save_horizons( directory );
             },
             [&directory, &structural_model] {
+                const detail::IOTraceScope trace{ "StructuralModel",
+                    "save FaultBlocks" };
                 structural_model.save_fault_blocks( directory );
             },
             [&directory, &structural_model] {
+                const detail::IOTraceScope trace{ "StructuralModel",
+                    "save StratigraphicUnits" };
                 structural_model.save_stratigraphic_units( directory );
             } );
     }
@@ -69,6 +82,7 @@ namespace geode
     void OpenGeodeStructuralModelOutput::archive_structural_model_files(
         const ZipFile& zip_writer ) const
     {
+        const detail::IOTraceScope trace{ "StructuralModel", "archive" };
         OpenGeodeBRepOutput brep_output{ "" };
         brep_output.archive_brep_files( zip_writer );
     }
@@ -76,10 +90,10 @@ namespace geode
     std::vector< std::string > OpenGeodeStructuralModelOutput::write(
         const StructuralModel& structural_model ) const
     {
-        const ZipFile zip_writer{ filename(), uuid{}.string() };
-        save_structural_model_files(
-            structural_model, to_string( zip_writer.directory() ) );
-        archive_structural_model_files( zip_writer );
+        detail::write_geode_archive( filename(), *this,
+            [&structural_model, this]( std::string_view directory ) {
+                save_structural_model_files( structural_model, directory );
+            } );
         return { to_string( filename() ) };
     }
 } // namespace geode
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/explicit/representation/io/io_trace.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+
+namespace
+{
+    class IOTraceRecorder
+    {
+    public:
+        static IOTraceRecorder& instance()
+        {
+            static IOTraceRecorder recorder;
+            return recorder;
+        }
+
+        bool is_active() const
+        {
+            return active_.load( std::memory_order_acquire );
+        }
+
+        void start()
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            events_.clear();
+            threads_.clear();
+            origin_ = std::chrono::steady_clock::now();
+            active_.store( true, std::memory_order_release );
+        }
+
+        std::vector< geode::IOTraceEvent > stop()
+        {
+            active_.store( false, std::memory_order_release );
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            auto events = std::move( events_ );
+            events_.clear();
+            absl::c_stable_sort(
+                events, []( const auto& lhs, const auto& rhs ) {
+                    return lhs.start_seconds < rhs.start_seconds;
+                } );
+            return events;
+        }
+
+        void add( std::string_view category,
+            std::string_view name,
+            std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            if( !is_active() || start < origin_ )
+            {
+                return;
+            }
+            const auto next_thread =
+                static_cast< std::uint32_t >( threads_.size() );
+            const auto thread =
+                threads_.try_emplace( std::this_thread::get_id(), next_thread )
+                    .first->second;
+            events_.push_back( { std::string{ category }, std::string{ name },
+                std::chrono::duration< double >( start - origin_ ).count(),
+                std::chrono::duration< double >( end - start ).count(),
+                thread } );
+        }
+
+    private:
+        std::atomic< bool > active_{ false };
+        std::mutex mutex_;
+        std::chrono::steady_clock::time_point origin_;
+        std::vector< geode::IOTraceEvent > events_;
+        absl::flat_hash_map< std::thread::id, std::uint32_t > threads_;
+    };
+
+    std::string escape_json( std::string_view value )
+    {
+        std::string result;
+        result.reserve( value.size() );
+        for( const auto character : value )
+        {
+            if( character == '"' || character == '\\' )
+            {
+                result.push_back( '\\' );
+            }
+            result.push_back( character );
+        }
+        return result;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        IOTraceScope::IOTraceScope(
+            std::string_view category, std::string_view name )
+            : category_( category ),
+              name_( name ),
+              active_( IOTraceRecorder::instance().is_active() )
+        {
+            if( active_ )
+            {
+                start_ = std::chrono::steady_clock::now();
+            }
+        }
+
+        IOTraceScope::~IOTraceScope()
+        {
+            if( active_ )
+            {
+                IOTraceRecorder::instance().add( category_, name_, start_,
+                    std::chrono::steady_clock::now() );
+            }
+        }
+    } // namespace detail
+
+    void start_io_trace()
+    {
+        IOTraceRecorder::instance().start();
+    }
+
+    std::vector< IOTraceEvent > stop_io_trace()
+    {
+        return IOTraceRecorder::instance().stop();
+    }
+
+    void save_io_trace(
+        absl::Span< const IOTraceEvent > events, std::string_view filename )
+    {
+        std::ofstream file{ to_string( filename ) };
+        OpenGeodeGeosciencesExplicitException::check_exception( file.good(),
+            nullptr, OpenGeodeException::TYPE::data,
+            "[save_io_trace] Cannot open file: ", filename );
+        constexpr double MICROSECONDS{ 1e6 };
+        file << "{\"traceEvents\":[";
+        for( const auto& event : events )
+        {
+            if( &event != &events.front() )
+            {
+                file << ",";
+            }
+            file << "\n{\"name\":\"" << escape_json( event.name )
+                 << "\",\"cat\":\"" << escape_json( event.category )
+                 << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+                 << ",\"ts\":" << event.start_seconds * MICROSECONDS
+                 << ",\"dur\":" << event.duration_seconds * MICROSECONDS
+                 << "}";
+        }
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+} // namespace geode
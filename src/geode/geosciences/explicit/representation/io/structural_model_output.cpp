@@ -34,6 +34,7 @@
 #include <geode/model/representation/io/brep_output.hpp>
 
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 
 namespace geode
 {
@@ -59,6 +60,15 @@ namespace geode
         }
     }
 
+    std::vector< std::string > save_structural_model(
+        const StructuralModel& structural_model,
+        std::string_view filename,
+        const GeodeArchiveOptions& archive_options )
+    {
+        return detail::save_geode_archive< StructuralModelOutputFactory >(
+            structural_model, filename, archive_options );
+    }
+
     bool is_structural_model_saveable(
         const StructuralModel& structural_model, std::string_view filename )
     {
@@ -30,6 +30,8 @@
 #include <geode/geosciences/implicit/representation/io/geode/geode_implicit_cross_section_output.hpp>
 #include <geode/geosciences/implicit/representation/io/geode/geode_implicit_structural_model_input.hpp>
 #include <geode/geosciences/implicit/representation/io/geode/geode_implicit_structural_model_output.hpp>
+#include <geode/geosciences/implicit/representation/io/geode/geode_stratigraphic_model_input.hpp>
+#include <geode/geosciences/implicit/representation/io/geode/geode_stratigraphic_model_output.hpp>
 
 namespace
 {
@@ -80,6 +82,20 @@ namespace
             geode::OpenGeodeImplicitStructuralModelOutput >(
             geode::OpenGeodeImplicitStructuralModelOutput::extension().data() );
     }
+
+    void register_stratigraphic_model_input()
+    {
+        geode::StratigraphicModelInputFactory::register_creator<
+            geode::OpenGeodeStratigraphicModelInput >(
+            geode::OpenGeodeStratigraphicModelInput::extension().data() );
+    }
+
+    void register_stratigraphic_model_output()
+    {
+        geode::StratigraphicModelOutputFactory::register_creator<
+            geode::OpenGeodeStratigraphicModelOutput >(
+            geode::OpenGeodeStratigraphicModelOutput::extension().data() );
+    }
 } // namespace
 
 namespace geode
@@ -93,5 +109,7 @@ namespace geode
         register_cross_section_model_output();
         register_implicit_structural_model_input();
         register_implicit_structural_model_output();
+        register_stratigraphic_model_input();
+        register_stratigraphic_model_output();
     }
 } // namespace geode
@@ -63,6 +63,18 @@ namespace geode
                 StratigraphicRelationshipsBuilderKey{} );
     }
 
+    void StratigraphicRelationshipsBuilder::start_batch_edition()
+    {
+        relationships_.start_batch_edition( StratigraphicRelationships::
+                StratigraphicRelationshipsBuilderKey{} );
+    }
+
+    void StratigraphicRelationshipsBuilder::end_batch_edition()
+    {
+        relationships_.end_batch_edition( StratigraphicRelationships::
+                StratigraphicRelationshipsBuilderKey{} );
+    }
+
     void StratigraphicRelationshipsBuilder::copy_stratigraphic_relationships(
         const ModelCopyMapping& mapping,
         const StratigraphicRelationships& relationships )
@@ -23,11 +23,13 @@
 
 #include <geode/geosciences/implicit/mixin/core/stratigraphic_relationships.hpp>
 
+#include <algorithm>
 #include <fstream>
 
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/bitsery_archive.hpp>
 #include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
 #include <geode/basic/sparse_attribute.hpp>
 #include <geode/basic/uuid.hpp>
 
@@ -72,18 +74,7 @@ namespace geode
 
         bool is_directly_above( const uuid& above, const uuid& under ) const
         {
-            const auto edge_id = relation_edge( above, under );
-            if( !edge_id )
-            {
-                return false;
-            }
-            if( !above_relations_->value( edge_id.value() ) )
-            {
-                return false;
-            }
-            return graph_component_id( { edge_id.value(), ABOVE_EDGE_VERTEX } )
-                       .id
-                   == above;
+            return active_above_relation_edge( above, under ).has_value();
         }
 
         std::optional< uuid > above( const uuid& element ) const
@@ -135,6 +126,19 @@ namespace geode
         index_t add_above_relation(
             const ComponentID& above, const ComponentID& under )
         {
+            if( batch_depth_ > 0 )
+            {
+                keep_component( above.id );
+                keep_component( under.id );
+                if( const auto id =
+                        active_above_relation_edge( above.id, under.id ) )
+                {
+                    return id.value();
+                }
+                const auto index = add_relation_edge( above, under );
+                above_relations_->set_value( index, true );
+                return index;
+            }
             if( const auto id = relation_edge( above.id, under.id ) )
             {
                 above_relations_->set_value( id.value(), true );
@@ -147,6 +151,18 @@ namespace geode
 
         void remove_above_relation( const uuid& id1, const uuid& id2 )
         {
+            if( batch_depth_ > 0 )
+            {
+                if( const auto id = active_above_relation_edge( id1, id2 ) )
+                {
+                    remove_relation_edge( id.value() );
+                }
+                if( const auto id = active_above_relation_edge( id2, id1 ) )
+                {
+                    remove_relation_edge( id.value() );
+                }
+                return;
+            }
             auto id = relation_edge( id1, id2 );
             if( !id )
             {
@@ -159,6 +175,85 @@ namespace geode
             this->remove_relation_edge( id.value() );
         }
 
+        void remove_relation( const uuid& id1, const uuid& id2 )
+        {
+            if( batch_depth_ == 0 )
+            {
+                detail::RelationshipsImpl::remove_relation( id1, id2 );
+                return;
+            }
+            const auto index1 = vertex_id( id1 );
+            if( !index1 || !vertex_id( id2 ) )
+            {
+                return;
+            }
+            for( const auto& edge_vertex :
+                this->graph().edges_around_vertex( index1.value() ) )
+            {
+                if( above_relations_->value( edge_vertex.edge_id )
+                    && this->graph_component_id( edge_vertex.opposite() ).id
+                           == id2 )
+                {
+                    remove_relation_edge( edge_vertex.edge_id );
+                }
+            }
+        }
+
+        void unregister_component( const uuid& id )
+        {
+            if( batch_depth_ == 0 )
+            {
+                this->remove_component( id );
+                return;
+            }
+            if( const auto index = vertex_id( id ) )
+            {
+                for( const auto& edge_vertex :
+                    this->graph().edges_around_vertex( index.value() ) )
+                {
+                    if( above_relations_->value( edge_vertex.edge_id ) )
+                    {
+                        remove_relation_edge( edge_vertex.edge_id );
+                    }
+                }
+            }
+            components_to_remove_.push_back( id );
+        }
+
+        void start_batch_edition()
+        {
+            batch_depth_++;
+        }
+
+        void end_batch_edition()
+        {
+            if( batch_depth_ == 0 || --batch_depth_ > 0 )
+            {
+                return;
+            }
+            const auto edges_to_remove = std::move( edges_to_remove_ );
+            edges_to_remove_.clear();
+            const auto components_to_remove =
+                std::move( components_to_remove_ );
+            components_to_remove_.clear();
+            if( !edges_to_remove.empty() )
+            {
+                std::vector< bool > to_delete( graph_->nb_edges(), false );
+                for( const auto edge_id : edges_to_remove )
+                {
+                    if( !above_relations_->value( edge_id ) )
+                    {
+                        to_delete[edge_id] = true;
+                    }
+                }
+                GraphBuilder::create( *graph_ )->delete_edges( to_delete );
+            }
+            for( const auto& component_id : components_to_remove )
+            {
+                this->remove_component( component_id );
+            }
+        }
+
         void copy( const Impl& impl, const ModelCopyMapping& mapping )
         {
             detail::RelationshipsImpl::copy( impl, mapping );
@@ -257,8 +352,44 @@ namespace geode
             return std::nullopt;
         }
 
+        std::optional< index_t > active_above_relation_edge(
+            const uuid& above, const uuid& under ) const
+        {
+            const auto index_above = vertex_id( above );
+            if( !index_above || !vertex_id( under ) )
+            {
+                return std::nullopt;
+            }
+            for( const auto& edge_vertex :
+                this->graph().edges_around_vertex( index_above.value() ) )
+            {
+                if( edge_vertex.vertex_id == ABOVE_EDGE_VERTEX
+                    && above_relations_->value( edge_vertex.edge_id )
+                    && this->graph_component_id( edge_vertex.opposite() ).id
+                           == under )
+                {
+                    return edge_vertex.edge_id;
+                }
+            }
+            return std::nullopt;
+        }
+
+        void keep_component( const uuid& id )
+        {
+            components_to_remove_.erase(
+                std::remove( components_to_remove_.begin(),
+                    components_to_remove_.end(), id ),
+                components_to_remove_.end() );
+        }
+
         void remove_relation_edge( index_t relation_edge_id )
         {
+            if( batch_depth_ > 0 )
+            {
+                above_relations_->set_value( relation_edge_id, false );
+                edges_to_remove_.push_back( relation_edge_id );
+                return;
+            }
             std::vector< bool > to_delete( graph_->nb_edges(), false );
             to_delete[relation_edge_id] = true;
             GraphBuilder::create( *graph_ )->delete_edges( to_delete );
@@ -304,6 +435,9 @@ namespace geode
 
     private:
         std::shared_ptr< SparseAttribute< bool > > above_relations_;
+        index_t batch_depth_{ 0 };
+        std::vector< index_t > edges_to_remove_;
+        std::vector< uuid > components_to_remove_;
     };
 
     StratigraphicRelationships::StratigraphicRelationships() = default;
@@ -320,7 +454,7 @@ namespace geode
     void StratigraphicRelationships::remove_component(
         const uuid& id, StratigraphicRelationshipsBuilderKey )
     {
-        impl_->remove_component( id );
+        impl_->unregister_component( id );
     }
 
     bool StratigraphicRelationships::is_above(
@@ -367,6 +501,18 @@ namespace geode
         impl_->remove_above_relation( id1, id2 );
     }
 
+    void StratigraphicRelationships::start_batch_edition(
+        StratigraphicRelationshipsBuilderKey )
+    {
+        impl_->start_batch_edition();
+    }
+
+    void StratigraphicRelationships::end_batch_edition(
+        StratigraphicRelationshipsBuilderKey )
+    {
+        impl_->end_batch_edition();
+    }
+
     void StratigraphicRelationships::save_stratigraphic_relationships(
         std::string_view directory ) const
     {
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/builder/helpers/stratigraphic_attribute_transfer.hpp>
+
+#include <algorithm>
+#include <limits>
+
+#include <absl/algorithm/container.h>
+
+#include <async++.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/variable_attribute.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/helpers/tetrahedral_solid_scalar_function.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+
+namespace
+{
+    struct SourceLocation
+    {
+        const geode::Block3D* block{ nullptr };
+        geode::index_t tetrahedron{ geode::NO_ID };
+        geode::Point3D point;
+    };
+
+    class StratigraphicAttributeTransfer
+    {
+    public:
+        StratigraphicAttributeTransfer( const geode::StratigraphicModel& source,
+            geode::StratigraphicModel& target,
+            absl::Span< const std::string > attribute_names )
+            : source_( source ),
+              target_( target ),
+              attribute_names_( attribute_names )
+        {
+            source_.compute_stratigraphic_query_trees();
+            source_functions_.resize( attribute_names_.size() );
+            for( const auto& block : source_.blocks() )
+            {
+                const auto& mesh = block.mesh< geode::TetrahedralSolid3D >();
+                for( const auto a : geode::Indices{ attribute_names_ } )
+                {
+                    const auto ids =
+                        mesh.vertex_attribute_manager()
+                            .attribute_ids_matching_name( attribute_names_[a] );
+                    geode::OpenGeodeGeosciencesImplicitException::
+                        check_exception( ids.has_value(), nullptr,
+                            geode::OpenGeodeException::TYPE::data,
+                            "[transfer_attributes_through_stratigraphic_"
+                            "space] Source block ",
+                            block.id().string(), " has no vertex attribute '",
+                            attribute_names_[a], "'." );
+                    source_functions_[a].try_emplace( block.id(),
+                        geode::TetrahedralSolidScalarFunction3D::find(
+                            mesh, ids.value().front() ) );
+                }
+            }
+        }
+
+        geode::StratigraphicAttributeTransferResult transfer()
+        {
+            geode::StratigraphicAttributeTransferResult result;
+            for( const auto& block : target_.blocks() )
+            {
+                const auto locations = locate_block_vertices( block );
+                std::vector< geode::index_t > unmapped;
+                for( const auto v : geode::Indices{ locations } )
+                {
+                    if( locations[v].block )
+                    {
+                        result.nb_mapped_vertices++;
+                    }
+                    else
+                    {
+                        unmapped.push_back( v );
+                    }
+                }
+                for( const auto a : geode::Indices{ attribute_names_ } )
+                {
+                    transfer_attribute( block, a, locations );
+                }
+                if( !unmapped.empty() )
+                {
+                    result.unmapped_vertices.emplace(
+                        block.id(), std::move( unmapped ) );
+                }
+            }
+            return result;
+        }
+
+    private:
+        std::vector< SourceLocation > locate_block_vertices(
+            const geode::Block3D& block ) const
+        {
+            const auto nb_vertices = block.mesh().nb_vertices();
+            std::vector< geode::StratigraphicPoint3D > stratigraphic_points(
+                nb_vertices );
+            async::parallel_for(
+                async::irange( geode::index_t{ 0 }, nb_vertices ),
+                [&stratigraphic_points, &block, this]( geode::index_t v ) {
+                    stratigraphic_points[v] =
+                        target_.stratigraphic_coordinates( block, v );
+                } );
+            std::vector< SourceLocation > locations( nb_vertices );
+            std::vector< geode::index_t > remaining( nb_vertices );
+            absl::c_iota( remaining, 0 );
+            for( const auto& source_block : source_.blocks() )
+            {
+                if( remaining.empty() )
+                {
+                    break;
+                }
+                async::parallel_for(
+                    async::irange( std::size_t{ 0 }, remaining.size() ),
+                    [&locations, &remaining, &stratigraphic_points,
+                        &source_block, this]( std::size_t r ) {
+                        const auto v = remaining[r];
+                        const auto tetrahedron =
+                            source_.stratigraphic_containing_polyhedron(
+                                source_block, stratigraphic_points[v] );
+                        if( !tetrahedron )
+                        {
+                            return;
+                        }
+                        locations[v] = { &source_block, tetrahedron.value(),
+                            source_.geometric_coordinates( source_block,
+                                stratigraphic_points[v],
+                                tetrahedron.value() ) };
+                    } );
+                remaining.erase(
+                    std::remove_if( remaining.begin(), remaining.end(),
+                        [&locations]( geode::index_t v ) {
+                            return locations[v].block != nullptr;
+                        } ),
+                    remaining.end() );
+            }
+            return locations;
+        }
+
+        void transfer_attribute( const geode::Block3D& block,
+            geode::index_t attribute_index,
+            absl::Span< const SourceLocation > locations ) const
+        {
+            const auto& functions = source_functions_[attribute_index];
+            std::vector< double > values( locations.size() );
+            async::parallel_for(
+                async::irange( std::size_t{ 0 }, locations.size() ),
+                [&values, &locations, &functions]( std::size_t v ) {
+                    const auto& location = locations[v];
+                    if( !location.block )
+                    {
+                        return;
+                    }
+                    values[v] = functions.at( location.block->id() )
+                                    .value( location.point,
+                                        location.tetrahedron );
+                } );
+            const auto attribute =
+                target_attribute( block, attribute_names_[attribute_index] );
+            for( const auto v : geode::Indices{ locations } )
+            {
+                if( locations[v].block )
+                {
+                    attribute->set_value( v, values[v] );
+                }
+            }
+        }
+
+        std::shared_ptr< geode::VariableAttribute< double > > target_attribute(
+            const geode::Block3D& block, std::string_view name ) const
+        {
+            auto& manager = block.mesh().vertex_attribute_manager();
+            if( const auto ids = manager.attribute_ids_matching_name( name ) )
+            {
+                auto attribute =
+                    manager.find_attribute< geode::VariableAttribute, double >(
+                        ids.value().front() );
+                geode::OpenGeodeGeosciencesImplicitException::check_exception(
+                    attribute != nullptr, nullptr,
+                    geode::OpenGeodeException::TYPE::data,
+                    "[transfer_attributes_through_stratigraphic_space] Target "
+                    "attribute '",
+                    name, "' of block ", block.id().string(),
+                    " is not a scalar vertex attribute." );
+                return attribute;
+            }
+            geode::AttributeValues< double > default_values;
+            default_values.default_value =
+                std::numeric_limits< double >::quiet_NaN();
+            default_values.no_value =
+                std::numeric_limits< double >::quiet_NaN();
+            geode::AttributeProperties properties;
+            properties.assignable = true;
+            properties.interpolable = true;
+            properties.transferable = true;
+            const auto attribute_id =
+                manager.create_attribute< geode::VariableAttribute, double >(
+                    name, default_values, properties );
+            return manager.find_attribute< geode::VariableAttribute, double >(
+                attribute_id );
+        }
+
+    private:
+        const geode::StratigraphicModel& source_;
+        geode::StratigraphicModel& target_;
+        absl::Span< const std::string > attribute_names_;
+        std::vector< absl::flat_hash_map< geode::uuid,
+            geode::TetrahedralSolidScalarFunction3D > >
+            source_functions_;
+    };
+} // namespace
+
+namespace geode
+{
+    StratigraphicAttributeTransferResult
+        transfer_attributes_through_stratigraphic_space(
+            const StratigraphicModel& source,
+            StratigraphicModel& target,
+            absl::Span< const std::string > attribute_names )
+    {
+        StratigraphicAttributeTransfer transfer{ source, target,
+            attribute_names };
+        auto result = transfer.transfer();
+        if( !result.unmapped_vertices.empty() )
+        {
+            Logger::warn( "[transfer_attributes_through_stratigraphic_space] ",
+                result.unmapped_vertices.size(),
+                " target blocks have vertices outside the source "
+                "stratigraphic space." );
+        }
+        return result;
+    }
+} // namespace geode
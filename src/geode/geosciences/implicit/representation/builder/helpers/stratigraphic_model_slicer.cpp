@@ -0,0 +1,726 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/builder/helpers/stratigraphic_model_slicer.hpp>
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+#include <absl/container/inlined_vector.h>
+
+#include <async++.h>
+
+#include <geode/geometry/basic_objects/plane.hpp>
+#include <geode/geometry/point.hpp>
+#include <geode/geometry/vector.hpp>
+
+#include <geode/mesh/builder/edged_curve_builder.hpp>
+#include <geode/mesh/builder/surface_mesh_builder.hpp>
+#include <geode/mesh/core/geode/geode_triangulated_surface.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+
+#include <geode/geosciences/explicit/mixin/core/fault.hpp>
+#include <geode/geosciences/explicit/mixin/core/fault_block.hpp>
+#include <geode/geosciences/explicit/mixin/core/horizon.hpp>
+#include <geode/geosciences/explicit/mixin/core/stratigraphic_unit.hpp>
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
+#include <geode/geosciences/implicit/representation/builder/stratigraphic_section_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_section.hpp>
+
+namespace
+{
+    using SliceVertexKey = std::pair< geode::index_t, geode::index_t >;
+
+    /*!
+     * Orthonormal frame of the slicing plane. For non horizontal planes the
+     * abscissa is horizontal and the ordinate points upward.
+     */
+    class SliceFrame
+    {
+    public:
+        explicit SliceFrame( const geode::Plane& plane )
+            : origin_( plane.origin() ), normal_( plane.normal() )
+        {
+            const geode::Vector3D up{ { 0, 0, 1 } };
+            auto abscissa = up.cross( normal_ );
+            if( abscissa.length() < geode::GLOBAL_EPSILON )
+            {
+                abscissa = geode::Vector3D{ { 1, 0, 0 } };
+            }
+            abscissa_ = abscissa.normalize();
+            ordinate_ = normal_.cross( abscissa_ );
+            if( ordinate_.value( 2 ) < 0 )
+            {
+                abscissa_ = abscissa_ * -1.;
+                ordinate_ = ordinate_ * -1.;
+            }
+            const geode::Vector2D map_abscissa{ { abscissa_.value( 0 ),
+                abscissa_.value( 1 ) } };
+            map_abscissa_ = map_abscissa.length() < geode::GLOBAL_EPSILON
+                                ? geode::Vector2D{ { 1, 0 } }
+                                : map_abscissa.normalize();
+        }
+
+        double signed_distance( const geode::Point3D& point ) const
+        {
+            return geode::Vector3D{ origin_, point }.dot( normal_ );
+        }
+
+        geode::Point2D project( const geode::Point3D& point ) const
+        {
+            const geode::Vector3D vector{ origin_, point };
+            return geode::Point2D{ { vector.dot( abscissa_ ),
+                vector.dot( ordinate_ ) } };
+        }
+
+        geode::Point1D project_location( const geode::Point2D& location ) const
+        {
+            return geode::Point1D{ { location.value( 0 )
+                                         * map_abscissa_.value( 0 )
+                                     + location.value( 1 )
+                                           * map_abscissa_.value( 1 ) } };
+        }
+
+    private:
+        geode::Point3D origin_;
+        geode::Vector3D normal_;
+        geode::Vector3D abscissa_;
+        geode::Vector3D ordinate_;
+        geode::Vector2D map_abscissa_;
+    };
+
+    /*!
+     * Computes the intersections of mesh elements with the plane. Slice
+     * vertices lie either on a mesh vertex on the plane or on a mesh edge
+     * crossing it, and are shared between the elements around them.
+     */
+    class ElementSlicer
+    {
+    public:
+        ElementSlicer( const SliceFrame& frame,
+            absl::FixedArray< geode::Point3D > points )
+            : points_( std::move( points ) ), distances_( points_.size() )
+        {
+            for( const auto v : geode::Indices{ points_ } )
+            {
+                distances_[v] = frame.signed_distance( points_[v] );
+                if( std::fabs( distances_[v] ) <= geode::GLOBAL_EPSILON )
+                {
+                    distances_[v] = 0;
+                }
+            }
+        }
+
+        double distance( geode::index_t vertex ) const
+        {
+            return distances_[vertex];
+        }
+
+        /*!
+         * Returns the number of element vertices lying on the plane and the
+         * number of element edges crossing it, without creating any slice
+         * vertex.
+         */
+        template < typename Vertices >
+        std::pair< geode::index_t, geode::index_t > count(
+            const Vertices& vertices ) const
+        {
+            geode::index_t nb_on_plane{ 0 };
+            geode::index_t nb_crossings{ 0 };
+            for( const auto v0 : geode::Indices{ vertices } )
+            {
+                if( distances_[vertices[v0]] == 0 )
+                {
+                    nb_on_plane++;
+                }
+                for( auto v1 = v0 + 1; v1 < vertices.size(); v1++ )
+                {
+                    if( distances_[vertices[v0]] * distances_[vertices[v1]]
+                        < 0 )
+                    {
+                        nb_crossings++;
+                    }
+                }
+            }
+            return { nb_on_plane, nb_crossings };
+        }
+
+        /*!
+         * Returns the slice vertices of the element with the given vertices,
+         * those on the plane first.
+         */
+        template < typename Vertices >
+        absl::InlinedVector< geode::index_t, 4 > slice(
+            const Vertices& vertices )
+        {
+            absl::InlinedVector< geode::index_t, 4 > result;
+            for( const auto vertex : vertices )
+            {
+                if( distances_[vertex] == 0 )
+                {
+                    result.push_back( slice_vertex( vertex, vertex ) );
+                }
+            }
+            for( const auto v0 : geode::Indices{ vertices } )
+            {
+                for( auto v1 = v0 + 1; v1 < vertices.size(); v1++ )
+                {
+                    if( distances_[vertices[v0]] * distances_[vertices[v1]]
+                        < 0 )
+                    {
+                        result.push_back(
+                            slice_vertex( vertices[v0], vertices[v1] ) );
+                    }
+                }
+            }
+            return result;
+        }
+
+        absl::Span< const std::pair< SliceVertexKey, double > >
+            slice_vertices() const
+        {
+            return slice_vertices_;
+        }
+
+        geode::Point3D point( geode::index_t slice_vertex ) const
+        {
+            const auto& [key, ratio] = slice_vertices_[slice_vertex];
+            return points_[key.first] * ( 1. - ratio )
+                   + points_[key.second] * ratio;
+        }
+
+    private:
+        geode::index_t slice_vertex( geode::index_t v0, geode::index_t v1 )
+        {
+            if( v0 > v1 )
+            {
+                std::swap( v0, v1 );
+            }
+            const auto [it, inserted] = slice_vertex_ids_.try_emplace(
+                SliceVertexKey{ v0, v1 }, slice_vertices_.size() );
+            if( inserted )
+            {
+                const auto ratio =
+                    v0 == v1
+                        ? 0.
+                        : distances_[v0] / ( distances_[v0] - distances_[v1] );
+                slice_vertices_.emplace_back( it->first, ratio );
+            }
+            return it->second;
+        }
+
+    private:
+        absl::FixedArray< geode::Point3D > points_;
+        absl::FixedArray< double > distances_;
+        absl::flat_hash_map< SliceVertexKey, geode::index_t > slice_vertex_ids_;
+        std::vector< std::pair< SliceVertexKey, double > > slice_vertices_;
+    };
+
+    template < typename Mesh >
+    absl::FixedArray< geode::Point3D > mesh_points( const Mesh& mesh )
+    {
+        absl::FixedArray< geode::Point3D > points( mesh.nb_vertices() );
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            points[v] = mesh.point( v );
+        }
+        return points;
+    }
+
+    struct BlockSlice
+    {
+        std::vector< geode::Point2D > points;
+        std::vector< geode::StratigraphicPoint2D > stratigraphic_points;
+        std::vector< std::array< geode::index_t, 3 > > triangles;
+    };
+
+    struct SurfaceSlice
+    {
+        std::vector< geode::Point2D > points;
+        std::vector< std::array< geode::index_t, 2 > > edges;
+    };
+
+    double signed_area( const geode::Point2D& p0,
+        const geode::Point2D& p1,
+        const geode::Point2D& p2 )
+    {
+        return ( p1.value( 0 ) - p0.value( 0 ) )
+                   * ( p2.value( 1 ) - p0.value( 1 ) )
+               - ( p1.value( 1 ) - p0.value( 1 ) )
+                     * ( p2.value( 0 ) - p0.value( 0 ) );
+    }
+
+    /*!
+     * Keeps a single copy of the tetrahedron facets lying on the plane: the
+     * one of the tetrahedron above the plane, or the only one on the block
+     * boundary.
+     */
+    bool is_slice_owner( const geode::TetrahedralSolid3D& mesh,
+        const ElementSlicer& slicer,
+        geode::index_t tetrahedron,
+        const std::array< geode::index_t, 4 >& vertices )
+    {
+        for( const auto v : geode::LRange{ 4 } )
+        {
+            const auto distance = slicer.distance( vertices[v] );
+            if( distance == 0 )
+            {
+                continue;
+            }
+            return distance > 0
+                   || !mesh.polyhedron_adjacent( { tetrahedron, v } );
+        }
+        return false;
+    }
+
+    BlockSlice slice_block( const geode::StratigraphicModel& model,
+        const geode::Block3D& block,
+        const SliceFrame& frame )
+    {
+        const auto& mesh = block.mesh< geode::TetrahedralSolid3D >();
+        ElementSlicer slicer{ frame, mesh_points( mesh ) };
+        BlockSlice slice;
+        for( const auto t : geode::Range{ mesh.nb_polyhedra() } )
+        {
+            const auto vertices = mesh.polyhedron_vertices( t );
+            const std::array< geode::index_t, 4 > tetrahedron_vertices{
+                vertices[0], vertices[1], vertices[2], vertices[3]
+            };
+            const auto [nb_on_plane, nb_crossings] =
+                slicer.count( tetrahedron_vertices );
+            if( nb_on_plane + nb_crossings < 3 || nb_on_plane == 4 )
+            {
+                continue;
+            }
+            if( nb_on_plane == 3
+                && !is_slice_owner( mesh, slicer, t, tetrahedron_vertices ) )
+            {
+                continue;
+            }
+            const auto polygon = slicer.slice( tetrahedron_vertices );
+            for( auto v = slice.points.size();
+                 v < slicer.slice_vertices().size(); v++ )
+            {
+                slice.points.push_back(
+                    frame.project( slicer.point( geode::index_t( v ) ) ) );
+            }
+            auto ordered = polygon;
+            if( ordered.size() == 4 )
+            {
+                geode::Point2D center;
+                for( const auto v : ordered )
+                {
+                    center += slice.points[v] / 4.;
+                }
+                absl::c_sort( ordered, [&slice, &center]( geode::index_t a,
+                                           geode::index_t b ) {
+                    const auto angle = [&slice, &center]( geode::index_t v ) {
+                        return std::atan2(
+                            slice.points[v].value( 1 ) - center.value( 1 ),
+                            slice.points[v].value( 0 ) - center.value( 0 ) );
+                    };
+                    return angle( a ) < angle( b );
+                } );
+            }
+            for( geode::index_t v = 1; v + 1 < ordered.size(); v++ )
+            {
+                std::array< geode::index_t, 3 > triangle{ ordered[0],
+                    ordered[v], ordered[v + 1] };
+                if( signed_area( slice.points[triangle[0]],
+                        slice.points[triangle[1]], slice.points[triangle[2]] )
+                    < 0 )
+                {
+                    std::swap( triangle[1], triangle[2] );
+                }
+                slice.triangles.push_back( triangle );
+            }
+        }
+        const auto slice_vertices = slicer.slice_vertices();
+        slice.stratigraphic_points.reserve( slice_vertices.size() );
+        for( const auto& [key, ratio] : slice_vertices )
+        {
+            const auto point0 =
+                model.stratigraphic_coordinates( block, key.first );
+            const auto point1 =
+                model.stratigraphic_coordinates( block, key.second );
+            const auto location =
+                point0.stratigraphic_location() * ( 1. - ratio )
+                + point1.stratigraphic_location() * ratio;
+            slice.stratigraphic_points.emplace_back(
+                frame.project_location( location ),
+                point0.implicit_value() * ( 1. - ratio )
+                    + point1.implicit_value() * ratio );
+        }
+        return slice;
+    }
+
+    SurfaceSlice slice_surface(
+        const geode::Surface3D& surface, const SliceFrame& frame )
+    {
+        const auto& mesh = surface.mesh< geode::TriangulatedSurface3D >();
+        ElementSlicer slicer{ frame, mesh_points( mesh ) };
+        SurfaceSlice slice;
+        absl::flat_hash_set< std::array< geode::index_t, 2 > > edges;
+        for( const auto t : geode::Range{ mesh.nb_polygons() } )
+        {
+            const auto vertices = mesh.polygon_vertices( t );
+            const std::array< geode::index_t, 3 > triangle_vertices{
+                vertices[0], vertices[1], vertices[2]
+            };
+            const auto [nb_on_plane, nb_crossings] =
+                slicer.count( triangle_vertices );
+            if( nb_on_plane + nb_crossings != 2 )
+            {
+                continue;
+            }
+            const auto segment = slicer.slice( triangle_vertices );
+            std::array< geode::index_t, 2 > edge{ segment[0], segment[1] };
+            absl::c_sort( edge );
+            if( edges.insert( edge ).second )
+            {
+                slice.edges.push_back( edge );
+            }
+        }
+        for( const auto v : geode::Indices{ slicer.slice_vertices() } )
+        {
+            slice.points.push_back( frame.project( slicer.point( v ) ) );
+        }
+        return slice;
+    }
+
+    template < typename To, typename From >
+    To convert_type( From type )
+    {
+        return static_cast< To >(
+            static_cast< std::underlying_type_t< From > >( type ) );
+    }
+
+    geode::HorizonsStack2D slice_horizons_stack(
+        const geode::HorizonsStack3D& stack )
+    {
+        geode::HorizonsStack2D result;
+        geode::HorizonsStackBuilder2D builder{ result };
+        for( const auto& horizon : stack.horizons() )
+        {
+            builder.add_horizon( horizon.id() );
+            if( const auto name = horizon.name() )
+            {
+                builder.set_horizon_name(
+                    result.horizon( horizon.id() ), name.value() );
+            }
+        }
+        for( const auto& unit : stack.stratigraphic_units() )
+        {
+            builder.add_stratigraphic_unit( unit.id() );
+            if( const auto name = unit.name() )
+            {
+                builder.set_stratigraphic_unit_name(
+                    result.stratigraphic_unit( unit.id() ), name.value() );
+            }
+        }
+        for( const auto& horizon : stack.horizons() )
+        {
+            if( const auto under = stack.under( horizon.id() ) )
+            {
+                builder.set_horizon_above( result.horizon( horizon.id() ),
+                    result.stratigraphic_unit( under.value() ) );
+            }
+            if( const auto above = stack.above( horizon.id() ) )
+            {
+                builder.set_horizon_under( result.horizon( horizon.id() ),
+                    result.stratigraphic_unit( above.value() ) );
+            }
+        }
+        builder.compute_top_and_bottom_horizons();
+        return result;
+    }
+
+    class SectionFromSlices
+    {
+    public:
+        SectionFromSlices( const geode::StratigraphicModel& model,
+            geode::StratigraphicSection& section )
+            : model_( model ), section_( section ), builder_( section )
+        {
+        }
+
+        void add_surfaces( absl::Span< const geode::Block3D* const > blocks,
+            absl::Span< const BlockSlice > slices )
+        {
+            for( const auto b : geode::Indices{ blocks } )
+            {
+                const auto& slice = slices[b];
+                if( slice.triangles.empty() )
+                {
+                    continue;
+                }
+                const auto& surface_id = builder_.add_surface(
+                    geode::OpenGeodeTriangulatedSurface2D::impl_name_static() );
+                const auto& surface = section_.surface( surface_id );
+                auto mesh_builder = builder_.surface_mesh_builder( surface );
+                for( const auto& point : slice.points )
+                {
+                    mesh_builder->create_point( point );
+                }
+                for( const auto& triangle : slice.triangles )
+                {
+                    mesh_builder->create_polygon( triangle );
+                }
+                mesh_builder->compute_polygon_adjacencies();
+                block_surfaces_.emplace( blocks[b]->id(), surface_id );
+                surface_slices_.emplace( surface_id, &slice );
+            }
+        }
+
+        void add_lines( absl::Span< const geode::Surface3D* const > surfaces,
+            absl::Span< const SurfaceSlice > slices )
+        {
+            for( const auto s : geode::Indices{ surfaces } )
+            {
+                const auto& slice = slices[s];
+                if( slice.edges.empty() )
+                {
+                    continue;
+                }
+                const auto& line_id = builder_.add_line();
+                auto mesh_builder =
+                    builder_.line_mesh_builder( section_.line( line_id ) );
+                for( const auto& point : slice.points )
+                {
+                    mesh_builder->create_point( point );
+                }
+                for( const auto& edge : slice.edges )
+                {
+                    mesh_builder->create_edge( edge[0], edge[1] );
+                }
+                surface_lines_.emplace( surfaces[s]->id(), line_id );
+            }
+        }
+
+        void copy_geology()
+        {
+            for( const auto& horizon : model_.horizons() )
+            {
+                builder_.add_horizon( horizon.id(),
+                    convert_type< geode::Horizon2D::CONTACT_TYPE >(
+                        horizon.contact_type() ) );
+                const auto& section_horizon = section_.horizon( horizon.id() );
+                if( const auto name = horizon.name() )
+                {
+                    builder_.set_horizon_name( section_horizon, name.value() );
+                }
+                for( const auto& item : model_.horizon_items( horizon ) )
+                {
+                    if( const auto line = surface_lines_.find( item.id() );
+                        line != surface_lines_.end() )
+                    {
+                        builder_.add_line_in_horizon(
+                            section_.line( line->second ), section_horizon );
+                    }
+                }
+            }
+            for( const auto& fault : model_.faults() )
+            {
+                if( fault.has_type() )
+                {
+                    builder_.add_fault( fault.id(),
+                        convert_type< geode::Fault2D::FAULT_TYPE >(
+                            fault.type() ) );
+                }
+                else
+                {
+                    builder_.add_fault( fault.id() );
+                }
+                const auto& section_fault = section_.fault( fault.id() );
+                if( const auto name = fault.name() )
+                {
+                    builder_.set_fault_name( section_fault, name.value() );
+                }
+                for( const auto& item : model_.fault_items( fault ) )
+                {
+                    if( const auto line = surface_lines_.find( item.id() );
+                        line != surface_lines_.end() )
+                    {
+                        builder_.add_line_in_fault(
+                            section_.line( line->second ), section_fault );
+                    }
+                }
+            }
+            for( const auto& unit : model_.stratigraphic_units() )
+            {
+                builder_.add_stratigraphic_unit( unit.id() );
+                const auto& section_unit =
+                    section_.stratigraphic_unit( unit.id() );
+                if( const auto name = unit.name() )
+                {
+                    builder_.set_stratigraphic_unit_name(
+                        section_unit, name.value() );
+                }
+                for( const auto& item :
+                    model_.stratigraphic_unit_items( unit ) )
+                {
+                    if( const auto surface = block_surfaces_.find( item.id() );
+                        surface != block_surfaces_.end() )
+                    {
+                        builder_.add_surface_in_stratigraphic_unit(
+                            section_.surface( surface->second ), section_unit );
+                    }
+                }
+            }
+            for( const auto& fault_block : model_.fault_blocks() )
+            {
+                builder_.add_fault_block( fault_block.id() );
+                const auto& section_fault_block =
+                    section_.fault_block( fault_block.id() );
+                if( const auto name = fault_block.name() )
+                {
+                    builder_.set_fault_block_name(
+                        section_fault_block, name.value() );
+                }
+                for( const auto& item :
+                    model_.fault_block_items( fault_block ) )
+                {
+                    if( const auto surface = block_surfaces_.find( item.id() );
+                        surface != block_surfaces_.end() )
+                    {
+                        builder_.add_surface_in_fault_block(
+                            section_.surface( surface->second ),
+                            section_fault_block );
+                    }
+                }
+            }
+        }
+
+        void copy_implicit_information()
+        {
+            builder_.set_horizons_stack(
+                slice_horizons_stack( model_.horizons_stack() ) );
+            for( const auto& horizon : model_.horizons_stack().horizons() )
+            {
+                if( const auto value =
+                        model_.horizon_implicit_value( horizon ) )
+                {
+                    builder_.set_horizon_implicit_value(
+                        section_.horizons_stack().horizon( horizon.id() ),
+                        value.value() );
+                }
+            }
+            builder_.instantiate_stratigraphic_attribute_on_surfaces();
+            builder_.reinitialize_stratigraphic_query_trees();
+            for( const auto& [surface_id, slice] : surface_slices_ )
+            {
+                const auto& surface = section_.surface( surface_id );
+                for( const auto v :
+                    geode::Indices{ slice->stratigraphic_points } )
+                {
+                    builder_.set_stratigraphic_coordinates(
+                        surface, v, slice->stratigraphic_points[v] );
+                }
+            }
+        }
+
+    private:
+        const geode::StratigraphicModel& model_;
+        geode::StratigraphicSection& section_;
+        geode::StratigraphicSectionBuilder builder_;
+        absl::flat_hash_map< geode::uuid, geode::uuid > block_surfaces_;
+        absl::flat_hash_map< geode::uuid, geode::uuid > surface_lines_;
+        absl::flat_hash_map< geode::uuid, const BlockSlice* > surface_slices_;
+    };
+} // namespace
+
+namespace geode
+{
+    StratigraphicSection slice_stratigraphic_model(
+        const StratigraphicModel& model, const Plane& plane )
+    {
+        const SliceFrame frame{ plane };
+        std::vector< const Block3D* > blocks;
+        for( const auto& block : model.blocks() )
+        {
+            blocks.push_back( &block );
+        }
+        absl::flat_hash_set< uuid > geology_surface_ids;
+        for( const auto& horizon : model.horizons() )
+        {
+            for( const auto& item : model.horizon_items( horizon ) )
+            {
+                geology_surface_ids.insert( item.id() );
+            }
+        }
+        for( const auto& fault : model.faults() )
+        {
+            for( const auto& item : model.fault_items( fault ) )
+            {
+                geology_surface_ids.insert( item.id() );
+            }
+        }
+        std::vector< const Surface3D* > surfaces;
+        for( const auto& surface : model.surfaces() )
+        {
+            if( geology_surface_ids.contains( surface.id() ) )
+            {
+                surfaces.push_back( &surface );
+            }
+        }
+        absl::FixedArray< BlockSlice > block_slices( blocks.size() );
+        absl::FixedArray< SurfaceSlice > surface_slices( surfaces.size() );
+        async::parallel_invoke(
+            [&block_slices, &blocks, &model, &frame] {
+                async::parallel_for(
+                    async::irange( std::size_t{ 0 }, blocks.size() ),
+                    [&block_slices, &blocks, &model, &frame]( std::size_t b ) {
+                        block_slices[b] =
+                            slice_block( model, *blocks[b], frame );
+                    } );
+            },
+            [&surface_slices, &surfaces, &frame] {
+                async::parallel_for(
+                    async::irange( std::size_t{ 0 }, surfaces.size() ),
+                    [&surface_slices, &surfaces, &frame]( std::size_t s ) {
+                        surface_slices[s] =
+                            slice_surface( *surfaces[s], frame );
+                    } );
+            } );
+        StratigraphicSection section;
+        SectionFromSlices section_builder{ model, section };
+        section_builder.add_surfaces( blocks, block_slices );
+        section_builder.add_lines( surfaces, surface_slices );
+        section_builder.copy_geology();
+        section_builder.copy_implicit_information();
+        return section;
+    }
+} // namespace geode
@@ -23,6 +23,8 @@
 
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
 
+#include <geode/basic/logger.hpp>
+
 #include <geode/geosciences/explicit/mixin/core/horizon.hpp>
 #include <geode/geosciences/explicit/mixin/core/stratigraphic_unit.hpp>
 #include <geode/geosciences/explicit/representation/builder/detail/copy.hpp>
@@ -253,6 +255,40 @@ namespace geode
             typename HorizonsStack< dimension >::HorizonsStackBuilderKey() );
     }
 
+    template < index_t dimension >
+    void HorizonsStackBuilder< dimension >::end_batch_edition()
+    {
+        StratigraphicRelationshipsBuilder::end_batch_edition();
+        compute_top_and_bottom_horizons();
+    }
+
+    template < index_t dimension >
+    HorizonsStackBatchEdition< dimension >::HorizonsStackBatchEdition(
+        HorizonsStackBuilder< dimension >& builder )
+        : builder_( builder )
+    {
+        builder_.start_batch_edition();
+    }
+
+    template < index_t dimension >
+    HorizonsStackBatchEdition< dimension >::~HorizonsStackBatchEdition()
+    {
+        try
+        {
+            builder_.end_batch_edition();
+        }
+        catch( const std::exception& exception )
+        {
+            Logger::error( "[HorizonsStackBatchEdition] Error while ending "
+                           "batch edition: ",
+                exception.what() );
+        }
+    }
+
     template class opengeode_geosciences_implicit_api HorizonsStackBuilder< 2 >;
     template class opengeode_geosciences_implicit_api HorizonsStackBuilder< 3 >;
+    template class opengeode_geosciences_implicit_api
+        HorizonsStackBatchEdition< 2 >;
+    template class opengeode_geosciences_implicit_api
+        HorizonsStackBatchEdition< 3 >;
 } // namespace geode
@@ -29,6 +29,7 @@
 #include <geode/model/representation/builder/detail/copy.hpp>
 
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/query_tree_boxes.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_cross_section.hpp>
 
@@ -116,6 +117,8 @@ namespace geode
                 ImplicitCrossSection::ImplicitCrossSectionBuilderKey{} )
         }
             .copy( mapping, other_model.horizons_stack() );
+        set_implicit_value_transform( other_model.implicit_value_scale(),
+            other_model.implicit_value_offset() );
         const auto& horizon_mapping =
             mapping.at( Horizon2D::component_type_static() );
         for( const auto& horizon : other_model.horizons() )
@@ -168,6 +171,14 @@ namespace geode
             ImplicitCrossSection::ImplicitCrossSectionBuilderKey{} );
     }
 
+    void ImplicitCrossSectionBuilder::set_implicit_query_tree_boxes(
+        const Surface2D& surface, detail::QueryTreeBoxes2D&& polygon_boxes )
+    {
+        implicit_section_.set_implicit_query_tree_boxes( surface,
+            std::move( polygon_boxes ),
+            ImplicitCrossSection::ImplicitCrossSectionBuilderKey{} );
+    }
+
     void ImplicitCrossSectionBuilder::
         instantiate_implicit_attribute_on_surfaces()
     {
@@ -182,6 +193,19 @@ namespace geode
             ImplicitCrossSection::ImplicitCrossSectionBuilderKey{} );
     }
 
+    void ImplicitCrossSectionBuilder::set_implicit_value_transform(
+        double scale, double offset )
+    {
+        implicit_section_.set_implicit_value_transform( scale, offset,
+            ImplicitCrossSection::ImplicitCrossSectionBuilderKey{} );
+    }
+
+    void ImplicitCrossSectionBuilder::bake_implicit_value_transform()
+    {
+        implicit_section_.bake_implicit_value_transform(
+            ImplicitCrossSection::ImplicitCrossSectionBuilderKey{} );
+    }
+
     void ImplicitCrossSectionBuilder::set_horizons_stack(
         HorizonsStack2D&& stack )
     {
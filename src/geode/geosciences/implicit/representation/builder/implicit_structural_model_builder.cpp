@@ -31,9 +31,49 @@
 #include <geode/model/representation/builder/detail/copy.hpp>
 
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/query_tree_boxes.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
 
+namespace
+{
+    template < typename StoredType, typename ValueGetter >
+    void set_stored_implicit_values( geode::AttributeManager& manager,
+        const geode::uuid& attribute_id,
+        geode::index_t nb_vertices,
+        const ValueGetter& value )
+    {
+        auto attribute =
+            manager.find_attribute< geode::VariableAttribute, StoredType >(
+                attribute_id );
+        for( const auto vertex : geode::Range{ nb_vertices } )
+        {
+            attribute->set_value(
+                vertex, static_cast< StoredType >( value( vertex ) ) );
+        }
+    }
+
+    template < typename ValueGetter >
+    void set_stored_implicit_values(
+        const geode::ImplicitStructuralModel& implicit_model,
+        const geode::Block3D& block,
+        const ValueGetter& value )
+    {
+        auto& manager = block.mesh().vertex_attribute_manager();
+        const auto nb_vertices = block.mesh().nb_vertices();
+        if( implicit_model.implicit_value_precision()
+            == geode::ImplicitStructuralModel::STORAGE_PRECISION::
+                single_precision )
+        {
+            set_stored_implicit_values< float >( manager,
+                implicit_model.implicit_attribute_id(), nb_vertices, value );
+            return;
+        }
+        set_stored_implicit_values< double >( manager,
+            implicit_model.implicit_attribute_id(), nb_vertices, value );
+    }
+} // namespace
+
 namespace geode
 {
     ImplicitStructuralModelBuilder::ImplicitStructuralModelBuilder(
@@ -69,16 +109,13 @@ namespace geode
             const auto old_attribute =
                 block_vertex_attribute_manager
                     .find_read_only_attribute< double >( old_attribute_id );
-            auto new_attribute =
-                block_vertex_attribute_manager
-                    .find_attribute< VariableAttribute, double >(
-                        implicit_model_.implicit_attribute_id() );
-            for( const auto vertex :
-                geode::Range{ block.mesh().nb_vertices() } )
-            {
-                new_attribute->set_value(
-                    vertex, old_attribute->value( vertex ) );
-            }
+            set_stored_implicit_values(
+                implicit_model_, block, [&old_attribute]( index_t vertex ) {
+                    return old_attribute->value( vertex );
+                } );
+            implicit_model_.notify_block_implicit_values_change( block,
+                typename ImplicitStructuralModel::
+                    ImplicitStructuralModelBuilderKey{} );
         }
     }
 
@@ -89,6 +126,9 @@ namespace geode
                                     typename ImplicitStructuralModel::
                                         ImplicitStructuralModelBuilderKey{} ) }
             .copy( mapping, other_model.horizons_stack() );
+        set_implicit_value_transform( other_model.implicit_value_scale(),
+            other_model.implicit_value_offset() );
+        set_implicit_value_precision( other_model.implicit_value_precision() );
         const auto& horizon_mapping =
             mapping.at( Horizon3D::component_type_static() );
         for( const auto& horizon : other_model.horizons_stack().horizons() )
@@ -114,26 +154,16 @@ namespace geode
             mapping.at( Block3D::component_type_static() );
         for( const auto& old_block : other_model.blocks() )
         {
-            auto& old_block_vertex_attribute_manager =
-                old_block.mesh().vertex_attribute_manager();
-            const auto old_attribute =
-                old_block_vertex_attribute_manager
-                    .find_read_only_attribute< double >(
-                        other_model.implicit_attribute_id() );
-            auto& new_block =
+            const auto& new_block =
                 implicit_model_.block( block_mapping.in2out( old_block.id() ) );
-            auto& new_block_vertex_attribute_manager =
-                new_block.mesh().vertex_attribute_manager();
-            auto new_attribute =
-                new_block_vertex_attribute_manager
-                    .find_attribute< VariableAttribute, double >(
-                        implicit_model_.implicit_attribute_id() );
-            for( const auto vertex :
-                geode::Range{ new_block.mesh().nb_vertices() } )
-            {
-                new_attribute->set_value(
-                    vertex, old_attribute->value( vertex ) );
-            }
+            set_stored_implicit_values( implicit_model_, new_block,
+                [&other_model, &old_block]( index_t vertex ) {
+                    return other_model.stored_implicit_value(
+                        old_block, vertex );
+                } );
+            implicit_model_.notify_block_implicit_values_change( new_block,
+                typename ImplicitStructuralModel::
+                    ImplicitStructuralModelBuilderKey{} );
         }
     }
 
@@ -144,6 +174,31 @@ namespace geode
                 ImplicitStructuralModelBuilderKey{} );
     }
 
+    void ImplicitStructuralModelBuilder::set_implicit_query_tree_boxes(
+        const Block3D& block, detail::QueryTreeBoxes3D&& polyhedron_boxes )
+    {
+        implicit_model_.set_implicit_query_tree_boxes( block,
+            std::move( polyhedron_boxes ),
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::set_stratigraphic_query_tree_boxes(
+        const Block3D& block, detail::QueryTreeBoxes3D&& polyhedron_boxes )
+    {
+        implicit_model_.set_stratigraphic_query_tree_boxes( block,
+            std::move( polyhedron_boxes ),
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::compute_stratigraphic_unit_labels()
+    {
+        implicit_model_.compute_stratigraphic_unit_labels(
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
     void ImplicitStructuralModelBuilder::
         instantiate_implicit_attribute_on_blocks()
     {
@@ -160,6 +215,65 @@ namespace geode
                 ImplicitStructuralModelBuilderKey{} );
     }
 
+    void ImplicitStructuralModelBuilder::set_block_stored_implicit_values(
+        const Block3D& block, absl::Span< const double > values )
+    {
+        OpenGeodeGeosciencesImplicitException::check_exception(
+            values.size() == block.mesh().nb_vertices(), nullptr,
+            OpenGeodeException::TYPE::data,
+            "[ImplicitStructuralModelBuilder::set_block_stored_implicit_"
+            "values] Wrong number of values for Block ",
+            block.id().string() );
+        set_stored_implicit_values(
+            implicit_model_, block, [&values]( index_t vertex ) {
+                return values[vertex];
+            } );
+        implicit_model_.notify_block_implicit_values_change( block,
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::notify_block_mesh_change(
+        const Block3D& block )
+    {
+        implicit_model_.notify_block_mesh_change( block,
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::map_implicit_values(
+        const Block3D& block,
+        absl::Span< const double > values,
+        std::shared_ptr< const void > owner )
+    {
+        implicit_model_.map_implicit_values( block, values, std::move( owner ),
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::set_implicit_value_transform(
+        double scale, double offset )
+    {
+        implicit_model_.set_implicit_value_transform( scale, offset,
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::bake_implicit_value_transform()
+    {
+        implicit_model_.bake_implicit_value_transform(
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
+    void ImplicitStructuralModelBuilder::set_implicit_value_precision(
+        IMPLICIT_STORAGE_PRECISION precision )
+    {
+        implicit_model_.set_implicit_value_precision( precision,
+            typename ImplicitStructuralModel::
+                ImplicitStructuralModelBuilderKey{} );
+    }
+
     void ImplicitStructuralModelBuilder::set_horizons_stack(
         HorizonsStack3D&& stack )
     {
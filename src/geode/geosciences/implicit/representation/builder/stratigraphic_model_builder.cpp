@@ -87,6 +87,13 @@ namespace geode
             StratigraphicModel::StratigraphicModelBuilderKey{} );
     }
 
+    void StratigraphicModelBuilder::set_interleaved_stratigraphic_coordinates(
+        bool use )
+    {
+        stratigraphic_model_.set_interleaved_stratigraphic_coordinates(
+            use, StratigraphicModel::StratigraphicModelBuilderKey{} );
+    }
+
     void StratigraphicModelBuilder::
         import_old_stratigraphic_attribute_values_from_attribute_name(
             std::string_view old_attribute_name )
@@ -113,6 +120,8 @@ namespace geode
                     vertex, old_attribute->value( vertex ) );
             }
         }
+        stratigraphic_model_.notify_stratigraphic_locations_change(
+            StratigraphicModel::StratigraphicModelBuilderKey{} );
     }
 
     void StratigraphicModelBuilder::copy_stratigraphic_attribute_values(
@@ -144,6 +153,8 @@ namespace geode
                     vertex, old_attribute->value( vertex ) );
             }
         }
+        stratigraphic_model_.notify_stratigraphic_locations_change(
+            StratigraphicModel::StratigraphicModelBuilderKey{} );
     }
 
 } // namespace geode
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/core/batch_queries.hpp>
+
+#include <limits>
+
+#include <async++.h>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_section.hpp>
+
+namespace
+{
+    constexpr auto NO_VALUE = std::numeric_limits< double >::quiet_NaN();
+
+    template < geode::index_t dimension >
+    geode::Point< dimension > no_point()
+    {
+        geode::Point< dimension > point;
+        for( const auto d : geode::LRange{ dimension } )
+        {
+            point.set_value( d, NO_VALUE );
+        }
+        return point;
+    }
+
+    template < geode::index_t dimension >
+    geode::StratigraphicPoint< dimension > no_stratigraphic_point()
+    {
+        return { no_point< dimension - 1 >(), NO_VALUE };
+    }
+
+    /*!
+     * Evaluates the query on each input in parallel. The lazily built query
+     * trees are computed beforehand, in parallel, so that no query of the
+     * loop has to build them.
+     */
+    template < typename Input,
+        typename Output,
+        typename ComputeTrees,
+        typename Query >
+    void run_batch( absl::Span< const Input > inputs,
+        absl::Span< Output > outputs,
+        const ComputeTrees& compute_query_trees,
+        const Query& query )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
+            inputs.size() == outputs.size(), nullptr,
+            geode::OpenGeodeException::TYPE::data,
+            "[batch_queries] Output size (", outputs.size(),
+            ") differs from input size (", inputs.size(), ")." );
+        if( inputs.empty() )
+        {
+            return;
+        }
+        compute_query_trees();
+        async::parallel_for(
+            async::irange( std::size_t{ 0 }, inputs.size() ),
+            [&inputs, &outputs, &query]( std::size_t i ) {
+                outputs[i] = query( inputs[i] );
+            } );
+    }
+} // namespace
+
+namespace geode
+{
+    void batch_implicit_values( const ImplicitStructuralModel& model,
+        const Block3D& block,
+        absl::Span< const Point3D > points,
+        absl::Span< double > values )
+    {
+        run_batch(
+            points, values,
+            [&model] {
+                model.compute_implicit_query_trees();
+            },
+            [&model, &block]( const Point3D& point ) {
+                return model.implicit_value( block, point )
+                    .value_or( NO_VALUE );
+            } );
+    }
+
+    void batch_implicit_values( const ImplicitCrossSection& section,
+        const Surface2D& surface,
+        absl::Span< const Point2D > points,
+        absl::Span< double > values )
+    {
+        run_batch(
+            points, values,
+            [&section] {
+                section.compute_implicit_query_trees();
+            },
+            [&section, &surface]( const Point2D& point ) {
+                return section.implicit_value( surface, point )
+                    .value_or( NO_VALUE );
+            } );
+    }
+
+    void block_implicit_values( const ImplicitStructuralModel& model,
+        const Block3D& block,
+        absl::Span< double > values )
+    {
+        const auto nb_vertices = block.mesh().nb_vertices();
+        OpenGeodeGeosciencesImplicitException::check_exception(
+            values.size() == nb_vertices, nullptr,
+            OpenGeodeException::TYPE::data,
+            "[block_implicit_values] Output size (", values.size(),
+            ") differs from the number of block vertices (", nb_vertices,
+            ")." );
+        async::parallel_for( async::irange( index_t{ 0 }, nb_vertices ),
+            [&values, &model, &block]( index_t v ) {
+                values[v] = model.implicit_value( block, v );
+            } );
+    }
+
+    void batch_stratigraphic_coordinates( const StratigraphicModel& model,
+        const Block3D& block,
+        absl::Span< const Point3D > points,
+        absl::Span< StratigraphicPoint3D > stratigraphic_points )
+    {
+        run_batch( points, stratigraphic_points,
+            [&model] {
+                model.compute_stratigraphic_query_trees();
+            },
+            [&model, &block]( const Point3D& point ) {
+                return model.stratigraphic_coordinates( block, point )
+                    .value_or( no_stratigraphic_point< 3 >() );
+            } );
+    }
+
+    void batch_stratigraphic_coordinates( const StratigraphicSection& section,
+        const Surface2D& surface,
+        absl::Span< const Point2D > points,
+        absl::Span< StratigraphicPoint2D > stratigraphic_points )
+    {
+        run_batch( points, stratigraphic_points,
+            [&section] {
+                section.compute_stratigraphic_query_trees();
+            },
+            [&section, &surface]( const Point2D& point ) {
+                return section.stratigraphic_coordinates( surface, point )
+                    .value_or( no_stratigraphic_point< 2 >() );
+            } );
+    }
+
+    void batch_geometric_coordinates( const StratigraphicModel& model,
+        const Block3D& block,
+        absl::Span< const StratigraphicPoint3D > stratigraphic_points,
+        absl::Span< Point3D > points )
+    {
+        run_batch( stratigraphic_points, points,
+            [&model] {
+                model.compute_stratigraphic_query_trees();
+            },
+            [&model, &block]( const StratigraphicPoint3D& point ) {
+                return model.geometric_coordinates( block, point )
+                    .value_or( no_point< 3 >() );
+            } );
+    }
+
+    void batch_geometric_coordinates( const StratigraphicSection& section,
+        const Surface2D& surface,
+        absl::Span< const StratigraphicPoint2D > stratigraphic_points,
+        absl::Span< Point2D > points )
+    {
+        run_batch( stratigraphic_points, points,
+            [&section] {
+                section.compute_stratigraphic_query_trees();
+            },
+            [&section, &surface]( const StratigraphicPoint2D& point ) {
+                return section.geometric_coordinates( surface, point )
+                    .value_or( no_point< 2 >() );
+            } );
+    }
+} // namespace geode
@@ -23,6 +23,12 @@
 
 #include <geode/geosciences/implicit/representation/core/detail/helpers.hpp>
 
+#include <functional>
+
+#include <absl/strings/str_cat.h>
+
+#include <async++.h>
+
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/variable_attribute.hpp>
 
@@ -73,6 +79,70 @@ namespace
             "units compared to horizons (",
             nb_units, ", should be less than ", nb_horizons, ")" );
     }
+
+    /*!
+     * Builds the block mesh in stratigraphic space with the geometric
+     * coordinates in the "geode_xyz" attribute. Only the vertices, the
+     * tetrahedra and their adjacencies are copied from the block mesh, not
+     * its other attributes.
+     */
+    std::unique_ptr< geode::TetrahedralSolid3D > stratigraphic_block_mesh(
+        const geode::StratigraphicModel& model, const geode::Block3D& block )
+    {
+        const auto& block_mesh = block.mesh< geode::TetrahedralSolid3D >();
+        auto strati_solid = geode::TetrahedralSolid3D::create();
+        auto builder =
+            geode::TetrahedralSolidBuilder3D::create( *strati_solid );
+        builder->create_vertices( block_mesh.nb_vertices() );
+        geode::AttributeValues< geode::Point3D > xyz_attribute_default_values;
+        xyz_attribute_default_values.default_value = geode::Point3D{};
+        xyz_attribute_default_values.no_value = geode::Point3D{};
+        geode::AttributeProperties xyz_attribute_properties;
+        xyz_attribute_properties.assignable = false;
+        xyz_attribute_properties.interpolable = true;
+        xyz_attribute_properties.transferable = true;
+        const auto xyz_attribute_id =
+            strati_solid->vertex_attribute_manager()
+                .create_attribute< geode::VariableAttribute, geode::Point3D >(
+                    "geode_xyz", xyz_attribute_default_values,
+                    xyz_attribute_properties );
+        auto xyz_attribute =
+            strati_solid->vertex_attribute_manager()
+                .find_attribute< geode::VariableAttribute, geode::Point3D >(
+                    xyz_attribute_id );
+        async::parallel_for(
+            async::irange( geode::index_t{ 0 }, block_mesh.nb_vertices() ),
+            [&model, &block, &block_mesh, &builder, &xyz_attribute](
+                geode::index_t vertex_id ) {
+                xyz_attribute->set_value(
+                    vertex_id, block_mesh.point( vertex_id ) );
+                builder->set_point( vertex_id,
+                    model.stratigraphic_coordinates( block, vertex_id )
+                        .stratigraphic_coordinates() );
+            } );
+        const auto nb_polyhedra = block_mesh.nb_polyhedra();
+        for( const auto polyhedron_id : geode::Range{ nb_polyhedra } )
+        {
+            builder->create_tetrahedron(
+                { block_mesh.polyhedron_vertex( { polyhedron_id, 0 } ),
+                    block_mesh.polyhedron_vertex( { polyhedron_id, 1 } ),
+                    block_mesh.polyhedron_vertex( { polyhedron_id, 2 } ),
+                    block_mesh.polyhedron_vertex( { polyhedron_id, 3 } ) } );
+        }
+        for( const auto polyhedron_id : geode::Range{ nb_polyhedra } )
+        {
+            for( const auto f : geode::LRange{ 4 } )
+            {
+                if( const auto adjacent = block_mesh.polyhedron_adjacent(
+                        { polyhedron_id, f } ) )
+                {
+                    builder->set_polyhedron_adjacent(
+                        { polyhedron_id, f }, adjacent.value() );
+                }
+            }
+        }
+        return strati_solid;
+    }
 } // namespace
 
 namespace geode
@@ -83,16 +153,9 @@ namespace geode
             ImplicitCrossSection& section, double scaling_factor )
         {
             ImplicitCrossSectionBuilder builder{ section };
-            for( const auto& surface : section.surfaces() )
-            {
-                for( const auto vertex_id :
-                    Range{ surface.mesh().nb_vertices() } )
-                {
-                    builder.set_implicit_value( surface, vertex_id,
-                        scaling_factor
-                            * section.implicit_value( surface, vertex_id ) );
-                }
-            }
+            builder.set_implicit_value_transform(
+                scaling_factor * section.implicit_value_scale(),
+                scaling_factor * section.implicit_value_offset() );
         }
 
         void rescale_implicit_value_to_bbox_scale(
@@ -113,16 +176,9 @@ namespace geode
             ImplicitStructuralModel& model, double scaling_factor )
         {
             ImplicitStructuralModelBuilder builder{ model };
-            for( const auto& block : model.blocks() )
-            {
-                for( const auto vertex_id :
-                    Range{ block.mesh().nb_vertices() } )
-                {
-                    builder.set_implicit_value( block, vertex_id,
-                        scaling_factor
-                            * model.implicit_value( block, vertex_id ) );
-                }
-            }
+            builder.set_implicit_value_transform(
+                scaling_factor * model.implicit_value_scale(),
+                scaling_factor * model.implicit_value_offset() );
         }
 
         void rescale_implicit_value_to_bbox_scale( StratigraphicModel& model )
@@ -183,42 +239,36 @@ namespace geode
         void save_stratigraphic_blocks(
             const StratigraphicModel& implicit_model, std::string_view prefix )
         {
-            index_t counter{ 0 };
+            save_stratigraphic_blocks( implicit_model, prefix, "og_tso3d" );
+        }
+
+        void save_stratigraphic_blocks(
+            const StratigraphicModel& implicit_model,
+            std::string_view prefix,
+            std::string_view extension )
+        {
+            std::vector< std::reference_wrapper< const Block3D > > blocks;
             for( const auto& block : implicit_model.blocks() )
             {
-                auto strati_solid = block.mesh< TetrahedralSolid3D >().clone();
-                auto surface_builder =
-                    TetrahedralSolidBuilder3D::create( *strati_solid );
-                AttributeValues< Point3D > xyz_attribute_default_values;
-                xyz_attribute_default_values.default_value = Point3D{};
-                xyz_attribute_default_values.no_value = Point3D{};
-                AttributeProperties xyz_attribute_properties;
-                xyz_attribute_properties.assignable = false;
-                xyz_attribute_properties.interpolable = true;
-                xyz_attribute_properties.transferable = true;
-                auto xyz_attribute_id =
-                    strati_solid->vertex_attribute_manager()
-                        .create_attribute< VariableAttribute, Point3D >(
-                            "geode_xyz", xyz_attribute_default_values,
-                            xyz_attribute_properties );
-                auto xyz_attribute =
-                    strati_solid->vertex_attribute_manager()
-                        .find_attribute< VariableAttribute, Point3D >(
-                            xyz_attribute_id );
-                for( const auto pt_id : Range{ strati_solid->nb_vertices() } )
-                {
-                    xyz_attribute->set_value(
-                        pt_id, strati_solid->point( pt_id ) );
-                    const auto strati_coords =
-                        implicit_model.stratigraphic_coordinates(
-                            block, pt_id );
-                    surface_builder->set_point(
-                        pt_id, strati_coords.stratigraphic_coordinates() );
-                }
-                save_tetrahedral_solid( *strati_solid,
-                    absl::StrCat( prefix, counter, ".og_tso3d" ) );
-                counter++;
+                OpenGeodeGeosciencesImplicitException::check_exception(
+                    block.mesh().type_name()
+                        == TetrahedralSolid3D::type_name_static(),
+                    nullptr, OpenGeodeException::TYPE::data,
+                    "[save_stratigraphic_blocks] Blocks must be meshed as "
+                    "TetrahedralSolids, which is not the case for block with "
+                    "uuid '",
+                    block.id().string(), "'." );
+                blocks.emplace_back( block );
             }
+            async::parallel_for(
+                async::irange( std::size_t{ 0 }, blocks.size() ),
+                [&blocks, &implicit_model, &prefix, &extension](
+                    std::size_t b ) {
+                    save_tetrahedral_solid(
+                        *stratigraphic_block_mesh(
+                            implicit_model, blocks[b].get() ),
+                        absl::StrCat( prefix, b, ".", extension ) );
+                } );
         }
 
         ImplicitCrossSection implicit_section_from_cross_section_scalar_field(
@@ -370,42 +420,45 @@ namespace geode
                     stack.stratigraphic_unit( only_su ), units_names[0] );
                 return stack;
             }
-            auto current_horizon = builder.add_horizon();
-            builder.set_horizon_name(
-                stack.horizon( current_horizon ), horizons_names[0] );
-            const auto& su_above = builder.add_stratigraphic_unit();
-            builder.set_horizon_under( stack.horizon( current_horizon ),
-                stack.stratigraphic_unit( su_above ) );
-            bool highest_unit_to_create{ nb_units < nb_horizons };
-            if( !highest_unit_to_create )
             {
-                builder.set_stratigraphic_unit_name(
-                    stack.stratigraphic_unit( su_above ), units_names[0] );
-            }
-            for( const auto counter : Range{ 1, horizons_names.size() } )
-            {
-                const auto& su_under = builder.add_stratigraphic_unit();
-                builder.set_stratigraphic_unit_name(
-                    stack.stratigraphic_unit( su_under ),
-                    units_names[highest_unit_to_create ? counter - 1
-                                                       : counter] );
-                builder.set_horizon_above( stack.horizon( current_horizon ),
-                    stack.stratigraphic_unit( su_under ) );
-                current_horizon = builder.add_horizon();
+                HorizonsStackBatchEdition< dimension > batch_edition{ builder };
+                auto current_horizon = builder.add_horizon();
                 builder.set_horizon_name(
-                    stack.horizon( current_horizon ), horizons_names[counter] );
+                    stack.horizon( current_horizon ), horizons_names[0] );
+                const auto& su_above = builder.add_stratigraphic_unit();
                 builder.set_horizon_under( stack.horizon( current_horizon ),
+                    stack.stratigraphic_unit( su_above ) );
+                bool highest_unit_to_create{ nb_units < nb_horizons };
+                if( !highest_unit_to_create )
+                {
+                    builder.set_stratigraphic_unit_name(
+                        stack.stratigraphic_unit( su_above ), units_names[0] );
+                }
+                for( const auto counter : Range{ 1, horizons_names.size() } )
+                {
+                    const auto& su_under = builder.add_stratigraphic_unit();
+                    builder.set_stratigraphic_unit_name(
+                        stack.stratigraphic_unit( su_under ),
+                        units_names[highest_unit_to_create ? counter - 1
+                                                           : counter] );
+                    builder.set_horizon_above( stack.horizon( current_horizon ),
+                        stack.stratigraphic_unit( su_under ) );
+                    current_horizon = builder.add_horizon();
+                    builder.set_horizon_name( stack.horizon( current_horizon ),
+                        horizons_names[counter] );
+                    builder.set_horizon_under( stack.horizon( current_horizon ),
+                        stack.stratigraphic_unit( su_under ) );
+                }
+                const auto& su_under = builder.add_stratigraphic_unit();
+                builder.set_horizon_above( stack.horizon( current_horizon ),
                     stack.stratigraphic_unit( su_under ) );
+                if( nb_units > nb_horizons )
+                {
+                    builder.set_stratigraphic_unit_name(
+                        stack.stratigraphic_unit( su_under ),
+                        units_names.back() );
+                }
             }
-            const auto& su_under = builder.add_stratigraphic_unit();
-            builder.set_horizon_above( stack.horizon( current_horizon ),
-                stack.stratigraphic_unit( su_under ) );
-            if( nb_units > nb_horizons )
-            {
-                builder.set_stratigraphic_unit_name(
-                    stack.stratigraphic_unit( su_under ), units_names.back() );
-            }
-            builder.compute_top_and_bottom_horizons();
             return stack;
         }
 
@@ -427,42 +480,45 @@ namespace geode
                     stack.stratigraphic_unit( only_su ), units_names[0] );
                 return stack;
             }
-            auto current_horizon = builder.add_horizon();
-            builder.set_horizon_name(
-                stack.horizon( current_horizon ), horizons_names[0] );
-            const auto& su_under = builder.add_stratigraphic_unit();
-            builder.set_horizon_above( stack.horizon( current_horizon ),
-                stack.stratigraphic_unit( su_under ) );
-            bool lowest_unit_to_create{ nb_units < nb_horizons };
-            if( !lowest_unit_to_create )
             {
-                builder.set_stratigraphic_unit_name(
-                    stack.stratigraphic_unit( su_under ), units_names[0] );
-            }
-            for( const auto counter : Range{ 1, horizons_names.size() } )
-            {
-                const auto& su_above = builder.add_stratigraphic_unit();
-                builder.set_stratigraphic_unit_name(
-                    stack.stratigraphic_unit( su_above ),
-                    units_names[lowest_unit_to_create ? counter - 1
-                                                      : counter] );
-                builder.set_horizon_under( stack.horizon( current_horizon ),
-                    stack.stratigraphic_unit( su_above ) );
-                current_horizon = builder.add_horizon();
+                HorizonsStackBatchEdition< dimension > batch_edition{ builder };
+                auto current_horizon = builder.add_horizon();
                 builder.set_horizon_name(
-                    stack.horizon( current_horizon ), horizons_names[counter] );
+                    stack.horizon( current_horizon ), horizons_names[0] );
+                const auto& su_under = builder.add_stratigraphic_unit();
                 builder.set_horizon_above( stack.horizon( current_horizon ),
+                    stack.stratigraphic_unit( su_under ) );
+                bool lowest_unit_to_create{ nb_units < nb_horizons };
+                if( !lowest_unit_to_create )
+                {
+                    builder.set_stratigraphic_unit_name(
+                        stack.stratigraphic_unit( su_under ), units_names[0] );
+                }
+                for( const auto counter : Range{ 1, horizons_names.size() } )
+                {
+                    const auto& su_above = builder.add_stratigraphic_unit();
+                    builder.set_stratigraphic_unit_name(
+                        stack.stratigraphic_unit( su_above ),
+                        units_names[lowest_unit_to_create ? counter - 1
+                                                          : counter] );
+                    builder.set_horizon_under( stack.horizon( current_horizon ),
+                        stack.stratigraphic_unit( su_above ) );
+                    current_horizon = builder.add_horizon();
+                    builder.set_horizon_name( stack.horizon( current_horizon ),
+                        horizons_names[counter] );
+                    builder.set_horizon_above( stack.horizon( current_horizon ),
+                        stack.stratigraphic_unit( su_above ) );
+                }
+                const auto& su_above = builder.add_stratigraphic_unit();
+                builder.set_horizon_under( stack.horizon( current_horizon ),
                     stack.stratigraphic_unit( su_above ) );
+                if( nb_units > nb_horizons )
+                {
+                    builder.set_stratigraphic_unit_name(
+                        stack.stratigraphic_unit( su_above ),
+                        units_names.back() );
+                }
             }
-            const auto& su_above = builder.add_stratigraphic_unit();
-            builder.set_horizon_under( stack.horizon( current_horizon ),
-                stack.stratigraphic_unit( su_above ) );
-            if( nb_units > nb_horizons )
-            {
-                builder.set_stratigraphic_unit_name(
-                    stack.stratigraphic_unit( su_above ), units_names.back() );
-            }
-            builder.compute_top_and_bottom_horizons();
             return stack;
         }
 
@@ -476,13 +532,8 @@ namespace geode
                 nb_horizons, horizon_stack.nb_stratigraphic_units() );
             builder.compute_top_and_bottom_horizons();
             const auto bottom_horizon = horizon_stack.bottom_horizon().value();
-            if( !horizon_stack.under( bottom_horizon ) )
-            {
-                const auto& unit_under = builder.add_stratigraphic_unit();
-                builder.set_horizon_above(
-                    horizon_stack.horizon( bottom_horizon ),
-                    horizon_stack.stratigraphic_unit( unit_under ) );
-            }
+            const auto missing_unit_under =
+                !horizon_stack.under( bottom_horizon ).has_value();
             index_t horizon_counter{ 1 };
             auto su_above = horizon_stack.above( bottom_horizon );
             std::optional< uuid > current_horizon = bottom_horizon;
@@ -502,6 +553,14 @@ namespace geode
                 "[repair_horizon_stack_if_possible] Missing or wrong "
                 "above/under relations between horizons and stratigraphic "
                 "units." );
+            HorizonsStackBatchEdition< dimension > batch_edition{ builder };
+            if( missing_unit_under )
+            {
+                const auto& unit_under = builder.add_stratigraphic_unit();
+                builder.set_horizon_above(
+                    horizon_stack.horizon( bottom_horizon ),
+                    horizon_stack.stratigraphic_unit( unit_under ) );
+            }
             if( !su_above )
             {
                 const auto& unit_above = builder.add_stratigraphic_unit();
@@ -516,14 +575,7 @@ namespace geode
             const HorizonsStack< dimension >& horizon_stack,
             absl::string_view horizon_name )
         {
-            for( const auto& horizon : horizon_stack.horizons() )
-            {
-                if( horizon.name() == horizon_name )
-                {
-                    return horizon.id();
-                }
-            }
-            return std::nullopt;
+            return horizon_stack.horizon_id_from_name( horizon_name );
         }
 
         template < index_t dimension >
@@ -531,14 +583,7 @@ namespace geode
             const HorizonsStack< dimension >& horizon_stack,
             absl::string_view unit_name )
         {
-            for( const auto& unit : horizon_stack.stratigraphic_units() )
-            {
-                if( unit.name() == unit_name )
-                {
-                    return unit.id();
-                }
-            }
-            return std::nullopt;
+            return horizon_stack.stratigraphic_unit_id_from_name( unit_name );
         }
 
         std::vector< MeshElement > invalid_stratigraphic_tetrahedra(
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/core/detail/stratigraphic_unit_intervals.hpp>
+
+#include <geode/basic/range.hpp>
+
+#include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        StratigraphicUnitIntervals stratigraphic_unit_intervals(
+            const ImplicitStructuralModel& model )
+        {
+            StratigraphicUnitIntervals intervals;
+            auto& isovalues = intervals.isovalues;
+            for( const auto& horizon : model.horizons_stack().horizons() )
+            {
+                if( const auto isovalue =
+                        model.horizon_implicit_value( horizon ) )
+                {
+                    isovalues.push_back( isovalue.value() );
+                }
+            }
+            absl::c_sort( isovalues );
+            if( isovalues.empty() )
+            {
+                intervals.units.emplace_back();
+                return intervals;
+            }
+            intervals.units.reserve( isovalues.size() + 1 );
+            intervals.units.push_back(
+                model.containing_stratigraphic_unit( isovalues.front() - 1. ) );
+            for( const auto i :
+                Range{ 1, static_cast< index_t >( isovalues.size() ) } )
+            {
+                intervals.units.push_back( model.containing_stratigraphic_unit(
+                    ( isovalues[i - 1] + isovalues[i] ) / 2. ) );
+            }
+            intervals.units.push_back(
+                model.containing_stratigraphic_unit( isovalues.back() + 1. ) );
+            return intervals;
+        }
+    } // namespace detail
+} // namespace geode
@@ -30,6 +30,7 @@
 
 #include <geode/geosciences/explicit/representation/core/detail/clone.hpp>
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
 
 namespace geode
 {
@@ -126,6 +127,7 @@ namespace geode
     auto HorizonsStack< dimension >::bottom_to_top_horizons() const
         -> HorizonOrderedRange
     {
+        OPENGEODE_GEOSCIENCES_COUNT_EVENT( "HorizonsStack::ordered_traversal" );
         if( !impl_->top_horizon() || !impl_->bottom_horizon() )
         {
             Logger::warning(
@@ -140,6 +142,7 @@ namespace geode
     auto HorizonsStack< dimension >::bottom_to_top_units() const
         -> StratigraphicUnitOrderedRange
     {
+        OPENGEODE_GEOSCIENCES_COUNT_EVENT( "HorizonsStack::ordered_traversal" );
         if( !impl_->top_horizon() || !impl_->bottom_horizon() )
         {
             Logger::warning(
@@ -154,6 +157,7 @@ namespace geode
     auto HorizonsStack< dimension >::top_to_bottom_horizons() const
         -> HorizonOrderedRange
     {
+        OPENGEODE_GEOSCIENCES_COUNT_EVENT( "HorizonsStack::ordered_traversal" );
         if( !impl_->top_horizon() || !impl_->bottom_horizon() )
         {
             Logger::warning(
@@ -168,6 +172,7 @@ namespace geode
     auto HorizonsStack< dimension >::top_to_bottom_units() const
         -> StratigraphicUnitOrderedRange
     {
+        OPENGEODE_GEOSCIENCES_COUNT_EVENT( "HorizonsStack::ordered_traversal" );
         if( !impl_->top_horizon() || !impl_->bottom_horizon() )
         {
             Logger::warning(
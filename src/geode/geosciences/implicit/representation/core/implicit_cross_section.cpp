@@ -23,6 +23,8 @@
 
 #include <geode/geosciences/implicit/representation/core/implicit_cross_section.hpp>
 
+#include <absl/container/fixed_array.h>
+
 #include <async++.h>
 
 #include <bitsery/ext/std_map.h>
@@ -47,7 +49,10 @@
 
 #include <geode/geosciences/explicit/representation/core/detail/clone.hpp>
 #include <geode/geosciences/implicit/representation/builder/implicit_cross_section_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/query_tree_boxes.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
 
 namespace geode
 {
@@ -69,6 +74,12 @@ namespace geode
             }
         }
 
+        void set_implicit_query_tree_boxes(
+            const Surface2D& surface, detail::QueryTreeBoxes2D&& polygon_boxes )
+        {
+            saved_tree_boxes_.set( surface.id(), std::move( polygon_boxes ) );
+        }
+
         const uuid& implicit_attribute_id() const
         {
             return implicit_attribute_id_;
@@ -77,7 +88,8 @@ namespace geode
         double implicit_value(
             const Surface2D& surface, index_t vertex_id ) const
         {
-            return implicit_attributes_.at( surface.id() ).value( vertex_id );
+            return transformed_value(
+                implicit_attributes_.at( surface.id() ).value( vertex_id ) );
         }
 
         std::optional< double > implicit_value(
@@ -96,27 +108,64 @@ namespace geode
             const Point2D& point,
             index_t triangle_id ) const
         {
-            return implicit_attributes_.at( surface.id() )
-                .value( point, triangle_id );
+            return transformed_value( implicit_attributes_.at( surface.id() )
+                    .value( point, triangle_id ) );
+        }
+
+        double implicit_value_scale() const
+        {
+            return implicit_value_scale_;
+        }
+
+        double implicit_value_offset() const
+        {
+            return implicit_value_offset_;
         }
 
         std::optional< index_t > containing_polygon(
             const Surface2D& surface, const Point2D& point ) const
         {
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "ImplicitCrossSection::containing_polygon", surface.id() );
             DistanceToTriangle2D distance_action{
                 surface.mesh< TriangulatedSurface2D >()
             };
             const auto closest_triangle =
                 std::get< 0 >( surface_mesh_aabb_trees_
-                        .at( surface.id() )( create_aabb_tree, surface.mesh() )
+                        .at( surface.id() )(
+                            create_surface_aabb_tree, *this, surface )
                         .closest_element_box( point, distance_action ) );
             if( distance_action( point, closest_triangle ) < GLOBAL_EPSILON )
             {
                 return closest_triangle;
             }
+            OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                "ImplicitCrossSection::containing_polygon_failure",
+                surface.id() );
             return std::nullopt;
         }
 
+        void compute_implicit_query_trees(
+            const ImplicitCrossSection& model ) const
+        {
+            absl::FixedArray< const Surface2D* > surfaces(
+                model.nb_surfaces() );
+            index_t nb_surfaces{ 0 };
+            for( const auto& surface : model.surfaces() )
+            {
+                if( surface_mesh_aabb_trees_.contains( surface.id() ) )
+                {
+                    surfaces[nb_surfaces++] = &surface;
+                }
+            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_surfaces ),
+                [&surfaces, this]( index_t s ) {
+                    const auto& surface = *surfaces[s];
+                    surface_mesh_aabb_trees_.at( surface.id() )(
+                        create_surface_aabb_tree, *this, surface );
+                } );
+        }
+
         absl::flat_hash_map< uuid, TriangulatedSurfaceScalarFunction2D >&
             implicit_attributes()
         {
@@ -173,6 +222,8 @@ namespace geode
         std::optional< uuid > containing_stratigraphic_unit(
             double implicit_function_value ) const
         {
+            OPENGEODE_GEOSCIENCES_TIME_SCOPE(
+                "ImplicitCrossSection::containing_stratigraphic_unit" );
             if( horizon_isovalues_.empty() )
             {
                 return std::nullopt;
@@ -270,7 +321,44 @@ namespace geode
                 "surface uuid in the attributes registered - Try instantiating "
                 "your attribute first." );
             implicit_attributes_.at( surface.id() )
-                .set_value( vertex_id, value );
+                .set_value( vertex_id, ( value - implicit_value_offset_ )
+                                           / implicit_value_scale_ );
+        }
+
+        void set_implicit_value_transform( double scale, double offset )
+        {
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                scale != 0, nullptr, OpenGeodeException::TYPE::data,
+                "[ImplicitCrossSection::set_implicit_value_transform] Scale "
+                "of the implicit value transform cannot be zero." );
+            implicit_value_scale_ = scale;
+            implicit_value_offset_ = offset;
+        }
+
+        void bake_implicit_value_transform( const ImplicitCrossSection& model )
+        {
+            if( implicit_value_scale_ == 1 && implicit_value_offset_ == 0 )
+            {
+                return;
+            }
+            for( const auto& surface : model.surfaces() )
+            {
+                const auto attribute =
+                    implicit_attributes_.find( surface.id() );
+                if( attribute == implicit_attributes_.end() )
+                {
+                    continue;
+                }
+                auto& function = attribute->second;
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, surface.mesh().nb_vertices() ),
+                    [&function, this]( index_t vertex_id ) {
+                        function.set_value( vertex_id,
+                            transformed_value( function.value( vertex_id ) ) );
+                    } );
+            }
+            implicit_value_scale_ = 1;
+            implicit_value_offset_ = 0;
         }
 
         void set_horizons_stack( HorizonsStack2D&& stack )
@@ -293,6 +381,12 @@ namespace geode
         }
 
     private:
+        double transformed_value( double stored_value ) const
+        {
+            return implicit_value_scale_ * stored_value
+                   + implicit_value_offset_;
+        }
+
         std::optional< bool > increasing_stack_isovalues() const
         {
             for( const auto& unit : horizons_stack_.stratigraphic_units() )
@@ -340,9 +434,42 @@ namespace geode
                                     map_archive.value8b( item );
                                 } );
                             local_archive.object( impl.implicit_attribute_id_ );
+                        },
+                        []( Archive& local_archive, Impl& impl ) {
+                            local_archive.ext( impl.horizon_isovalues_,
+                                bitsery::ext::StdMap{
+                                    impl.horizon_isovalues_.max_size() },
+                                []( Archive& map_archive, uuid& id,
+                                    double& item ) {
+                                    map_archive.object( id );
+                                    map_archive.value8b( item );
+                                } );
+                            local_archive.object( impl.implicit_attribute_id_ );
+                            local_archive.value8b( impl.implicit_value_scale_ );
+                            local_archive.value8b(
+                                impl.implicit_value_offset_ );
                         } } } );
         }
 
+    private:
+        static AABBTree2D create_surface_aabb_tree(
+            const Impl& impl, const Surface2D& surface )
+        {
+            const auto& mesh = surface.mesh();
+            if( auto saved_boxes = impl.saved_tree_boxes_.take(
+                    surface.id(), mesh.nb_polygons(), [&mesh] {
+                        return detail::mesh_vertices_fingerprint( mesh );
+                    } ) )
+            {
+                OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                    "ImplicitCrossSection::surface_tree_load", surface.id() );
+                return AABBTree2D{ saved_boxes.value() };
+            }
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "ImplicitCrossSection::surface_tree_build", surface.id() );
+            return create_aabb_tree( mesh );
+        }
+
     private:
         absl::flat_hash_map< uuid, TriangulatedSurfaceScalarFunction2D >
             implicit_attributes_;
@@ -350,7 +477,10 @@ namespace geode
         absl::flat_hash_map< uuid, double > horizon_isovalues_;
         absl::flat_hash_map< uuid, CachedValue< AABBTree2D > >
             surface_mesh_aabb_trees_;
+        detail::SavedQueryTreeBoxes2D saved_tree_boxes_;
         geode::uuid implicit_attribute_id_{};
+        double implicit_value_scale_{ 1 };
+        double implicit_value_offset_{ 0 };
     };
 
     ImplicitCrossSection::ImplicitCrossSection()
@@ -434,12 +564,27 @@ namespace geode
         return impl_->implicit_value( surface, point, polygon_id );
     }
 
+    double ImplicitCrossSection::implicit_value_scale() const
+    {
+        return impl_->implicit_value_scale();
+    }
+
+    double ImplicitCrossSection::implicit_value_offset() const
+    {
+        return impl_->implicit_value_offset();
+    }
+
     std::optional< index_t > ImplicitCrossSection::containing_polygon(
         const Surface2D& surface, const Point2D& point ) const
     {
         return impl_->containing_polygon( surface, point );
     }
 
+    void ImplicitCrossSection::compute_implicit_query_trees() const
+    {
+        impl_->compute_implicit_query_trees( *this );
+    }
+
     const HorizonsStack2D& ImplicitCrossSection::horizons_stack() const
     {
         return impl_->horizons_stack();
@@ -470,6 +615,15 @@ namespace geode
         impl_->initialize_implicit_query_trees( *this );
     }
 
+    void ImplicitCrossSection::set_implicit_query_tree_boxes(
+        const Surface2D& surface,
+        detail::QueryTreeBoxes2D&& polygon_boxes,
+        ImplicitCrossSectionBuilderKey )
+    {
+        impl_->set_implicit_query_tree_boxes(
+            surface, std::move( polygon_boxes ) );
+    }
+
     void ImplicitCrossSection::instantiate_implicit_attribute_on_surfaces(
         ImplicitCrossSectionBuilderKey )
     {
@@ -484,6 +638,18 @@ namespace geode
         do_set_implicit_value( surface, vertex_id, value );
     }
 
+    void ImplicitCrossSection::set_implicit_value_transform(
+        double scale, double offset, ImplicitCrossSectionBuilderKey )
+    {
+        do_set_implicit_value_transform( scale, offset );
+    }
+
+    void ImplicitCrossSection::bake_implicit_value_transform(
+        ImplicitCrossSectionBuilderKey )
+    {
+        impl_->bake_implicit_value_transform( *this );
+    }
+
     void ImplicitCrossSection::set_horizons_stack(
         HorizonsStack2D&& stack, ImplicitCrossSectionBuilderKey )
     {
@@ -510,6 +676,12 @@ namespace geode
         impl_->set_implicit_value( surface, vertex_id, value );
     }
 
+    void ImplicitCrossSection::do_set_implicit_value_transform(
+        double scale, double offset )
+    {
+        impl_->set_implicit_value_transform( scale, offset );
+    }
+
     template < typename Archive >
     void ImplicitCrossSection::serialize( Archive& archive )
     {
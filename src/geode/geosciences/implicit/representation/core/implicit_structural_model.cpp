@@ -23,6 +23,17 @@
 
 #include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/inlined_vector.h>
+
+#include <async++.h>
+
 #include <bitsery/ext/std_map.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -31,8 +42,12 @@
 #include <geode/basic/logger.hpp>
 #include <geode/basic/pimpl_impl.hpp>
 #include <geode/basic/uuid.hpp>
+#include <geode/basic/variable_attribute.hpp>
 
 #include <geode/geometry/aabb.hpp>
+#include <geode/geometry/barycentric_coordinates.hpp>
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
+#include <geode/geometry/bounding_box.hpp>
 #include <geode/geometry/distance.hpp>
 #include <geode/geometry/point.hpp>
 
@@ -45,7 +60,285 @@
 
 #include <geode/geosciences/explicit/representation/core/detail/clone.hpp>
 #include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/query_tree_boxes.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/stratigraphic_unit_intervals.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
+
+namespace
+{
+    /*!
+     * Implicit values of a tetrahedral block, stored either in double
+     * precision through a TetrahedralSolidScalarFunction3D or in single
+     * precision, widened to double for interpolation. The values can also be
+     * read from a read-only mapped array holding the same values, which is
+     * dropped before any modification.
+     */
+    class BlockImplicitValues
+    {
+    public:
+        explicit BlockImplicitValues(
+            geode::TetrahedralSolidScalarFunction3D&& function )
+            : function_{ std::move( function ) }
+        {
+        }
+
+        BlockImplicitValues( const geode::TetrahedralSolid3D& mesh,
+            std::shared_ptr< geode::VariableAttribute< float > > values )
+            : mesh_{ &mesh }, single_precision_values_{ std::move( values ) }
+        {
+        }
+
+        double value( geode::index_t vertex_id ) const
+        {
+            if( is_mapped() )
+            {
+                return mapped_values_[vertex_id];
+            }
+            if( function_ )
+            {
+                return function_->value( vertex_id );
+            }
+            return single_precision_values_->value( vertex_id );
+        }
+
+        double value(
+            const geode::Point3D& point, geode::index_t tetrahedron_id ) const
+        {
+            if( function_ && !is_mapped() )
+            {
+                return function_->value( point, tetrahedron_id );
+            }
+            const auto barycentric_coordinates =
+                geode::tetrahedron_barycentric_coordinates(
+                    point, mesh_->tetrahedron( tetrahedron_id ) );
+            double result{ 0 };
+            for( const auto v : geode::LRange{ 4 } )
+            {
+                const auto vertex_id =
+                    mesh_->polyhedron_vertex( { tetrahedron_id, v } );
+                result += barycentric_coordinates[v] * value( vertex_id );
+            }
+            return result;
+        }
+
+        void set_value( geode::index_t vertex_id, double value )
+        {
+            if( !mapped_values_.empty() )
+            {
+                unmap_values();
+            }
+            if( function_ )
+            {
+                function_->set_value( vertex_id, value );
+                return;
+            }
+            single_precision_values_->set_value(
+                vertex_id, static_cast< float >( value ) );
+        }
+
+        void map_values( const geode::TetrahedralSolid3D& mesh,
+            absl::Span< const double > values,
+            std::shared_ptr< const void > owner )
+        {
+            mesh_ = &mesh;
+            mapped_values_ = values;
+            mapping_owner_ = std::move( owner );
+        }
+
+        void unmap_values()
+        {
+            mapped_values_ = {};
+            mapping_owner_.reset();
+        }
+
+        bool is_mapped() const
+        {
+            return !mapped_values_.empty()
+                   && mapped_values_.size() == mesh_->nb_vertices();
+        }
+
+    private:
+        std::optional< geode::TetrahedralSolidScalarFunction3D > function_;
+        const geode::TetrahedralSolid3D* mesh_{ nullptr };
+        std::shared_ptr< geode::VariableAttribute< float > >
+            single_precision_values_;
+        absl::Span< const double > mapped_values_;
+        std::shared_ptr< const void > mapping_owner_;
+    };
+
+    /*!
+     * Part of a vertical line inside a tetrahedron, with the implicit values
+     * at both ends.
+     */
+    struct ColumnPart
+    {
+        double bottom;
+        double top;
+        double bottom_value;
+        double top_value;
+    };
+
+    /*!
+     * Polyhedron attributes storing the StratigraphicUnit label of each
+     * tetrahedron of a block and whether a horizon cuts it, with the number
+     * of tetrahedra they were computed for.
+     */
+    struct BlockUnitLabels
+    {
+        std::shared_ptr< geode::VariableAttribute< geode::local_index_t > >
+            labels;
+        std::shared_ptr< geode::VariableAttribute< bool > > cuts;
+        geode::index_t nb_tetrahedra{ 0 };
+    };
+
+    void delete_block_label_attributes( const geode::TetrahedralSolid3D& mesh )
+    {
+        auto& manager = mesh.polyhedron_attribute_manager();
+        for( const auto name :
+            { geode::ImplicitStructuralModel::
+                    STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME,
+                geode::ImplicitStructuralModel::HORIZON_CUT_ATTRIBUTE_NAME } )
+        {
+            if( const auto ids = manager.attribute_ids_matching_name( name ) )
+            {
+                for( const auto& id : ids.value() )
+                {
+                    manager.delete_attribute( id );
+                }
+            }
+        }
+    }
+
+    template < typename T >
+    std::shared_ptr< geode::VariableAttribute< T > > block_label_attribute(
+        geode::AttributeManager& manager, std::string_view name, T value )
+    {
+        if( const auto ids = manager.attribute_ids_matching_name( name ) )
+        {
+            return manager.find_attribute< geode::VariableAttribute, T >(
+                ids.value().front() );
+        }
+        geode::AttributeValues< T > default_values;
+        default_values.default_value = value;
+        default_values.no_value = value;
+        geode::AttributeProperties properties;
+        properties.assignable = false;
+        properties.interpolable = false;
+        properties.transferable = false;
+        const auto attribute_id =
+            manager.create_attribute< geode::VariableAttribute, T >(
+                name, default_values, properties );
+        return manager.find_attribute< geode::VariableAttribute, T >(
+            attribute_id );
+    }
+
+    /*!
+     * Returns the barycentric coordinates of the location in the vertical
+     * projection of the triangle, if the location lies inside it.
+     */
+    std::optional< std::array< double, 3 > > vertical_barycentric_coordinates(
+        const std::array< geode::Point3D, 3 >& triangle,
+        const geode::Point2D& location )
+    {
+        const auto dx1 = triangle[1].value( 0 ) - triangle[0].value( 0 );
+        const auto dy1 = triangle[1].value( 1 ) - triangle[0].value( 1 );
+        const auto dx2 = triangle[2].value( 0 ) - triangle[0].value( 0 );
+        const auto dy2 = triangle[2].value( 1 ) - triangle[0].value( 1 );
+        const auto determinant = dx1 * dy2 - dx2 * dy1;
+        const auto dx3 = dx2 - dx1;
+        const auto dy3 = dy2 - dy1;
+        const auto max_squared_length =
+            std::max( { dx1 * dx1 + dy1 * dy1, dx2 * dx2 + dy2 * dy2,
+                dx3 * dx3 + dy3 * dy3 } );
+        // Relative to the triangle size, so that small and large triangles
+        // are equally considered flat in projection
+        if( std::fabs( determinant )
+            <= geode::GLOBAL_EPSILON * max_squared_length )
+        {
+            return std::nullopt;
+        }
+        const auto dx = location.value( 0 ) - triangle[0].value( 0 );
+        const auto dy = location.value( 1 ) - triangle[0].value( 1 );
+        const auto lambda1 = ( dx * dy2 - dx2 * dy ) / determinant;
+        const auto lambda2 = ( dx1 * dy - dx * dy1 ) / determinant;
+        const auto lambda0 = 1. - lambda1 - lambda2;
+        if( lambda0 < -geode::GLOBAL_EPSILON
+            || lambda1 < -geode::GLOBAL_EPSILON
+            || lambda2 < -geode::GLOBAL_EPSILON )
+        {
+            return std::nullopt;
+        }
+        return std::array< double, 3 >{ lambda0, lambda1, lambda2 };
+    }
+
+    /*!
+     * Splits the column parts at the horizon isovalue crossings, then merges
+     * the contiguous pieces lying in the same StratigraphicUnit.
+     */
+    std::vector< geode::StratigraphicColumnInterval > column_intervals(
+        absl::Span< const ColumnPart > parts,
+        const geode::detail::StratigraphicUnitIntervals& units )
+    {
+        std::vector< geode::StratigraphicColumnInterval > pieces;
+        absl::InlinedVector< double, 4 > elevations;
+        for( const auto& part : parts )
+        {
+            const auto value_range = part.top_value - part.bottom_value;
+            const auto height = part.top - part.bottom;
+            const auto [min_value, max_value] =
+                std::minmax( part.bottom_value, part.top_value );
+            elevations.clear();
+            elevations.push_back( part.bottom );
+            for( auto isovalue =
+                     absl::c_upper_bound( units.isovalues, min_value );
+                 isovalue != units.isovalues.end() && *isovalue < max_value;
+                 ++isovalue )
+            {
+                elevations.push_back( part.bottom
+                                      + ( *isovalue - part.bottom_value )
+                                            / value_range * height );
+            }
+            elevations.push_back( part.top );
+            absl::c_sort( elevations );
+            for( const auto e : geode::Range{
+                     1, static_cast< geode::index_t >( elevations.size() ) } )
+            {
+                const auto middle = ( elevations[e - 1] + elevations[e] ) / 2.;
+                const auto value =
+                    part.bottom_value
+                    + ( middle - part.bottom ) / height * value_range;
+                if( const auto unit = units.unit( value ) )
+                {
+                    pieces.push_back( { unit.value(), elevations[e],
+                        elevations[e - 1] } );
+                }
+            }
+        }
+        absl::c_sort(
+            pieces, []( const geode::StratigraphicColumnInterval& piece0,
+                        const geode::StratigraphicColumnInterval& piece1 ) {
+                return piece0.top > piece1.top;
+            } );
+        std::vector< geode::StratigraphicColumnInterval > intervals;
+        for( const auto& piece : pieces )
+        {
+            if( !intervals.empty()
+                && intervals.back().stratigraphic_unit
+                       == piece.stratigraphic_unit
+                && piece.top
+                       >= intervals.back().bottom - geode::GLOBAL_EPSILON )
+            {
+                intervals.back().bottom =
+                    std::min( intervals.back().bottom, piece.bottom );
+                continue;
+            }
+            intervals.push_back( piece );
+        }
+        return intervals;
+    }
+} // namespace
 
 namespace geode
 {
@@ -67,16 +360,47 @@ namespace geode
             }
         }
 
+        void set_implicit_query_tree_boxes(
+            const Block3D& block, detail::QueryTreeBoxes3D&& polyhedron_boxes )
+        {
+            saved_tree_boxes_.set( block.id(), std::move( polyhedron_boxes ) );
+        }
+
+        void set_stratigraphic_query_tree_boxes(
+            const Block3D& block, detail::QueryTreeBoxes3D&& polyhedron_boxes )
+        {
+            saved_stratigraphic_tree_boxes_.set(
+                block.id(), std::move( polyhedron_boxes ) );
+        }
+
+        const detail::SavedQueryTreeBoxes3D&
+            saved_stratigraphic_query_tree_boxes() const
+        {
+            return saved_stratigraphic_tree_boxes_;
+        }
+
         const uuid& implicit_attribute_id() const
         {
             return implicit_attribute_id_;
         }
 
         double implicit_value( const Block3D& block, index_t vertex_id ) const
+        {
+            return transformed_value(
+                implicit_attributes_.at( block.id() ).value( vertex_id ) );
+        }
+
+        double stored_implicit_value(
+            const Block3D& block, index_t vertex_id ) const
         {
             return implicit_attributes_.at( block.id() ).value( vertex_id );
         }
 
+        STORAGE_PRECISION implicit_value_precision() const
+        {
+            return implicit_value_precision_;
+        }
+
         std::optional< double > implicit_value(
             const Block3D& block, const Point3D& point ) const
         {
@@ -92,33 +416,77 @@ namespace geode
             const Point3D& point,
             index_t tetrahedron_id ) const
         {
-            return implicit_attributes_.at( block.id() )
-                .value( point, tetrahedron_id );
+            return transformed_value( implicit_attributes_.at( block.id() )
+                    .value( point, tetrahedron_id ) );
+        }
+
+        double implicit_value_scale() const
+        {
+            return implicit_value_scale_;
+        }
+
+        double implicit_value_offset() const
+        {
+            return implicit_value_offset_;
         }
 
         std::optional< index_t > containing_polyhedron(
             const Block3D& block, const Point3D& point ) const
         {
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "ImplicitStructuralModel::containing_polyhedron", block.id() );
             DistanceToTetrahedron3D distance_action{
                 block.mesh< TetrahedralSolid3D >()
             };
             auto closest_tetrahedron = std::get< 0 >( block_mesh_aabb_trees_
-                    .at( block.id() )( create_aabb_tree, block.mesh() )
+                    .at( block.id() )( create_block_aabb_tree, *this, block )
                     .closest_element_box( point, distance_action ) );
             if( distance_action( point, closest_tetrahedron ) < GLOBAL_EPSILON )
             {
                 return closest_tetrahedron;
             }
+            OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                "ImplicitStructuralModel::containing_polyhedron_failure",
+                block.id() );
             return std::nullopt;
         }
 
+        void compute_implicit_query_trees(
+            const ImplicitStructuralModel& model ) const
+        {
+            absl::FixedArray< const Block3D* > blocks( model.nb_blocks() );
+            index_t nb_blocks{ 0 };
+            for( const auto& block : model.blocks() )
+            {
+                if( block_mesh_aabb_trees_.contains( block.id() ) )
+                {
+                    blocks[nb_blocks++] = &block;
+                }
+            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_blocks ),
+                [&blocks, this]( index_t b ) {
+                    const auto& block = *blocks[b];
+                    block_mesh_aabb_trees_.at( block.id() )(
+                        create_block_aabb_tree, *this, block );
+                } );
+        }
+
+        bool has_implicit_query_tree( const Block3D& block ) const
+        {
+            const auto tree = block_mesh_aabb_trees_.find( block.id() );
+            return tree != block_mesh_aabb_trees_.end()
+                   && tree->second.computed();
+        }
+
         const HorizonsStack3D& horizons_stack() const
         {
             return horizons_stack_;
         }
 
-        HorizonsStack3D& modifiable_horizons_stack()
+        HorizonsStack3D& modifiable_horizons_stack(
+            const ImplicitStructuralModel& model )
         {
+            invalidate_stratigraphic_unit_labels( model );
             return horizons_stack_;
         }
 
@@ -162,6 +530,8 @@ namespace geode
         std::optional< uuid > containing_stratigraphic_unit(
             double implicit_function_value ) const
         {
+            OPENGEODE_GEOSCIENCES_TIME_SCOPE(
+                "ImplicitStructuralModel::containing_stratigraphic_unit" );
             if( horizon_isovalues_.empty() )
             {
                 return std::nullopt;
@@ -186,9 +556,11 @@ namespace geode
                     const auto horizon_above =
                         horizons_stack_.above( unit_above.value() );
                     if( !horizon_above
+                        || !horizon_isovalues_.contains( horizon_above.value() )
                         || increasing.value()
                                == ( implicit_function_value
-                                    < horizon_isovalues_.at( horizon_id ) ) )
+                                    < horizon_isovalues_.at(
+                                        horizon_above.value() ) ) )
                     {
                         return unit_above.value();
                     }
@@ -203,9 +575,11 @@ namespace geode
                 const auto horizon_under =
                     horizons_stack_.under( unit_under.value() );
                 if( !horizon_under
+                    || !horizon_isovalues_.contains( horizon_under.value() )
                     || increasing.value()
                            == ( implicit_function_value
-                                > horizon_isovalues_.at( horizon_id ) ) )
+                                >= horizon_isovalues_.at(
+                                    horizon_under.value() ) ) )
                 {
                     return unit_under.value();
                 }
@@ -213,9 +587,197 @@ namespace geode
             }
         }
 
+        StratigraphicColumns stratigraphic_columns(
+            const ImplicitStructuralModel& model,
+            absl::Span< const Point2D > locations ) const
+        {
+            OPENGEODE_GEOSCIENCES_TIME_SCOPE(
+                "ImplicitStructuralModel::stratigraphic_columns" );
+            compute_implicit_query_trees( model );
+            std::vector< const Block3D* > blocks;
+            for( const auto& block : model.blocks() )
+            {
+                if( implicit_attributes_.contains( block.id() )
+                    && block_mesh_aabb_trees_.contains( block.id() ) )
+                {
+                    blocks.push_back( &block );
+                }
+            }
+            const auto bbox = model.bounding_box();
+            const auto units = detail::stratigraphic_unit_intervals( model );
+            absl::FixedArray< std::vector< StratigraphicColumnInterval > >
+                columns( locations.size() );
+            async::parallel_for(
+                async::irange( std::size_t{ 0 }, locations.size() ),
+                [&columns, &blocks, &bbox, &units, &locations, this](
+                    std::size_t c ) {
+                    columns[c] = stratigraphic_column(
+                        blocks, bbox, units, locations[c] );
+                } );
+            StratigraphicColumns result;
+            result.offsets.reserve( locations.size() + 1 );
+            result.offsets.push_back( 0 );
+            for( const auto& column : columns )
+            {
+                result.intervals.insert(
+                    result.intervals.end(), column.begin(), column.end() );
+                result.offsets.push_back(
+                    static_cast< index_t >( result.intervals.size() ) );
+            }
+            return result;
+        }
+
+        bool has_stratigraphic_unit_labels(
+            const ImplicitStructuralModel& model ) const
+        {
+            if( !are_unit_labels_up_to_date() )
+            {
+                return false;
+            }
+            for( const auto& block : model.blocks() )
+            {
+                if( !implicit_attributes_.contains( block.id() ) )
+                {
+                    continue;
+                }
+                const auto labels = block_unit_labels_.find( block.id() );
+                if( labels == block_unit_labels_.end()
+                    || labels->second.nb_tetrahedra
+                           != block.mesh().nb_polyhedra() )
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        absl::Span< const std::optional< uuid > >
+            stratigraphic_unit_label_table() const
+        {
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                are_unit_labels_up_to_date(), nullptr,
+                OpenGeodeException::TYPE::data,
+                "[ImplicitStructuralModel::stratigraphic_unit_label_table] "
+                "Stratigraphic unit labels are not computed or out of date" );
+            return unit_label_table_.value();
+        }
+
+        local_index_t stratigraphic_unit_label(
+            const Block3D& block, index_t tetrahedron_id ) const
+        {
+            return block_unit_labels( block ).labels->value( tetrahedron_id );
+        }
+
+        std::optional< uuid > tetrahedron_stratigraphic_unit(
+            const Block3D& block, index_t tetrahedron_id ) const
+        {
+            const auto label =
+                stratigraphic_unit_label( block, tetrahedron_id );
+            return unit_label_table_.value()[label];
+        }
+
+        bool is_cut_by_horizon(
+            const Block3D& block, index_t tetrahedron_id ) const
+        {
+            return block_unit_labels( block ).cuts->value( tetrahedron_id );
+        }
+
+        void compute_stratigraphic_unit_labels(
+            const ImplicitStructuralModel& model )
+        {
+            OPENGEODE_GEOSCIENCES_TIME_SCOPE(
+                "ImplicitStructuralModel::compute_stratigraphic_unit_labels" );
+            auto units = detail::stratigraphic_unit_intervals( model );
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                units.units.size()
+                    <= std::numeric_limits< local_index_t >::max(),
+                nullptr, OpenGeodeException::TYPE::data,
+                "[ImplicitStructuralModel::compute_stratigraphic_unit_labels] "
+                "Too many horizon isovalues to store the labels" );
+            reset_stratigraphic_unit_labels( model );
+            for( const auto& block : model.blocks() )
+            {
+                const auto values = implicit_attributes_.find( block.id() );
+                if( values == implicit_attributes_.end() )
+                {
+                    continue;
+                }
+                const auto& mesh = block.mesh< TetrahedralSolid3D >();
+                auto& manager = mesh.polyhedron_attribute_manager();
+                BlockUnitLabels labels{
+                    block_label_attribute< local_index_t >(
+                        manager, STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME, 0 ),
+                    block_label_attribute< bool >(
+                        manager, HORIZON_CUT_ATTRIBUTE_NAME, false )
+                };
+                const auto& function = values->second;
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, mesh.nb_polyhedra() ),
+                    [&mesh, &function, &units, &labels, this](
+                        index_t tetrahedron ) {
+                        std::array< double, 4 > vertex_values;
+                        double value{ 0 };
+                        for( const auto v : LRange{ 4 } )
+                        {
+                            vertex_values[v] =
+                                transformed_value( function.value(
+                                    mesh.polyhedron_vertex(
+                                        { tetrahedron, v } ) ) );
+                            value += vertex_values[v];
+                        }
+                        const auto [min_value, max_value] =
+                            absl::c_minmax_element( vertex_values );
+                        labels.labels->set_value( tetrahedron,
+                            static_cast< local_index_t >(
+                                units.interval( value / 4. ) ) );
+                        labels.cuts->set_value( tetrahedron,
+                            units.is_cut( *min_value, *max_value ) );
+                    } );
+                labels.nb_tetrahedra = mesh.nb_polyhedra();
+                block_unit_labels_.try_emplace(
+                    block.id(), std::move( labels ) );
+            }
+            unit_label_table_ = std::move( units.units );
+            unit_labels_version_ = implicit_values_version_;
+            may_have_label_attributes_ = true;
+        }
+
+        /*!
+         * Bumps the version of the implicit values and drops the labels
+         * computed from the previous one.
+         */
+        void invalidate_stratigraphic_unit_labels(
+            const ImplicitStructuralModel& model )
+        {
+            implicit_values_version_++;
+            reset_stratigraphic_unit_labels( model );
+        }
+
+        void reset_stratigraphic_unit_labels(
+            const ImplicitStructuralModel& model )
+        {
+            if( !may_have_label_attributes_ )
+            {
+                return;
+            }
+            unit_label_table_.reset();
+            block_unit_labels_.clear();
+            for( const auto& block : model.blocks() )
+            {
+                if( block.mesh().type_name()
+                    == TetrahedralSolid3D::type_name_static() )
+                {
+                    delete_block_label_attributes(
+                        block.mesh< TetrahedralSolid3D >() );
+                }
+            }
+            may_have_label_attributes_ = false;
+        }
+
         void instantiate_implicit_attribute_on_blocks(
             const ImplicitStructuralModel& model )
         {
+            invalidate_stratigraphic_unit_labels( model );
             implicit_attributes_.clear();
             implicit_attributes_.reserve( model.nb_blocks() );
             for( const auto& block : model.blocks() )
@@ -225,33 +787,53 @@ namespace geode
                 {
                     continue;
                 }
-                if( block.mesh().vertex_attribute_manager().attribute_exists(
-                        implicit_attribute_id_ ) )
+                implicit_attributes_.try_emplace(
+                    block.id(), create_block_implicit_values(
+                                    block.mesh< TetrahedralSolid3D >(),
+                                    implicit_value_precision_ ) );
+            }
+        }
+
+        void set_implicit_value_precision(
+            const ImplicitStructuralModel& model, STORAGE_PRECISION precision )
+        {
+            if( precision == implicit_value_precision_ )
+            {
+                return;
+            }
+            invalidate_stratigraphic_unit_labels( model );
+            for( const auto& block : model.blocks() )
+            {
+                const auto attribute = implicit_attributes_.find( block.id() );
+                if( attribute == implicit_attributes_.end() )
                 {
-                    implicit_attributes_.try_emplace(
-                        block.id(), TetrahedralSolidScalarFunction3D::find(
-                                        block.mesh< TetrahedralSolid3D >(),
-                                        implicit_attribute_id_ ) );
+                    continue;
+                }
+                const auto& mesh = block.mesh< TetrahedralSolid3D >();
+                std::vector< double > values( mesh.nb_vertices() );
+                for( const auto vertex_id : Range{ mesh.nb_vertices() } )
+                {
+                    values[vertex_id] = attribute->second.value( vertex_id );
                 }
-                else
+                implicit_attributes_.erase( attribute );
+                mesh.vertex_attribute_manager().delete_attribute(
+                    implicit_attribute_id_ );
+                auto new_values =
+                    create_block_implicit_values( mesh, precision );
+                for( const auto vertex_id : Range{ mesh.nb_vertices() } )
                 {
-                    implicit_attributes_.try_emplace(
-                        block.id(), TetrahedralSolidScalarFunction3D::create(
-                                        block.mesh< TetrahedralSolid3D >(),
-                                        IMPLICIT_ATTRIBUTE_NAME,
-                                        implicit_attribute_id_, 0 ) );
+                    new_values.set_value( vertex_id, values[vertex_id] );
                 }
+                implicit_attributes_.try_emplace(
+                    block.id(), std::move( new_values ) );
             }
+            implicit_value_precision_ = precision;
         }
 
-        absl::flat_hash_map< uuid, TetrahedralSolidScalarFunction3D >&
-            implicit_attributes()
-        {
-            return implicit_attributes_;
-        }
-
-        void set_implicit_value(
-            const Block3D& block, index_t vertex_id, double value )
+        void set_implicit_value( const ImplicitStructuralModel& model,
+            const Block3D& block,
+            index_t vertex_id,
+            double value )
         {
             OpenGeodeGeosciencesImplicitException::check_exception(
                 implicit_attributes_.find( block.id() )
@@ -260,16 +842,102 @@ namespace geode
                 "[ImplicitStructuralModel::set_implicit_value] Couldn't find "
                 "block uuid in the attributes registered - Try instantiating "
                 "your attribute first." );
-            implicit_attributes_.at( block.id() ).set_value( vertex_id, value );
+            invalidate_stratigraphic_unit_labels( model );
+            implicit_attributes_.at( block.id() )
+                .set_value( vertex_id, ( value - implicit_value_offset_ )
+                                           / implicit_value_scale_ );
         }
 
-        void set_horizons_stack( HorizonsStack3D&& stack )
+        void map_implicit_values( const Block3D& block,
+            absl::Span< const double > values,
+            std::shared_ptr< const void > owner )
         {
+            const auto attribute = implicit_attributes_.find( block.id() );
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                attribute != implicit_attributes_.end()
+                    && values.size() == block.mesh().nb_vertices(),
+                nullptr, OpenGeodeException::TYPE::data,
+                "[ImplicitStructuralModel::map_implicit_values] Mapped values "
+                "do not match the implicit values of Block ",
+                block.id().string() );
+            attribute->second.map_values( block.mesh< TetrahedralSolid3D >(),
+                values, std::move( owner ) );
+        }
+
+        void reset_block_mesh_aabb_tree( const Block3D& block )
+        {
+            const auto tree = block_mesh_aabb_trees_.find( block.id() );
+            if( tree != block_mesh_aabb_trees_.end() )
+            {
+                tree->second.reset();
+            }
+        }
+
+        void unmap_implicit_values( const Block3D& block )
+        {
+            const auto attribute = implicit_attributes_.find( block.id() );
+            if( attribute != implicit_attributes_.end() )
+            {
+                attribute->second.unmap_values();
+            }
+        }
+
+        bool has_mapped_implicit_values( const Block3D& block ) const
+        {
+            const auto attribute = implicit_attributes_.find( block.id() );
+            return attribute != implicit_attributes_.end()
+                   && attribute->second.is_mapped();
+        }
+
+        void set_implicit_value_transform(
+            const ImplicitStructuralModel& model, double scale, double offset )
+        {
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                scale != 0, nullptr, OpenGeodeException::TYPE::data,
+                "[ImplicitStructuralModel::set_implicit_value_transform] "
+                "Scale of the implicit value transform cannot be zero." );
+            invalidate_stratigraphic_unit_labels( model );
+            implicit_value_scale_ = scale;
+            implicit_value_offset_ = offset;
+        }
+
+        void bake_implicit_value_transform(
+            const ImplicitStructuralModel& model )
+        {
+            if( implicit_value_scale_ == 1 && implicit_value_offset_ == 0 )
+            {
+                return;
+            }
+            for( const auto& block : model.blocks() )
+            {
+                const auto attribute = implicit_attributes_.find( block.id() );
+                if( attribute == implicit_attributes_.end() )
+                {
+                    continue;
+                }
+                auto& function = attribute->second;
+                function.unmap_values();
+                async::parallel_for(
+                    async::irange( index_t{ 0 }, block.mesh().nb_vertices() ),
+                    [&function, this]( index_t vertex_id ) {
+                        function.set_value( vertex_id,
+                            transformed_value( function.value( vertex_id ) ) );
+                    } );
+            }
+            implicit_value_scale_ = 1;
+            implicit_value_offset_ = 0;
+        }
+
+        void set_horizons_stack(
+            const ImplicitStructuralModel& model, HorizonsStack3D&& stack )
+        {
+            invalidate_stratigraphic_unit_labels( model );
             horizons_stack_ = std::move( stack );
         }
 
-        void set_horizon_implicit_value(
-            const Horizon3D& horizon, double isovalue )
+        void set_horizon_implicit_value( const ImplicitStructuralModel& model,
+            const Horizon3D& horizon,
+            double isovalue )
         {
             OpenGeodeGeosciencesImplicitException::check_exception(
                 horizons_stack_.has_horizon( horizon.id() ), nullptr,
@@ -279,10 +947,42 @@ namespace geode
                 horizon.name().value_or( horizon.id().string() ), "' with uuid",
                 horizon.id().string(),
                 " because the horizon is not defined in the HorizonsStack." );
+            invalidate_stratigraphic_unit_labels( model );
             horizon_isovalues_[horizon.id()] = isovalue;
         }
 
     private:
+        double transformed_value( double stored_value ) const
+        {
+            return implicit_value_scale_ * stored_value
+                   + implicit_value_offset_;
+        }
+
+        bool are_unit_labels_up_to_date() const
+        {
+            return unit_label_table_.has_value()
+                   && unit_labels_version_ == implicit_values_version_;
+        }
+
+        const BlockUnitLabels& block_unit_labels( const Block3D& block ) const
+        {
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                are_unit_labels_up_to_date(), nullptr,
+                OpenGeodeException::TYPE::data,
+                "[ImplicitStructuralModel::stratigraphic_unit_label] "
+                "Stratigraphic unit labels are not computed or out of date" );
+            const auto labels = block_unit_labels_.find( block.id() );
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                labels != block_unit_labels_.end()
+                    && labels->second.nb_tetrahedra
+                           == block.mesh().nb_polyhedra(),
+                nullptr, OpenGeodeException::TYPE::data,
+                "[ImplicitStructuralModel::stratigraphic_unit_label] Block ",
+                block.id().string(),
+                " has no stratigraphic unit labels or its mesh was modified" );
+            return labels->second;
+        }
+
         bool block_is_meshed( const Block3D& block )
         {
             return block.mesh().nb_polyhedra() != 0;
@@ -335,17 +1035,196 @@ namespace geode
                                     map_archive.value8b( item );
                                 } );
                             local_archive.object( impl.implicit_attribute_id_ );
+                        } },
+                        { []( Archive& local_archive, Impl& impl ) {
+                            local_archive.ext( impl.horizon_isovalues_,
+                                bitsery::ext::StdMap{
+                                    impl.horizon_isovalues_.max_size() },
+                                []( Archive& map_archive, uuid& id,
+                                    double& item ) {
+                                    map_archive.object( id );
+                                    map_archive.value8b( item );
+                                } );
+                            local_archive.object( impl.implicit_attribute_id_ );
+                            local_archive.value8b( impl.implicit_value_scale_ );
+                            local_archive.value8b(
+                                impl.implicit_value_offset_ );
+                        } },
+                        { []( Archive& local_archive, Impl& impl ) {
+                            local_archive.ext( impl.horizon_isovalues_,
+                                bitsery::ext::StdMap{
+                                    impl.horizon_isovalues_.max_size() },
+                                []( Archive& map_archive, uuid& id,
+                                    double& item ) {
+                                    map_archive.object( id );
+                                    map_archive.value8b( item );
+                                } );
+                            local_archive.object( impl.implicit_attribute_id_ );
+                            local_archive.value8b( impl.implicit_value_scale_ );
+                            local_archive.value8b(
+                                impl.implicit_value_offset_ );
+                            local_archive.value1b(
+                                impl.implicit_value_precision_ );
                         } } } } );
         }
 
     private:
-        absl::flat_hash_map< uuid, TetrahedralSolidScalarFunction3D >
-            implicit_attributes_;
+        BlockImplicitValues create_block_implicit_values(
+            const TetrahedralSolid3D& mesh, STORAGE_PRECISION precision ) const
+        {
+            auto& manager = mesh.vertex_attribute_manager();
+            if( precision == STORAGE_PRECISION::double_precision )
+            {
+                if( manager.attribute_exists( implicit_attribute_id_ ) )
+                {
+                    return BlockImplicitValues{
+                        TetrahedralSolidScalarFunction3D::find(
+                            mesh, implicit_attribute_id_ )
+                    };
+                }
+                return BlockImplicitValues{
+                    TetrahedralSolidScalarFunction3D::create( mesh,
+                        IMPLICIT_ATTRIBUTE_NAME, implicit_attribute_id_, 0 )
+                };
+            }
+            if( !manager.attribute_exists( implicit_attribute_id_ ) )
+            {
+                AttributeValues< float > default_values;
+                default_values.default_value = 0;
+                default_values.no_value = 0;
+                AttributeProperties properties;
+                properties.assignable = false;
+                properties.interpolable = true;
+                properties.transferable = true;
+                manager.create_attribute< VariableAttribute, float >(
+                    IMPLICIT_ATTRIBUTE_NAME, implicit_attribute_id_,
+                    default_values, properties );
+            }
+            return { mesh, manager.find_attribute< VariableAttribute, float >(
+                               implicit_attribute_id_ ) };
+        }
+
+        std::vector< StratigraphicColumnInterval > stratigraphic_column(
+            absl::Span< const Block3D* const > blocks,
+            const BoundingBox3D& bbox,
+            const detail::StratigraphicUnitIntervals& units,
+            const Point2D& location ) const
+        {
+            BoundingBox3D line_box;
+            line_box.add_point( Point3D{ { location.value( 0 ),
+                location.value( 1 ), bbox.min().value( 2 ) } } );
+            line_box.add_point( Point3D{ { location.value( 0 ),
+                location.value( 1 ), bbox.max().value( 2 ) } } );
+            std::vector< ColumnPart > parts;
+            for( const auto* block : blocks )
+            {
+                const auto& mesh = block->mesh< TetrahedralSolid3D >();
+                const auto& values = implicit_attributes_.at( block->id() );
+                auto add_part = [&parts, &mesh, &values, &location, this](
+                                    index_t tetrahedron ) {
+                    if( const auto part =
+                            column_part( mesh, values, tetrahedron, location ) )
+                    {
+                        parts.push_back( part.value() );
+                    }
+                    return false;
+                };
+                block_mesh_aabb_trees_.at( block->id() )(
+                    create_block_aabb_tree, *this, *block )
+                    .compute_bbox_element_bbox_intersections(
+                        line_box, add_part );
+            }
+            return column_intervals( parts, units );
+        }
+
+        std::optional< ColumnPart > column_part( const TetrahedralSolid3D& mesh,
+            const BlockImplicitValues& values,
+            index_t tetrahedron,
+            const Point2D& location ) const
+        {
+            std::optional< ColumnPart > part;
+            for( const auto f : LRange{ 4 } )
+            {
+                const auto vertices =
+                    mesh.polyhedron_facet_vertices( { tetrahedron, f } );
+                const std::array< Point3D, 3 > triangle{ mesh.point(
+                                                             vertices[0] ),
+                    mesh.point( vertices[1] ), mesh.point( vertices[2] ) };
+                const auto coordinates =
+                    vertical_barycentric_coordinates( triangle, location );
+                if( !coordinates )
+                {
+                    continue;
+                }
+                double elevation{ 0 };
+                double value{ 0 };
+                for( const auto v : LRange{ 3 } )
+                {
+                    elevation += coordinates->at( v ) * triangle[v].value( 2 );
+                    value +=
+                        coordinates->at( v ) * values.value( vertices[v] );
+                }
+                value = transformed_value( value );
+                if( !part )
+                {
+                    part = ColumnPart{ elevation, elevation, value, value };
+                    continue;
+                }
+                if( elevation < part->bottom )
+                {
+                    part->bottom = elevation;
+                    part->bottom_value = value;
+                }
+                if( elevation > part->top )
+                {
+                    part->top = elevation;
+                    part->top_value = value;
+                }
+            }
+            if( !part || part->top - part->bottom <= GLOBAL_EPSILON )
+            {
+                return std::nullopt;
+            }
+            return part;
+        }
+
+        static AABBTree3D create_block_aabb_tree(
+            const Impl& impl, const Block3D& block )
+        {
+            const auto& mesh = block.mesh();
+            if( auto saved_boxes = impl.saved_tree_boxes_.take(
+                    block.id(), mesh.nb_polyhedra(), [&mesh] {
+                        return detail::mesh_vertices_fingerprint( mesh );
+                    } ) )
+            {
+                OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                    "ImplicitStructuralModel::block_tree_load", block.id() );
+                return AABBTree3D{ saved_boxes.value() };
+            }
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "ImplicitStructuralModel::block_tree_build", block.id() );
+            return create_aabb_tree( mesh );
+        }
+
+    private:
+        absl::flat_hash_map< uuid, BlockImplicitValues > implicit_attributes_;
         HorizonsStack3D horizons_stack_;
         absl::flat_hash_map< uuid, double > horizon_isovalues_;
         absl::flat_hash_map< uuid, CachedValue< AABBTree3D > >
             block_mesh_aabb_trees_;
+        detail::SavedQueryTreeBoxes3D saved_tree_boxes_;
+        detail::SavedQueryTreeBoxes3D saved_stratigraphic_tree_boxes_;
+        std::optional< std::vector< std::optional< uuid > > > unit_label_table_;
+        absl::flat_hash_map< uuid, BlockUnitLabels > block_unit_labels_;
+        std::uint64_t implicit_values_version_{ 0 };
+        std::uint64_t unit_labels_version_{ 0 };
+        bool may_have_label_attributes_{ true };
         geode::uuid implicit_attribute_id_{};
+        double implicit_value_scale_{ 1 };
+        double implicit_value_offset_{ 0 };
+        STORAGE_PRECISION implicit_value_precision_{
+            STORAGE_PRECISION::double_precision
+        };
     };
 
     ImplicitStructuralModel::ImplicitStructuralModel()
@@ -416,12 +1295,30 @@ namespace geode
         return impl_->implicit_attribute_id();
     }
 
+    ImplicitStructuralModel::STORAGE_PRECISION
+        ImplicitStructuralModel::implicit_value_precision() const
+    {
+        return impl_->implicit_value_precision();
+    }
+
     double ImplicitStructuralModel::implicit_value(
         const Block3D& block, index_t vertex_id ) const
     {
         return impl_->implicit_value( block, vertex_id );
     }
 
+    double ImplicitStructuralModel::stored_implicit_value(
+        const Block3D& block, index_t vertex_id ) const
+    {
+        return impl_->stored_implicit_value( block, vertex_id );
+    }
+
+    bool ImplicitStructuralModel::has_mapped_implicit_values(
+        const Block3D& block ) const
+    {
+        return impl_->has_mapped_implicit_values( block );
+    }
+
     std::optional< double > ImplicitStructuralModel::implicit_value(
         const Block3D& block, const Point3D& point ) const
     {
@@ -434,12 +1331,33 @@ namespace geode
     {
         return impl_->implicit_value( block, point, polyhedron_id );
     }
+    double ImplicitStructuralModel::implicit_value_scale() const
+    {
+        return impl_->implicit_value_scale();
+    }
+
+    double ImplicitStructuralModel::implicit_value_offset() const
+    {
+        return impl_->implicit_value_offset();
+    }
+
     std::optional< index_t > ImplicitStructuralModel::containing_polyhedron(
         const Block3D& block, const Point3D& point ) const
     {
         return impl_->containing_polyhedron( block, point );
     }
 
+    void ImplicitStructuralModel::compute_implicit_query_trees() const
+    {
+        impl_->compute_implicit_query_trees( *this );
+    }
+
+    bool ImplicitStructuralModel::has_implicit_query_tree(
+        const Block3D& block ) const
+    {
+        return impl_->has_implicit_query_tree( block );
+    }
+
     const HorizonsStack3D& ImplicitStructuralModel::horizons_stack() const
     {
         return impl_->horizons_stack();
@@ -465,12 +1383,109 @@ namespace geode
         return impl_->containing_stratigraphic_unit( implicit_function_value );
     }
 
+    StratigraphicColumns ImplicitStructuralModel::stratigraphic_columns(
+        absl::Span< const Point2D > locations ) const
+    {
+        return impl_->stratigraphic_columns( *this, locations );
+    }
+
+    bool ImplicitStructuralModel::has_stratigraphic_unit_labels() const
+    {
+        return impl_->has_stratigraphic_unit_labels( *this );
+    }
+
+    absl::Span< const std::optional< uuid > >
+        ImplicitStructuralModel::stratigraphic_unit_label_table() const
+    {
+        return impl_->stratigraphic_unit_label_table();
+    }
+
+    local_index_t ImplicitStructuralModel::stratigraphic_unit_label(
+        const Block3D& block, index_t tetrahedron_id ) const
+    {
+        return impl_->stratigraphic_unit_label( block, tetrahedron_id );
+    }
+
+    std::optional< uuid >
+        ImplicitStructuralModel::tetrahedron_stratigraphic_unit(
+            const Block3D& block, index_t tetrahedron_id ) const
+    {
+        return impl_->tetrahedron_stratigraphic_unit( block, tetrahedron_id );
+    }
+
+    bool ImplicitStructuralModel::is_cut_by_horizon(
+        const Block3D& block, index_t tetrahedron_id ) const
+    {
+        return impl_->is_cut_by_horizon( block, tetrahedron_id );
+    }
+
     void ImplicitStructuralModel::initialize_implicit_query_trees(
         ImplicitStructuralModelBuilderKey )
     {
         impl_->initialize_implicit_query_trees( *this );
     }
 
+    void ImplicitStructuralModel::set_implicit_query_tree_boxes(
+        const Block3D& block,
+        detail::QueryTreeBoxes3D&& polyhedron_boxes,
+        ImplicitStructuralModelBuilderKey )
+    {
+        impl_->set_implicit_query_tree_boxes(
+            block, std::move( polyhedron_boxes ) );
+    }
+
+    void ImplicitStructuralModel::set_stratigraphic_query_tree_boxes(
+        const Block3D& block,
+        detail::QueryTreeBoxes3D&& polyhedron_boxes,
+        ImplicitStructuralModelBuilderKey )
+    {
+        impl_->set_stratigraphic_query_tree_boxes(
+            block, std::move( polyhedron_boxes ) );
+    }
+
+    const detail::SavedQueryTreeBoxes3D&
+        ImplicitStructuralModel::saved_stratigraphic_query_tree_boxes() const
+    {
+        return impl_->saved_stratigraphic_query_tree_boxes();
+    }
+
+    void ImplicitStructuralModel::compute_stratigraphic_unit_labels(
+        ImplicitStructuralModelBuilderKey )
+    {
+        impl_->compute_stratigraphic_unit_labels( *this );
+    }
+
+    void ImplicitStructuralModel::reset_stratigraphic_unit_labels(
+        ImplicitStructuralModelBuilderKey )
+    {
+        impl_->reset_stratigraphic_unit_labels( *this );
+    }
+
+    void ImplicitStructuralModel::notify_block_implicit_values_change(
+        const Block3D& block, ImplicitStructuralModelBuilderKey )
+    {
+        impl_->invalidate_stratigraphic_unit_labels( *this );
+        impl_->unmap_implicit_values( block );
+        implicit_values_changed( block );
+    }
+
+    void ImplicitStructuralModel::notify_block_mesh_change(
+        const Block3D& block, ImplicitStructuralModelBuilderKey )
+    {
+        impl_->invalidate_stratigraphic_unit_labels( *this );
+        impl_->unmap_implicit_values( block );
+        impl_->reset_block_mesh_aabb_tree( block );
+        implicit_values_changed( block );
+    }
+
+    void ImplicitStructuralModel::map_implicit_values( const Block3D& block,
+        absl::Span< const double > values,
+        std::shared_ptr< const void > owner,
+        ImplicitStructuralModelBuilderKey )
+    {
+        impl_->map_implicit_values( block, values, std::move( owner ) );
+    }
+
     void ImplicitStructuralModel::instantiate_implicit_attribute_on_blocks(
         ImplicitStructuralModelBuilderKey )
     {
@@ -485,10 +1500,35 @@ namespace geode
         do_set_implicit_value( block, vertex_id, value );
     }
 
+    void ImplicitStructuralModel::set_implicit_value_transform( double scale,
+        double offset,
+        ImplicitStructuralModelBuilderKey )
+    {
+        do_set_implicit_value_transform( scale, offset );
+    }
+
+    void ImplicitStructuralModel::bake_implicit_value_transform(
+        ImplicitStructuralModelBuilderKey )
+    {
+        impl_->bake_implicit_value_transform( *this );
+        implicit_values_changed();
+    }
+
+    void ImplicitStructuralModel::set_implicit_value_precision(
+        STORAGE_PRECISION precision, ImplicitStructuralModelBuilderKey )
+    {
+        if( precision == implicit_value_precision() )
+        {
+            return;
+        }
+        impl_->set_implicit_value_precision( *this, precision );
+        implicit_values_changed();
+    }
+
     void ImplicitStructuralModel::set_horizons_stack(
         HorizonsStack3D&& stack, ImplicitStructuralModelBuilderKey )
     {
-        impl_->set_horizons_stack( std::move( stack ) );
+        impl_->set_horizons_stack( *this, std::move( stack ) );
     }
 
     void ImplicitStructuralModel::set_horizon_implicit_value(
@@ -496,21 +1536,40 @@ namespace geode
         double isovalue,
         ImplicitStructuralModelBuilderKey )
     {
-        impl_->set_horizon_implicit_value( horizon, isovalue );
+        impl_->set_horizon_implicit_value( *this, horizon, isovalue );
     }
 
     HorizonsStack3D& ImplicitStructuralModel::modifiable_horizons_stack(
         ImplicitStructuralModelBuilderKey )
     {
-        return impl_->modifiable_horizons_stack();
+        return impl_->modifiable_horizons_stack( *this );
     }
 
     void ImplicitStructuralModel::do_set_implicit_value(
         const Block3D& block, index_t vertex_id, double value )
     {
-        impl_->set_implicit_value( block, vertex_id, value );
+        impl_->set_implicit_value( *this, block, vertex_id, value );
+        implicit_value_changed( block, vertex_id );
+    }
+
+    void ImplicitStructuralModel::do_set_implicit_value_transform(
+        double scale, double offset )
+    {
+        impl_->set_implicit_value_transform( *this, scale, offset );
+        implicit_values_changed();
+    }
+
+    void ImplicitStructuralModel::implicit_value_changed(
+        const Block3D& block, index_t /*unused*/ )
+    {
+        implicit_values_changed( block );
     }
 
+    void ImplicitStructuralModel::implicit_values_changed(
+        const Block3D& /*unused*/ ) {}
+
+    void ImplicitStructuralModel::implicit_values_changed() {}
+
     template < typename Archive >
     void ImplicitStructuralModel::serialize( Archive& archive )
     {
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/core/instrumentation.hpp>
+
+#include <mutex>
+#include <utility>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/btree_map.h>
+
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
+
+namespace
+{
+    class InstrumentationRegistry
+    {
+        using Records = absl::btree_map<
+            std::pair< std::string_view, std::string_view >,
+            geode::InstrumentationRecord >;
+
+    public:
+        static InstrumentationRegistry& instance()
+        {
+            static InstrumentationRegistry registry;
+            return registry;
+        }
+
+        void add( geode::detail::InstrumentationCounter& counter )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            counters_.push_back( &counter );
+        }
+
+        void remove( geode::detail::InstrumentationCounter& counter )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            counters_.erase( absl::c_find( counters_, &counter ) );
+        }
+
+        void add( geode::detail::InstrumentationComponentCounters& counters )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            component_counters_.push_back( &counters );
+        }
+
+        void remove(
+            geode::detail::InstrumentationComponentCounters& counters )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            component_counters_.erase(
+                absl::c_find( component_counters_, &counters ) );
+        }
+
+        std::vector< geode::InstrumentationRecord > snapshot() const
+        {
+            Records records;
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            for( const auto* counter : counters_ )
+            {
+                add_record( records, *counter );
+            }
+            for( const auto* counters : component_counters_ )
+            {
+                counters->visit(
+                    [&records]( const geode::detail::InstrumentationCounter&
+                            counter ) { add_record( records, counter ); } );
+            }
+            std::vector< geode::InstrumentationRecord > result;
+            result.reserve( records.size() );
+            for( auto& [key, record] : records )
+            {
+                record.name = std::string{ key.first };
+                record.component_id = std::string{ key.second };
+                result.push_back( std::move( record ) );
+            }
+            return result;
+        }
+
+        void reset()
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            for( auto* counter : counters_ )
+            {
+                counter->reset();
+            }
+            for( auto* counters : component_counters_ )
+            {
+                counters->clear();
+            }
+        }
+
+    private:
+        static void add_record( Records& records,
+            const geode::detail::InstrumentationCounter& counter )
+        {
+            auto& record = records[std::make_pair(
+                counter.name(), counter.component_id() )];
+            record.count += counter.count();
+            record.seconds +=
+                std::chrono::duration< double >( counter.duration() ).count();
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector< geode::detail::InstrumentationCounter* > counters_;
+        std::vector< geode::detail::InstrumentationComponentCounters* >
+            component_counters_;
+    };
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        InstrumentationCounter::InstrumentationCounter( std::string_view name )
+            : name_( name ), registered_( true )
+        {
+            InstrumentationRegistry::instance().add( *this );
+        }
+
+        InstrumentationCounter::InstrumentationCounter(
+            std::string_view name, std::string component_id )
+            : name_( name ),
+              component_id_( std::move( component_id ) ),
+              registered_( false )
+        {
+        }
+
+        InstrumentationCounter::~InstrumentationCounter()
+        {
+            if( registered_ )
+            {
+                InstrumentationRegistry::instance().remove( *this );
+            }
+        }
+
+        InstrumentationComponentCounters::InstrumentationComponentCounters(
+            std::string_view name )
+            : name_( name ),
+              other_counter_( std::make_shared< InstrumentationCounter >(
+                  name, OTHER_COMPONENTS ) )
+        {
+            InstrumentationRegistry::instance().add( *this );
+        }
+
+        InstrumentationComponentCounters::~InstrumentationComponentCounters()
+        {
+            InstrumentationRegistry::instance().remove( *this );
+        }
+
+        std::shared_ptr< InstrumentationCounter >
+            InstrumentationComponentCounters::counter(
+                const uuid& component_id )
+        {
+            {
+                std::shared_lock< std::shared_mutex > lock{ mutex_ };
+                const auto it = counters_.find( component_id );
+                if( it != counters_.end() )
+                {
+                    return it->second;
+                }
+            }
+            std::lock_guard< std::shared_mutex > lock{ mutex_ };
+            const auto it = counters_.find( component_id );
+            if( it != counters_.end() )
+            {
+                return it->second;
+            }
+            if( counters_.size() >= MAX_COMPONENTS )
+            {
+                return other_counter_;
+            }
+            auto counter = std::make_shared< InstrumentationCounter >(
+                name_, component_id.string() );
+            counters_.emplace( component_id, counter );
+            return counter;
+        }
+
+        void InstrumentationComponentCounters::visit(
+            absl::FunctionRef< void( const InstrumentationCounter& ) >
+                visitor ) const
+        {
+            std::shared_lock< std::shared_mutex > lock{ mutex_ };
+            for( const auto& [component_id, counter] : counters_ )
+            {
+                visitor( *counter );
+            }
+            if( other_counter_->count() > 0 )
+            {
+                visitor( *other_counter_ );
+            }
+        }
+
+        void InstrumentationComponentCounters::clear()
+        {
+            std::lock_guard< std::shared_mutex > lock{ mutex_ };
+            counters_.clear();
+            other_counter_->reset();
+        }
+    } // namespace detail
+
+    bool is_instrumentation_enabled()
+    {
+#ifdef OPENGEODE_GEOSCIENCES_INSTRUMENTATION
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::vector< InstrumentationRecord > instrumentation_snapshot()
+    {
+        return InstrumentationRegistry::instance().snapshot();
+    }
+
+    void reset_instrumentation()
+    {
+        InstrumentationRegistry::instance().reset();
+    }
+} // namespace geode
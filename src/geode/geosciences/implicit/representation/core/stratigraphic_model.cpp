@@ -23,6 +23,9 @@
 
 #include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
 
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_set.h>
+
 #include <async++.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -48,9 +51,13 @@
 #include <geode/model/helpers/component_mesh_polygons.hpp>
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/mixin/core/vertex_identifier.hpp>
 #include <geode/model/representation/core/detail/model_component.hpp>
 
 #include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/query_tree_boxes.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
 
 namespace geode
 {
@@ -125,7 +132,7 @@ namespace geode
             index_t tetrahedron_id ) const
         {
             PositiveStratigraphicTetrahedron pos_volume_strati_tetrahedron{
-                model, block, tetrahedron_id
+                block_coordinates( model, block ), block, tetrahedron_id
             };
             const auto barycentric_coords = tetrahedron_barycentric_coordinates(
                 stratigraphic_point.stratigraphic_coordinates(),
@@ -146,12 +153,17 @@ namespace geode
             const Block3D& block,
             const StratigraphicPoint3D& stratigraphic_point ) const
         {
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "StratigraphicModel::stratigraphic_containing_polyhedron",
+                block.id() );
+            const auto coordinates = block_coordinates( model, block );
             const auto& block_stratigraphic_aabb =
                 block_stratigraphic_aabb_trees_.at( block.id() )(
-                    create_stratigraphic_aabb_tree, model, block );
+                    create_stratigraphic_aabb_tree, model, block,
+                    coordinates );
             const auto& starti_point =
                 stratigraphic_point.stratigraphic_coordinates();
-            StratigraphicDistanceToTetrahedron distance_to_tetra{ model,
+            StratigraphicDistanceToTetrahedron distance_to_tetra{ coordinates,
                 block };
             auto closest_tetrahedron =
                 std::get< 0 >( block_stratigraphic_aabb.closest_element_box(
@@ -161,6 +173,9 @@ namespace geode
             {
                 return closest_tetrahedron;
             }
+            OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                "StratigraphicModel::stratigraphic_containing_polyhedron_"
+                "failure", block.id() );
             return std::nullopt;
         }
 
@@ -188,6 +203,46 @@ namespace geode
                 "surface is not boundary nor internal of the given block." };
         }
 
+        absl::flat_hash_map< uuid,
+            absl::InlinedVector< std::unique_ptr< TriangulatedSurface3D >, 2 > >
+            stratigraphic_surfaces(
+                const StratigraphicModel& model, const Block3D& block ) const
+        {
+            std::vector< std::reference_wrapper< const Surface3D > > surfaces;
+            for( const auto& surface : model.boundaries( block ) )
+            {
+                surfaces.emplace_back( surface );
+            }
+            for( const auto& surface : model.internal_surfaces( block ) )
+            {
+                surfaces.emplace_back( surface );
+            }
+            const BlockSurfacesFacets block_facets{ model, block, surfaces };
+            const auto coordinates = block_coordinates( model, block );
+            absl::FixedArray< absl::InlinedVector<
+                std::unique_ptr< TriangulatedSurface3D >, 2 > >
+                strati_surfaces( surfaces.size() );
+            async::parallel_for(
+                async::irange( std::size_t{ 0 }, surfaces.size() ),
+                [&strati_surfaces, &surfaces, &block_facets, &coordinates,
+                    &model, &block]( std::size_t s ) {
+                    strati_surfaces[s] =
+                        stratigraphic_surface_from_facets( model, block,
+                            surfaces[s].get(), block_facets, coordinates );
+                } );
+            absl::flat_hash_map< uuid,
+                absl::InlinedVector< std::unique_ptr< TriangulatedSurface3D >,
+                    2 > >
+                result;
+            result.reserve( surfaces.size() );
+            for( const auto s : Indices{ surfaces } )
+            {
+                result.emplace(
+                    surfaces[s].get().id(), std::move( strati_surfaces[s] ) );
+            }
+            return result;
+        }
+
         void instantiate_stratigraphic_location_on_blocks(
             const StratigraphicModel& model )
         {
@@ -222,23 +277,36 @@ namespace geode
             }
         }
 
+        void compute_stratigraphic_query_trees(
+            const StratigraphicModel& model ) const
+        {
+            compute_stratigraphic_aabb_trees( model );
+        }
+
+        bool has_stratigraphic_query_tree( const Block3D& block ) const
+        {
+            const auto tree =
+                block_stratigraphic_aabb_trees_.find( block.id() );
+            return tree != block_stratigraphic_aabb_trees_.end()
+                   && tree->second.computed();
+        }
+
         BoundingBox3D stratigraphic_bounding_box(
             const StratigraphicModel& model ) const
         {
+            const auto& trees = compute_stratigraphic_aabb_trees( model );
             BoundingBox3D box;
-            for( const auto& stratigraphic_tree :
-                block_stratigraphic_aabb_trees_ )
+            for( const auto* tree : trees )
             {
-                box.add_box( stratigraphic_tree
-                        .second( create_stratigraphic_aabb_tree, model,
-                            model.block( stratigraphic_tree.first ) )
-                        .bounding_box() );
+                box.add_box( tree->bounding_box() );
             }
             return box;
         }
 
-        void set_stratigraphic_location(
-            const Block3D& block, index_t vertex_id, Point2D value )
+        void set_stratigraphic_location( const StratigraphicModel& model,
+            const Block3D& block,
+            index_t vertex_id,
+            Point2D value )
         {
             OpenGeodeGeosciencesImplicitException::check_exception(
                 stratigraphic_location_attributes_.find( block.id() )
@@ -250,37 +318,174 @@ namespace geode
             stratigraphic_location_attributes_.at( block.id() )
                 .set_value( vertex_id, std::move( value ) );
             reset_stratigraphic_aabb_tree( block );
+            update_interleaved_stratigraphic_coordinates(
+                model, block, vertex_id );
         }
 
         void reset_stratigraphic_aabb_tree( const Block3D& block )
         {
+            OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                "StratigraphicModel::block_tree_reset", block.id() );
             block_stratigraphic_aabb_trees_.at( block.id() ).reset();
         }
 
+        void reset_stratigraphic_aabb_trees()
+        {
+            for( auto& tree : block_stratigraphic_aabb_trees_ )
+            {
+                OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                    "StratigraphicModel::block_tree_reset", tree.first );
+                tree.second.reset();
+            }
+        }
+
+        void update_interleaved_stratigraphic_coordinates(
+            const StratigraphicModel& model,
+            const Block3D& block,
+            index_t vertex_id )
+        {
+            const auto coordinates =
+                block_interleaved_coordinates_.find( block.id() );
+            if( coordinates == block_interleaved_coordinates_.end()
+                || vertex_id >= coordinates->second->size() )
+            {
+                return;
+            }
+            auto& store = coordinates->second;
+            if( store.use_count() > 1 )
+            {
+                // Shared with snapshots: copy on write to keep them unchanged
+                store = std::make_shared< std::vector< StratigraphicPoint3D > >(
+                    *store );
+            }
+            ( *store )[vertex_id] =
+                model.stratigraphic_coordinates( block, vertex_id );
+        }
+
+        void update_interleaved_stratigraphic_coordinates(
+            const StratigraphicModel& model, const Block3D& block )
+        {
+            if( !use_interleaved_coordinates_ )
+            {
+                return;
+            }
+            block_interleaved_coordinates_[block.id()] =
+                std::make_shared< std::vector< StratigraphicPoint3D > >(
+                    create_interleaved_stratigraphic_coordinates(
+                        model, block ) );
+        }
+
+        void update_interleaved_stratigraphic_coordinates(
+            const StratigraphicModel& model )
+        {
+            block_interleaved_coordinates_.clear();
+            if( !use_interleaved_coordinates_ )
+            {
+                return;
+            }
+            for( const auto& block : model.blocks() )
+            {
+                update_interleaved_stratigraphic_coordinates( model, block );
+            }
+        }
+
+        absl::Span< const StratigraphicPoint3D >
+            interleaved_stratigraphic_coordinates( const Block3D& block ) const
+        {
+            const auto coordinates =
+                block_interleaved_coordinates_.find( block.id() );
+            if( coordinates == block_interleaved_coordinates_.end() )
+            {
+                return {};
+            }
+            return *coordinates->second;
+        }
+
+        std::shared_ptr< const std::vector< StratigraphicPoint3D > >
+            interleaved_stratigraphic_coordinates_snapshot(
+                const Block3D& block ) const
+        {
+            const auto coordinates =
+                block_interleaved_coordinates_.find( block.id() );
+            if( coordinates == block_interleaved_coordinates_.end() )
+            {
+                return nullptr;
+            }
+            return coordinates->second;
+        }
+
+        bool uses_interleaved_stratigraphic_coordinates() const
+        {
+            return use_interleaved_coordinates_;
+        }
+
+        void set_interleaved_stratigraphic_coordinates(
+            const StratigraphicModel& model, bool use )
+        {
+            if( use == use_interleaved_coordinates_ )
+            {
+                return;
+            }
+            use_interleaved_coordinates_ = use;
+            update_interleaved_stratigraphic_coordinates( model );
+        }
+
         const uuid& stratigraphic_location_attribute_id() const
         {
             return stratigraphic_location_attribute_id_;
         }
 
     private:
+        /*!
+         * Stratigraphic coordinates of the block vertices, read from the
+         * interleaved store when it is in use, from the location and implicit
+         * attributes otherwise.
+         */
+        class BlockStratigraphicCoordinates
+        {
+        public:
+            BlockStratigraphicCoordinates( const StratigraphicModel& model,
+                const Block3D& block,
+                absl::Span< const StratigraphicPoint3D > interleaved )
+                : model_( model ), block_( block ), interleaved_( interleaved )
+            {
+            }
+
+            Point3D operator()( index_t vertex_id ) const
+            {
+                if( !interleaved_.empty() )
+                {
+                    return interleaved_[vertex_id].stratigraphic_coordinates();
+                }
+                return model_.stratigraphic_coordinates( block_, vertex_id )
+                    .stratigraphic_coordinates();
+            }
+
+        private:
+            const StratigraphicModel& model_;
+            const Block3D& block_;
+            absl::Span< const StratigraphicPoint3D > interleaved_;
+        };
+
+        BlockStratigraphicCoordinates block_coordinates(
+            const StratigraphicModel& model, const Block3D& block ) const
+        {
+            return { model, block,
+                interleaved_stratigraphic_coordinates( block ) };
+        }
+
         struct PositiveStratigraphicTetrahedron
         {
             PositiveStratigraphicTetrahedron() = delete;
-            PositiveStratigraphicTetrahedron( const StratigraphicModel& model,
+            PositiveStratigraphicTetrahedron(
+                const BlockStratigraphicCoordinates& coordinates,
                 const Block3D& block,
                 index_t tetrahedron_id )
                 : indices_{ block.mesh().polyhedron_vertices(
                       tetrahedron_id ) },
-                  positive_tetra_{
-                      model.stratigraphic_coordinates( block, indices_[0] )
-                          .stratigraphic_coordinates(),
-                      model.stratigraphic_coordinates( block, indices_[1] )
-                          .stratigraphic_coordinates(),
-                      model.stratigraphic_coordinates( block, indices_[2] )
-                          .stratigraphic_coordinates(),
-                      model.stratigraphic_coordinates( block, indices_[3] )
-                          .stratigraphic_coordinates()
-                  }
+                  positive_tetra_{ coordinates( indices_[0] ),
+                      coordinates( indices_[1] ), coordinates( indices_[2] ),
+                      coordinates( indices_[3] ) }
             {
                 if( tetrahedron_signed_volume( positive_tetra_ ) < 0 )
                 {
@@ -300,16 +505,18 @@ namespace geode
         {
         public:
             StratigraphicDistanceToTetrahedron(
-                const StratigraphicModel& model, const Block3D& block )
-                : model_( model ), block_( block )
+                const BlockStratigraphicCoordinates& coordinates,
+                const Block3D& block )
+                : coordinates_( coordinates ), block_( block )
             {
             }
 
             double operator()(
                 const StratigraphicPoint3D& query, index_t cur_box ) const
             {
-                auto positive_tetra =
-                    PositiveStratigraphicTetrahedron{ model_, block_, cur_box };
+                auto positive_tetra = PositiveStratigraphicTetrahedron{
+                    coordinates_, block_, cur_box
+                };
                 auto output = point_tetrahedron_distance(
                     query.stratigraphic_coordinates(),
                     positive_tetra.positive_tetra_ );
@@ -317,27 +524,304 @@ namespace geode
             }
 
         private:
-            const StratigraphicModel& model_;
+            const BlockStratigraphicCoordinates& coordinates_;
             const Block3D& block_;
         };
 
+        absl::FixedArray< const AABBTree3D* > compute_stratigraphic_aabb_trees(
+            const StratigraphicModel& model ) const
+        {
+            absl::FixedArray< const Block3D* > blocks(
+                block_stratigraphic_aabb_trees_.size() );
+            index_t nb_blocks{ 0 };
+            for( const auto& block : model.blocks() )
+            {
+                if( block_stratigraphic_aabb_trees_.contains( block.id() ) )
+                {
+                    blocks[nb_blocks++] = &block;
+                }
+            }
+            absl::FixedArray< const AABBTree3D* > trees( nb_blocks );
+            async::parallel_for( async::irange( index_t{ 0 }, nb_blocks ),
+                [&blocks, &trees, &model, this]( index_t b ) {
+                    const auto& block = *blocks[b];
+                    const auto& tree =
+                        block_stratigraphic_aabb_trees_.at( block.id() )(
+                            create_stratigraphic_aabb_tree, model, block,
+                            block_coordinates( model, block ) );
+                    trees[b] = &tree;
+                } );
+            return trees;
+        }
+
+        struct SurfacePolygonFacet
+        {
+            PolyhedronFacet facet;
+            std::array< index_t, 3 > vertices;
+            bool same_orientation;
+        };
+
+        /*!
+         * Index of the block polyhedron facets lying on a set of surfaces,
+         * keyed by the sorted unique vertices of the facets.
+         */
+        class BlockSurfacesFacets
+        {
+            struct IndexedFacet
+            {
+                PolyhedronFacet facet;
+                std::array< index_t, 3 > vertices;
+                std::array< index_t, 3 > unique_vertices;
+            };
+
+        public:
+            BlockSurfacesFacets( const StratigraphicModel& model,
+                const Block3D& block,
+                absl::Span< const std::reference_wrapper< const Surface3D > >
+                    surfaces )
+                : model_( model )
+            {
+                absl::flat_hash_set< index_t > surface_unique_vertices;
+                for( const auto& surface : surfaces )
+                {
+                    const auto& surface_mesh = surface.get().mesh();
+                    for( const auto v : Range{ surface_mesh.nb_vertices() } )
+                    {
+                        surface_unique_vertices.insert( model.unique_vertex(
+                            { surface.get().component_id(), v } ) );
+                    }
+                }
+                const auto& block_mesh = block.mesh();
+                for( const auto p : Range{ block_mesh.nb_polyhedra() } )
+                {
+                    for( const auto f :
+                        LRange{ block_mesh.nb_polyhedron_facets( p ) } )
+                    {
+                        const PolyhedronFacet facet{ p, f };
+                        const auto facet_vertices =
+                            block_mesh.polyhedron_facet_vertices( facet );
+                        if( facet_vertices.size() != 3 )
+                        {
+                            continue;
+                        }
+                        IndexedFacet indexed{ facet, {}, {} };
+                        bool on_surfaces{ true };
+                        for( const auto v : LIndices{ facet_vertices } )
+                        {
+                            indexed.vertices[v] = facet_vertices[v];
+                            indexed.unique_vertices[v] = model.unique_vertex(
+                                { block.component_id(), facet_vertices[v] } );
+                            if( !surface_unique_vertices.contains(
+                                    indexed.unique_vertices[v] ) )
+                            {
+                                on_surfaces = false;
+                                break;
+                            }
+                        }
+                        if( !on_surfaces )
+                        {
+                            continue;
+                        }
+                        auto key = indexed.unique_vertices;
+                        absl::c_sort( key );
+                        facets_[key].push_back( std::move( indexed ) );
+                    }
+                }
+            }
+
+            absl::InlinedVector< SurfacePolygonFacet, 2 > polygon_facets(
+                const Surface3D& surface, index_t polygon_id ) const
+            {
+                const auto& surface_mesh = surface.mesh();
+                std::array< index_t, 3 > polygon_unique_vertices;
+                for( const auto v : LRange{ 3 } )
+                {
+                    polygon_unique_vertices[v] = model_.unique_vertex(
+                        { surface.component_id(),
+                            surface_mesh.polygon_vertex( { polygon_id, v } ) } );
+                }
+                auto key = polygon_unique_vertices;
+                absl::c_sort( key );
+                absl::InlinedVector< SurfacePolygonFacet, 2 > result;
+                const auto it = facets_.find( key );
+                if( it == facets_.end() )
+                {
+                    return result;
+                }
+                for( const auto& indexed : it->second )
+                {
+                    std::array< local_index_t, 3 > positions;
+                    for( const auto v : LRange{ 3 } )
+                    {
+                        positions[v] = static_cast< local_index_t >(
+                            absl::c_find( indexed.unique_vertices,
+                                polygon_unique_vertices[v] )
+                            - indexed.unique_vertices.begin() );
+                    }
+                    auto& polygon_facet = result.emplace_back();
+                    polygon_facet.facet = indexed.facet;
+                    for( const auto v : LRange{ 3 } )
+                    {
+                        polygon_facet.vertices[v] =
+                            indexed.vertices[positions[v]];
+                    }
+                    polygon_facet.same_orientation =
+                        positions[1] == ( positions[0] + 1 ) % 3;
+                }
+                return result;
+            }
+
+        private:
+            const StratigraphicModel& model_;
+            absl::flat_hash_map< std::array< index_t, 3 >,
+                absl::InlinedVector< IndexedFacet, 2 > >
+                facets_;
+        };
+
+        static absl::InlinedVector< std::unique_ptr< TriangulatedSurface3D >,
+            2 >
+            stratigraphic_surface_from_facets( const StratigraphicModel& model,
+                const Block3D& block,
+                const Surface3D& surface,
+                const BlockSurfacesFacets& block_facets,
+                const BlockStratigraphicCoordinates& coordinates )
+        {
+            const auto is_internal = model.is_internal( surface, block );
+            const local_index_t nb_sides = is_internal ? 2 : 1;
+            const auto& surface_mesh = surface.mesh< TriangulatedSurface3D >();
+            absl::InlinedVector< std::unique_ptr< TriangulatedSurface3D >, 2 >
+                strati_surfaces;
+            absl::InlinedVector< std::unique_ptr< SurfaceMeshBuilder3D >, 2 >
+                strati_surface_builders;
+            absl::InlinedVector<
+                std::shared_ptr< VariableAttribute< PolyhedronFacet > >, 2 >
+                associated_polyhedron_facet_attributes;
+            for( const auto side : LRange{ nb_sides } )
+            {
+                strati_surfaces.emplace_back( surface_mesh.clone() );
+                strati_surface_builders.emplace_back(
+                    SurfaceMeshBuilder3D::create( *strati_surfaces[side] ) );
+                associated_polyhedron_facet_attributes.emplace_back(
+                    create_polyhedron_facet_attribute(
+                        *strati_surfaces[side] ) );
+            }
+            std::vector< bool > vertices_checked(
+                surface_mesh.nb_vertices(), false );
+            for( const auto polygon_id : Range{ surface_mesh.nb_polygons() } )
+            {
+                auto polygon_facets =
+                    block_facets.polygon_facets( surface, polygon_id );
+                OpenGeodeGeosciencesImplicitException::check_exception(
+                    polygon_facets.size() == nb_sides,
+                    surface_mesh.polygon_barycenter( polygon_id ),
+                    OpenGeodeException::TYPE::internal,
+                    "[StratigraphicModel::stratigraphic_surfaces] Did not "
+                    "find ",
+                    nb_sides,
+                    " polyhedra in the given block from a polygon of the "
+                    "surface ",
+                    surface.id().string() );
+                if( is_internal && !polygon_facets[0].same_orientation )
+                {
+                    std::swap( polygon_facets[0], polygon_facets[1] );
+                }
+                for( const auto side : LRange{ nb_sides } )
+                {
+                    associated_polyhedron_facet_attributes[side]->set_value(
+                        polygon_id, polygon_facets[side].facet );
+                }
+                for( const auto polygon_vertex_id : LRange{ 3 } )
+                {
+                    const auto vertex_id = surface_mesh.polygon_vertex(
+                        { polygon_id, polygon_vertex_id } );
+                    if( vertices_checked[vertex_id] )
+                    {
+                        continue;
+                    }
+                    vertices_checked[vertex_id] = true;
+                    for( const auto side : LRange{ nb_sides } )
+                    {
+                        strati_surface_builders[side]->set_point( vertex_id,
+                            coordinates( polygon_facets[side]
+                                             .vertices[polygon_vertex_id] ) );
+                    }
+                }
+            }
+            return strati_surfaces;
+        }
+
+        static std::shared_ptr< VariableAttribute< PolyhedronFacet > >
+            create_polyhedron_facet_attribute(
+                TriangulatedSurface3D& strati_surface )
+        {
+            AttributeValues< PolyhedronFacet >
+                associated_polyhedron_facet_default_values;
+            associated_polyhedron_facet_default_values.default_value = {};
+            associated_polyhedron_facet_default_values.no_value = {};
+            AttributeProperties associated_polyhedron_facet_properties;
+            associated_polyhedron_facet_properties.assignable = false;
+            associated_polyhedron_facet_properties.interpolable = false;
+            associated_polyhedron_facet_properties.transferable = true;
+            const auto associated_polyhedron_facet_attribute_id =
+                strati_surface.polygon_attribute_manager()
+                    .create_attribute< VariableAttribute, PolyhedronFacet >(
+                        STRATIGRAPHIC_SURFACE_POLYHEDRON_FACET_ATTRIBUTE_NAME,
+                        associated_polyhedron_facet_default_values,
+                        associated_polyhedron_facet_properties );
+            return strati_surface.polygon_attribute_manager()
+                .find_attribute< VariableAttribute, PolyhedronFacet >(
+                    associated_polyhedron_facet_attribute_id );
+        }
+
+        static std::vector< StratigraphicPoint3D >
+            create_interleaved_stratigraphic_coordinates(
+                const StratigraphicModel& model, const Block3D& block )
+        {
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "StratigraphicModel::interleaved_coordinates_build",
+                block.id() );
+            std::vector< StratigraphicPoint3D > coordinates(
+                block.mesh().nb_vertices() );
+            async::parallel_for(
+                async::irange( index_t{ 0 }, block.mesh().nb_vertices() ),
+                [&coordinates, &block, &model]( index_t v ) {
+                    coordinates[v] =
+                        model.stratigraphic_coordinates( block, v );
+                } );
+            return coordinates;
+        }
+
         static AABBTree3D create_stratigraphic_aabb_tree(
-            const StratigraphicModel& model, const Block3D& block )
+            const StratigraphicModel& model,
+            const Block3D& block,
+            const BlockStratigraphicCoordinates& coordinates )
         {
             const auto& block_mesh = block.mesh();
+            const auto fingerprint = [&model, &block] {
+                return detail::block_stratigraphic_coordinates_fingerprint(
+                    model, block );
+            };
+            if( auto saved_boxes =
+                    model.saved_stratigraphic_query_tree_boxes().take(
+                        block.id(), block_mesh.nb_polyhedra(), fingerprint ) )
+            {
+                OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                    "StratigraphicModel::block_tree_load", block.id() );
+                return AABBTree3D{ saved_boxes.value() };
+            }
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "StratigraphicModel::block_tree_build", block.id() );
             absl::FixedArray< BoundingBox3D > box_vector(
                 block_mesh.nb_polyhedra() );
             async::parallel_for(
                 async::irange( index_t{ 0 }, block_mesh.nb_polyhedra() ),
-                [&box_vector, &block, &block_mesh, &model]( index_t p ) {
+                [&box_vector, &block_mesh, &coordinates]( index_t p ) {
                     BoundingBox3D bbox;
                     for( const auto v :
                         LRange{ block_mesh.nb_polyhedron_vertices( p ) } )
                     {
-                        bbox.add_point( model
-                                .stratigraphic_coordinates( block,
-                                    block_mesh.polyhedron_vertex( { p, v } ) )
-                                .stratigraphic_coordinates() );
+                        bbox.add_point( coordinates(
+                            block_mesh.polyhedron_vertex( { p, v } ) ) );
                     }
                     box_vector[p] = std::move( bbox );
                 } );
@@ -372,6 +856,7 @@ namespace geode
                     .find_attribute< VariableAttribute, PolyhedronFacet >(
                         associated_polyhedron_facet_attribute_id );
             const auto& surface_mesh = surface.mesh< TriangulatedSurface3D >();
+            const auto coordinates = block_coordinates( model, block );
             std::vector< bool > vertices_checked(
                 surface_mesh.nb_vertices(), false );
             for( const auto polygon_id : Range{ surface_mesh.nb_polygons() } )
@@ -396,11 +881,9 @@ namespace geode
                         continue;
                     }
                     vertices_checked[vertex_id] = true;
-                    strati_surface_builder->set_point(
-                        vertex_id, stratigraphic_coordinates( model, block,
-                                       polygon_block_vertices.front()
-                                           .vertices[polygon_vertex_id] )
-                                       .stratigraphic_coordinates() );
+                    strati_surface_builder->set_point( vertex_id,
+                        coordinates( polygon_block_vertices.front()
+                                         .vertices[polygon_vertex_id] ) );
                 }
                 associated_polyhedron_facet_attribute->set_value(
                     polygon_id, polygon_block_vertices.front().facet );
@@ -447,6 +930,7 @@ namespace geode
                         .find_attribute< VariableAttribute, PolyhedronFacet >(
                             associated_polyhedron_facet_attribute_id );
             }
+            const auto coordinates = block_coordinates( model, block );
             std::vector< bool > vertices_checked(
                 surface_mesh.nb_vertices(), false );
             for( const auto polygon_id : Range{ surface_mesh.nb_polygons() } )
@@ -472,17 +956,15 @@ namespace geode
                     }
                     vertices_checked[vertex_id] = true;
                     strati_surface_builders[0]->set_point( vertex_id,
-                        stratigraphic_coordinates( model, block,
+                        coordinates(
                             polygon_block_vertices.oriented_polyhedron_facet
                                 .value()
-                                .vertices[polygon_vertex_id] )
-                            .stratigraphic_coordinates() );
+                                .vertices[polygon_vertex_id] ) );
                     strati_surface_builders[1]->set_point( vertex_id,
-                        stratigraphic_coordinates( model, block,
+                        coordinates(
                             polygon_block_vertices.opposite_polyhedron_facet
                                 .value()
-                                .vertices[polygon_vertex_id] )
-                            .stratigraphic_coordinates() );
+                                .vertices[polygon_vertex_id] ) );
                 }
                 associated_polyhedron_facet_attributes[0]->set_value(
                     polygon_id,
@@ -501,6 +983,10 @@ namespace geode
             stratigraphic_location_attributes_;
         absl::flat_hash_map< uuid, CachedValue< AABBTree3D > >
             block_stratigraphic_aabb_trees_;
+        absl::flat_hash_map< uuid,
+            std::shared_ptr< std::vector< StratigraphicPoint3D > > >
+            block_interleaved_coordinates_;
+        bool use_interleaved_coordinates_{ false };
         geode::uuid stratigraphic_location_attribute_id_{};
     };
 
@@ -613,6 +1099,30 @@ namespace geode
         return impl_->stratigraphic_surface( *this, block, surface );
     }
 
+    void StratigraphicModel::compute_stratigraphic_query_trees() const
+    {
+        async::parallel_invoke(
+            [this] {
+                compute_implicit_query_trees();
+            },
+            [this] {
+                impl_->compute_stratigraphic_query_trees( *this );
+            } );
+    }
+
+    bool StratigraphicModel::has_stratigraphic_query_tree(
+        const Block3D& block ) const
+    {
+        return impl_->has_stratigraphic_query_tree( block );
+    }
+
+    absl::flat_hash_map< uuid,
+        absl::InlinedVector< std::unique_ptr< TriangulatedSurface3D >, 2 > >
+        StratigraphicModel::stratigraphic_surfaces( const Block3D& block ) const
+    {
+        return impl_->stratigraphic_surfaces( *this, block );
+    }
+
     BoundingBox3D StratigraphicModel::stratigraphic_bounding_box() const
     {
         return impl_->stratigraphic_bounding_box( *this );
@@ -623,6 +1133,25 @@ namespace geode
         return impl_->stratigraphic_location_attribute_id();
     }
 
+    absl::Span< const StratigraphicPoint3D >
+        StratigraphicModel::interleaved_stratigraphic_coordinates(
+            const Block3D& block ) const
+    {
+        return impl_->interleaved_stratigraphic_coordinates( block );
+    }
+
+    std::shared_ptr< const std::vector< StratigraphicPoint3D > >
+        StratigraphicModel::interleaved_stratigraphic_coordinates_snapshot(
+            const Block3D& block ) const
+    {
+        return impl_->interleaved_stratigraphic_coordinates_snapshot( block );
+    }
+
+    bool StratigraphicModel::uses_interleaved_stratigraphic_coordinates() const
+    {
+        return impl_->uses_interleaved_stratigraphic_coordinates();
+    }
+
     void StratigraphicModel::initialize_stratigraphic_query_trees(
         StratigraphicModelBuilderKey )
     {
@@ -635,12 +1164,24 @@ namespace geode
         impl_->instantiate_stratigraphic_location_on_blocks( *this );
     }
 
-    void StratigraphicModel::do_set_implicit_value(
-        const Block3D& block, index_t vertex_id, implicit_attribute_type value )
+    void StratigraphicModel::implicit_value_changed(
+        const Block3D& block, index_t vertex_id )
     {
-        ImplicitStructuralModel::do_set_implicit_value(
-            block, vertex_id, value );
         impl_->reset_stratigraphic_aabb_tree( block );
+        impl_->update_interleaved_stratigraphic_coordinates(
+            *this, block, vertex_id );
+    }
+
+    void StratigraphicModel::implicit_values_changed( const Block3D& block )
+    {
+        impl_->reset_stratigraphic_aabb_tree( block );
+        impl_->update_interleaved_stratigraphic_coordinates( *this, block );
+    }
+
+    void StratigraphicModel::implicit_values_changed()
+    {
+        impl_->reset_stratigraphic_aabb_trees();
+        impl_->update_interleaved_stratigraphic_coordinates( *this );
     }
 
     void StratigraphicModel::set_stratigraphic_location( const Block3D& block,
@@ -648,6 +1189,19 @@ namespace geode
         Point2D value,
         StratigraphicModelBuilderKey )
     {
-        impl_->set_stratigraphic_location( block, vertex_id, value );
+        impl_->set_stratigraphic_location(
+            *this, block, vertex_id, std::move( value ) );
+    }
+
+    void StratigraphicModel::set_interleaved_stratigraphic_coordinates(
+        bool use, StratigraphicModelBuilderKey )
+    {
+        impl_->set_interleaved_stratigraphic_coordinates( *this, use );
+    }
+
+    void StratigraphicModel::notify_stratigraphic_locations_change(
+        StratigraphicModelBuilderKey )
+    {
+        implicit_values_changed();
     }
-} // namespace geode
\ No newline at end of file
+} // namespace geode
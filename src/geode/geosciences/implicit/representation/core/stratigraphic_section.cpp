@@ -23,6 +23,8 @@
 
 #include <geode/geosciences/implicit/representation/core/stratigraphic_section.hpp>
 
+#include <absl/container/fixed_array.h>
+
 #include <async++.h>
 
 #include <geode/basic/attribute_manager.hpp>
@@ -51,6 +53,7 @@
 #include <geode/model/representation/core/detail/model_component.hpp>
 
 #include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
 
 namespace geode
 {
@@ -146,6 +149,9 @@ namespace geode
             const Surface2D& surface,
             const StratigraphicPoint2D& stratigraphic_point ) const
         {
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "StratigraphicSection::stratigraphic_containing_polygon",
+                surface.id() );
             StratigraphicDistanceToTriangle distance_to_triangles{ model,
                 surface };
             const auto closest_triangle =
@@ -160,6 +166,9 @@ namespace geode
             {
                 return closest_triangle;
             }
+            OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                "StratigraphicSection::stratigraphic_containing_polygon_"
+                "failure", surface.id() );
             return std::nullopt;
         }
 
@@ -186,6 +195,27 @@ namespace geode
                 "line is not boundary nor internal of the given surface." };
         }
 
+        void compute_stratigraphic_query_trees(
+            const StratigraphicSection& model ) const
+        {
+            absl::FixedArray< const Surface2D* > surfaces(
+                model.nb_surfaces() );
+            index_t nb_surfaces{ 0 };
+            for( const auto& surface : model.surfaces() )
+            {
+                if( surface_stratigraphic_aabb_trees_.contains( surface.id() ) )
+                {
+                    surfaces[nb_surfaces++] = &surface;
+                }
+            }
+            async::parallel_for( async::irange( index_t{ 0 }, nb_surfaces ),
+                [&surfaces, &model, this]( index_t s ) {
+                    const auto& surface = *surfaces[s];
+                    surface_stratigraphic_aabb_trees_.at( surface.id() )(
+                        create_stratigraphic_aabb_tree, model, surface );
+                } );
+        }
+
         BoundingBox2D stratigraphic_bounding_box(
             const StratigraphicSection& model ) const
         {
@@ -254,9 +284,21 @@ namespace geode
 
         void reset_stratigraphic_aabb_tree( const Surface2D& surface )
         {
+            OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                "StratigraphicSection::surface_tree_reset", surface.id() );
             surface_stratigraphic_aabb_trees_.at( surface.id() ).reset();
         }
 
+        void reset_stratigraphic_aabb_trees()
+        {
+            for( auto& tree : surface_stratigraphic_aabb_trees_ )
+            {
+                OPENGEODE_GEOSCIENCES_COUNT_COMPONENT_EVENT(
+                    "StratigraphicSection::surface_tree_reset", tree.first );
+                tree.second.reset();
+            }
+        }
+
         const uuid& stratigraphic_location_attribute_id() const
         {
             return stratigraphic_location_attribute_id_;
@@ -319,6 +361,8 @@ namespace geode
         static AABBTree2D create_stratigraphic_aabb_tree(
             const StratigraphicSection& model, const Surface2D& surface )
         {
+            OPENGEODE_GEOSCIENCES_TIME_COMPONENT_SCOPE(
+                "StratigraphicSection::surface_tree_build", surface.id() );
             const auto& surface_mesh = surface.mesh();
             absl::FixedArray< BoundingBox2D > box_vector(
                 surface_mesh.nb_polygons() );
@@ -592,6 +636,17 @@ namespace geode
         return impl_->stratigraphic_line( *this, surface, line );
     }
 
+    void StratigraphicSection::compute_stratigraphic_query_trees() const
+    {
+        async::parallel_invoke(
+            [this] {
+                compute_implicit_query_trees();
+            },
+            [this] {
+                impl_->compute_stratigraphic_query_trees( *this );
+            } );
+    }
+
     BoundingBox2D StratigraphicSection::stratigraphic_bounding_box() const
     {
         return impl_->stratigraphic_bounding_box( *this );
@@ -623,6 +678,13 @@ namespace geode
         impl_->reset_stratigraphic_aabb_tree( surface );
     }
 
+    void StratigraphicSection::do_set_implicit_value_transform(
+        double scale, double offset )
+    {
+        ImplicitCrossSection::do_set_implicit_value_transform( scale, offset );
+        impl_->reset_stratigraphic_aabb_trees();
+    }
+
     void StratigraphicSection::set_stratigraphic_location(
         const Surface2D& surface,
         index_t vertex_id,
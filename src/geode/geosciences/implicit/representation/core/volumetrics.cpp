@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/core/volumetrics.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+
+#include <async++.h>
+
+#include <geode/basic/attribute_manager.hpp>
+
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
+#include <geode/geometry/mensuration.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+
+#include <geode/geosciences/explicit/mixin/core/fault_block.hpp>
+#include <geode/geosciences/implicit/representation/core/batch_queries.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/stratigraphic_unit_intervals.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+
+namespace
+{
+    constexpr geode::index_t TETRAHEDRON_CHUNK_SIZE{ 4096 };
+
+    /*!
+     * Returns the fraction of the tetrahedron volume where the linear field
+     * interpolating the given vertex values is lower than or equal to the
+     * isovalue.
+     */
+    double volume_fraction_below(
+        std::array< double, 4 > values, double isovalue )
+    {
+        absl::c_sort( values );
+        const auto nb_below = static_cast< geode::local_index_t >(
+            absl::c_upper_bound( values, isovalue ) - values.begin() );
+        const auto ratio = [&values, isovalue](
+                               geode::local_index_t from,
+                               geode::local_index_t to ) {
+            return ( isovalue - values[from] ) / ( values[to] - values[from] );
+        };
+        if( nb_below == 0 )
+        {
+            return 0;
+        }
+        if( nb_below == 1 )
+        {
+            return ratio( 0, 1 ) * ratio( 0, 2 ) * ratio( 0, 3 );
+        }
+        if( nb_below == 2 )
+        {
+            const auto ratio02 = ratio( 0, 2 );
+            const auto ratio03 = ratio( 0, 3 );
+            const auto ratio12 = ratio( 1, 2 );
+            const auto ratio13 = ratio( 1, 3 );
+            return ratio02 * ratio03 * ( 1 - ratio13 )
+                   + ratio02 * ratio13 * ( 1 - ratio12 ) + ratio12 * ratio13;
+        }
+        if( nb_below == 3 )
+        {
+            return 1
+                   - ( 1 - ratio( 0, 3 ) ) * ( 1 - ratio( 1, 3 ) )
+                         * ( 1 - ratio( 2, 3 ) );
+        }
+        return 1;
+    }
+
+    struct BlockData
+    {
+        BlockData( const geode::ImplicitStructuralModel& model,
+            const geode::Block3D& block_in,
+            bool use_labels )
+            : block( &block_in ),
+              mesh( &block_in.mesh< geode::TetrahedralSolid3D >() ),
+              values( mesh->nb_vertices() )
+        {
+            geode::block_implicit_values( model, block_in, values );
+            if( !use_labels )
+            {
+                return;
+            }
+            auto& manager = mesh->polyhedron_attribute_manager();
+            const auto label_ids = manager.attribute_ids_matching_name(
+                geode::ImplicitStructuralModel::
+                    STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME );
+            const auto cut_ids = manager.attribute_ids_matching_name(
+                geode::ImplicitStructuralModel::HORIZON_CUT_ATTRIBUTE_NAME );
+            if( !label_ids || !cut_ids )
+            {
+                return;
+            }
+            labels = manager.find_read_only_attribute< geode::local_index_t >(
+                label_ids.value().front() );
+            cuts = manager.find_read_only_attribute< bool >(
+                cut_ids.value().front() );
+        }
+
+        const geode::Block3D* block;
+        const geode::TetrahedralSolid3D* mesh;
+        std::vector< double > values;
+        std::shared_ptr< geode::ReadOnlyAttribute< geode::local_index_t > >
+            labels;
+        std::shared_ptr< geode::ReadOnlyAttribute< bool > > cuts;
+    };
+
+    struct TetrahedronChunk
+    {
+        geode::index_t block;
+        geode::index_t begin;
+        geode::index_t end;
+    };
+
+    /*!
+     * Adds the volume of the tetrahedron parts lying in each interval
+     * between isovalues to the given interval volumes.
+     */
+    void add_tetrahedron_volumes( const BlockData& data,
+        const geode::detail::StratigraphicUnitIntervals& intervals,
+        geode::index_t tetrahedron,
+        std::vector< double >& volumes )
+    {
+        const auto volume = std::fabs( geode::tetrahedron_volume(
+            data.mesh->tetrahedron( tetrahedron ) ) );
+        if( data.labels && !data.cuts->value( tetrahedron ) )
+        {
+            volumes[data.labels->value( tetrahedron )] += volume;
+            return;
+        }
+        std::array< double, 4 > values;
+        for( const auto v : geode::LRange{ 4 } )
+        {
+            values[v] =
+                data.values[data.mesh->polyhedron_vertex( { tetrahedron, v } )];
+        }
+        const auto [min_value, max_value] = absl::c_minmax_element( values );
+        const auto first = intervals.interval( *min_value );
+        const auto last = intervals.interval( *max_value );
+        double previous_fraction{ 0 };
+        for( const auto i : geode::Range{ first, last } )
+        {
+            const auto fraction =
+                volume_fraction_below( values, intervals.isovalues[i] );
+            volumes[i] += ( fraction - previous_fraction ) * volume;
+            previous_fraction = fraction;
+        }
+        volumes[last] += ( 1 - previous_fraction ) * volume;
+    }
+
+    void add_unit_volumes(
+        const geode::detail::StratigraphicUnitIntervals& intervals,
+        absl::Span< const double > interval_volumes,
+        absl::flat_hash_map< geode::uuid, double >& unit_volumes )
+    {
+        for( const auto i : geode::Indices{ interval_volumes } )
+        {
+            if( const auto& unit = intervals.units[i] )
+            {
+                unit_volumes[unit.value()] += interval_volumes[i];
+            }
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    ImplicitModelVolumetrics implicit_model_volumetrics(
+        const ImplicitStructuralModel& model )
+    {
+        OPENGEODE_GEOSCIENCES_TIME_SCOPE( "implicit_model_volumetrics" );
+        const auto intervals = detail::stratigraphic_unit_intervals( model );
+        const auto nb_intervals =
+            static_cast< index_t >( intervals.units.size() );
+        const auto use_labels =
+            model.has_stratigraphic_unit_labels()
+            && model.stratigraphic_unit_label_table().size() == nb_intervals;
+        std::vector< BlockData > blocks;
+        std::vector< TetrahedronChunk > chunks;
+        for( const auto& block : model.blocks() )
+        {
+            if( block.mesh().type_name()
+                != TetrahedralSolid3D::type_name_static() )
+            {
+                continue;
+            }
+            const auto block_id = static_cast< index_t >( blocks.size() );
+            const auto& data =
+                blocks.emplace_back( model, block, use_labels );
+            const auto nb_tetrahedra = data.mesh->nb_polyhedra();
+            for( index_t begin = 0; begin < nb_tetrahedra;
+                 begin += TETRAHEDRON_CHUNK_SIZE )
+            {
+                chunks.push_back( { block_id, begin,
+                    std::min( begin + TETRAHEDRON_CHUNK_SIZE,
+                        nb_tetrahedra ) } );
+            }
+        }
+        absl::FixedArray< std::vector< double > > chunk_volumes(
+            chunks.size() );
+        async::parallel_for( async::irange( std::size_t{ 0 }, chunks.size() ),
+            [&chunks, &chunk_volumes, &blocks, &intervals, nb_intervals](
+                std::size_t c ) {
+                const auto& chunk = chunks[c];
+                auto& volumes = chunk_volumes[c];
+                volumes.assign( nb_intervals, 0 );
+                for( const auto tetrahedron :
+                    Range{ chunk.begin, chunk.end } )
+                {
+                    add_tetrahedron_volumes( blocks[chunk.block], intervals,
+                        tetrahedron, volumes );
+                }
+            } );
+
+        ImplicitModelVolumetrics result;
+        absl::FixedArray< std::vector< double > > block_volumes(
+            blocks.size(), std::vector< double >( nb_intervals, 0 ) );
+        for( const auto c : Indices{ chunks } )
+        {
+            auto& volumes = block_volumes[chunks[c].block];
+            for( const auto i : Range{ nb_intervals } )
+            {
+                volumes[i] += chunk_volumes[c][i];
+            }
+        }
+        for( const auto b : Indices{ blocks } )
+        {
+            const auto& block_id = blocks[b].block->id();
+            double volume{ 0 };
+            for( const auto interval_volume : block_volumes[b] )
+            {
+                volume += interval_volume;
+            }
+            result.block_volumes.emplace( block_id, volume );
+            add_unit_volumes( intervals, block_volumes[b],
+                result.stratigraphic_unit_volumes );
+            add_unit_volumes( intervals, block_volumes[b],
+                result.block_stratigraphic_unit_volumes[block_id] );
+        }
+        for( const auto& fault_block : model.fault_blocks() )
+        {
+            auto& volume = result.fault_block_volumes[fault_block.id()];
+            auto& unit_volumes =
+                result.fault_block_stratigraphic_unit_volumes[fault_block.id()];
+            for( const auto& block : model.fault_block_items( fault_block ) )
+            {
+                const auto block_volume =
+                    result.block_volumes.find( block.id() );
+                if( block_volume == result.block_volumes.end() )
+                {
+                    continue;
+                }
+                volume += block_volume->second;
+                for( const auto& [unit, unit_volume] :
+                    result.block_stratigraphic_unit_volumes.at( block.id() ) )
+                {
+                    unit_volumes[unit] += unit_volume;
+                }
+            }
+        }
+        return result;
+    }
+
+    absl::flat_hash_map< uuid, StratigraphicUnitThicknessStatistics >
+        stratigraphic_unit_thickness_statistics(
+            const ImplicitStructuralModel& model,
+            absl::Span< const Point2D > locations )
+    {
+        OPENGEODE_GEOSCIENCES_TIME_SCOPE(
+            "stratigraphic_unit_thickness_statistics" );
+        const auto columns = model.stratigraphic_columns( locations );
+        absl::flat_hash_map< uuid, StratigraphicUnitThicknessStatistics >
+            result;
+        absl::flat_hash_map< uuid, double > squared_deviations;
+        std::vector< std::pair< uuid, double > > column_thicknesses;
+        for( const auto c : Range{ columns.nb_columns() } )
+        {
+            column_thicknesses.clear();
+            for( const auto& interval : columns.column( c ) )
+            {
+                const auto it = absl::c_find_if( column_thicknesses,
+                    [&interval]( const std::pair< uuid, double >& thickness ) {
+                        return thickness.first == interval.stratigraphic_unit;
+                    } );
+                if( it == column_thicknesses.end() )
+                {
+                    column_thicknesses.emplace_back(
+                        interval.stratigraphic_unit, interval.thickness() );
+                }
+                else
+                {
+                    it->second += interval.thickness();
+                }
+            }
+            for( const auto& [unit, thickness] : column_thicknesses )
+            {
+                auto& statistics = result[unit];
+                statistics.nb_columns++;
+                statistics.min = std::min( statistics.min, thickness );
+                statistics.max = std::max( statistics.max, thickness );
+                const auto delta = thickness - statistics.mean;
+                statistics.mean += delta / statistics.nb_columns;
+                squared_deviations[unit] +=
+                    delta * ( thickness - statistics.mean );
+            }
+        }
+        for( auto& [unit, statistics] : result )
+        {
+            statistics.standard_deviation = std::sqrt(
+                squared_deviations.at( unit ) / statistics.nb_columns );
+        }
+        return result;
+    }
+} // namespace geode
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_fields.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/fixed_array.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/strings/str_cat.h>
+
+#include <async++.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/logger.hpp>
+#include <geode/basic/pimpl_impl.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+
+#include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/mapped_file.hpp>
+
+namespace
+{
+    constexpr auto FIELDS_FILENAME = "/implicit_model_fields.bin";
+    constexpr std::array< char, 8 > FIELDS_MAGIC{ 'O', 'G', 'F', 'I', 'E',
+        'L', 'D', 'S' };
+    constexpr std::uint32_t FIELDS_VERSION{ 1 };
+    constexpr std::uint32_t FIELDS_BYTE_ORDER{ 0x01020304 };
+    constexpr std::uint64_t FIELDS_ALIGNMENT{ 64 };
+
+    struct FieldsHeader
+    {
+        std::array< char, 8 > magic;
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        std::uint64_t nb_blocks;
+    };
+    static_assert( sizeof( FieldsHeader ) == 24 );
+
+    struct BlockFieldsEntry
+    {
+        std::array< char, 40 > block_id;
+        std::uint64_t fingerprint;
+        std::uint64_t nb_vertices;
+        std::uint64_t implicit_values_offset;
+        std::uint64_t stratigraphic_locations_offset;
+    };
+    static_assert( sizeof( BlockFieldsEntry ) == 72 );
+
+    struct SavedBlockFields
+    {
+        BlockFieldsEntry entry{};
+        std::vector< double > implicit_values;
+        std::vector< double > stratigraphic_locations;
+    };
+
+    std::uint64_t aligned_offset( std::uint64_t offset )
+    {
+        return ( offset + FIELDS_ALIGNMENT - 1 ) / FIELDS_ALIGNMENT
+               * FIELDS_ALIGNMENT;
+    }
+
+    std::vector< double > block_stratigraphic_locations(
+        const geode::Block3D& block )
+    {
+        const auto& mesh = block.mesh();
+        const auto& manager = mesh.vertex_attribute_manager();
+        const auto ids = manager.attribute_ids_matching_name(
+            geode::StratigraphicModel::STRATIGRAPHIC_LOCATION_ATTRIBUTE_NAME );
+        if( !ids || ids->empty() )
+        {
+            return {};
+        }
+        const auto attribute =
+            manager.find_read_only_attribute< geode::Point2D >( ids->front() );
+        if( !attribute )
+        {
+            return {};
+        }
+        std::vector< double > locations(
+            2 * std::size_t{ mesh.nb_vertices() } );
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            const auto& location = attribute->value( v );
+            locations[2 * v] = location.value( 0 );
+            locations[2 * v + 1] = location.value( 1 );
+        }
+        return locations;
+    }
+
+    SavedBlockFields saved_block_fields(
+        const geode::ImplicitStructuralModel& model,
+        const geode::Block3D& block )
+    {
+        const auto& mesh = block.mesh< geode::TetrahedralSolid3D >();
+        SavedBlockFields fields;
+        absl::c_copy( block.id().string(), fields.entry.block_id.begin() );
+        fields.entry.fingerprint =
+            geode::detail::mesh_vertices_fingerprint( mesh );
+        fields.entry.nb_vertices = mesh.nb_vertices();
+        fields.implicit_values.resize( mesh.nb_vertices() );
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            fields.implicit_values[v] = model.stored_implicit_value( block, v );
+        }
+        fields.stratigraphic_locations = block_stratigraphic_locations( block );
+        return fields;
+    }
+
+    void set_offsets( absl::Span< SavedBlockFields > fields )
+    {
+        auto offset = aligned_offset( sizeof( FieldsHeader )
+                                      + fields.size()
+                                            * sizeof( BlockFieldsEntry ) );
+        const auto add_array =
+            [&offset]( const std::vector< double >& values ) {
+                const auto array_offset = offset;
+                offset = aligned_offset(
+                    offset + values.size() * sizeof( double ) );
+                return array_offset;
+            };
+        for( auto& block : fields )
+        {
+            block.entry.implicit_values_offset =
+                add_array( block.implicit_values );
+            if( !block.stratigraphic_locations.empty() )
+            {
+                block.entry.stratigraphic_locations_offset =
+                    add_array( block.stratigraphic_locations );
+            }
+        }
+    }
+
+    class FieldsWriter
+    {
+    public:
+        explicit FieldsWriter( std::string_view filename )
+            : file_{ std::string{ filename }, std::ofstream::binary }
+        {
+        }
+
+        template < typename Type >
+        void write_value( const Type& value )
+        {
+            write_bytes( reinterpret_cast< const char* >( &value ),
+                sizeof( Type ) );
+        }
+
+        void write_array( const std::vector< double >& values,
+            std::uint64_t offset )
+        {
+            static constexpr std::array< char, FIELDS_ALIGNMENT > padding{};
+            write_bytes( padding.data(), offset - written_ );
+            write_bytes( reinterpret_cast< const char* >( values.data() ),
+                values.size() * sizeof( double ) );
+        }
+
+        bool good() const
+        {
+            return file_.good();
+        }
+
+    private:
+        void write_bytes( const char* bytes, std::uint64_t size )
+        {
+            file_.write( bytes, static_cast< std::streamsize >( size ) );
+            written_ += size;
+        }
+
+    private:
+        std::ofstream file_;
+        std::uint64_t written_{ 0 };
+    };
+
+    template < typename Type >
+    std::optional< Type > read_value(
+        absl::Span< const char > data, std::uint64_t offset )
+    {
+        if( offset + sizeof( Type ) > data.size() )
+        {
+            return std::nullopt;
+        }
+        Type value;
+        std::memcpy( &value, data.data() + offset, sizeof( Type ) );
+        return value;
+    }
+
+    absl::Span< const double > mapped_array( absl::Span< const char > data,
+        std::uint64_t offset,
+        std::uint64_t nb_values )
+    {
+        if( offset == 0 || offset % FIELDS_ALIGNMENT != 0
+            || offset > data.size()
+            || nb_values > ( data.size() - offset ) / sizeof( double ) )
+        {
+            return {};
+        }
+        return { reinterpret_cast< const double* >( data.data() + offset ),
+            static_cast< std::size_t >( nb_values ) };
+    }
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        class MappedImplicitModelFields::Impl
+        {
+        public:
+            explicit Impl( std::string_view filename ) : file_{ filename }
+            {
+                const auto data = file_.data();
+                const auto header = read_value< FieldsHeader >( data, 0 );
+                OpenGeodeGeosciencesImplicitException::check_exception(
+                    header && header->magic == FIELDS_MAGIC
+                        && header->version == FIELDS_VERSION
+                        && header->nb_blocks
+                               <= ( data.size() - sizeof( FieldsHeader ) )
+                                      / sizeof( BlockFieldsEntry ),
+                    nullptr, OpenGeodeException::TYPE::data,
+                    "[MappedImplicitModelFields] Invalid fields file: ",
+                    filename );
+                OpenGeodeGeosciencesImplicitException::check_exception(
+                    header->byte_order == FIELDS_BYTE_ORDER, nullptr,
+                    OpenGeodeException::TYPE::data,
+                    "[MappedImplicitModelFields] Fields were saved with "
+                    "another byte order: ",
+                    filename );
+                entries_.reserve( header->nb_blocks );
+                for( const auto b :
+                    Range{ static_cast< index_t >( header->nb_blocks ) } )
+                {
+                    const auto entry = read_value< BlockFieldsEntry >(
+                        data, sizeof( FieldsHeader )
+                                  + b * sizeof( BlockFieldsEntry ) );
+                    const uuid block_id{ std::string{
+                        entry->block_id.data(), uuid{}.string().size() } };
+                    entries_.emplace( block_id, entry.value() );
+                }
+            }
+
+            index_t nb_blocks() const
+            {
+                return static_cast< index_t >( entries_.size() );
+            }
+
+            std::optional< BlockFields > block_fields(
+                const Block3D& block ) const
+            {
+                const auto entry = entries_.find( block.id() );
+                if( entry == entries_.end()
+                    || block.mesh().type_name()
+                           != TetrahedralSolid3D::type_name_static()
+                    || block.mesh().nb_vertices()
+                           != entry->second.nb_vertices )
+                {
+                    return std::nullopt;
+                }
+                const auto data = file_.data();
+                BlockFields fields;
+                fields.implicit_values =
+                    mapped_array( data, entry->second.implicit_values_offset,
+                        entry->second.nb_vertices );
+                fields.stratigraphic_locations = mapped_array( data,
+                    entry->second.stratigraphic_locations_offset,
+                    2 * entry->second.nb_vertices );
+                if( fields.implicit_values.size()
+                        != entry->second.nb_vertices
+                    || mesh_vertices_fingerprint(
+                           block.mesh< TetrahedralSolid3D >() )
+                           != entry->second.fingerprint )
+                {
+                    return std::nullopt;
+                }
+                return fields;
+            }
+
+        private:
+            MappedFile file_;
+            absl::flat_hash_map< uuid, BlockFieldsEntry > entries_;
+        };
+
+        MappedImplicitModelFields::MappedImplicitModelFields(
+            std::string_view filename )
+            : impl_{ filename }
+        {
+        }
+
+        MappedImplicitModelFields::MappedImplicitModelFields(
+            MappedImplicitModelFields&& ) noexcept = default;
+
+        MappedImplicitModelFields::~MappedImplicitModelFields() = default;
+
+        index_t MappedImplicitModelFields::nb_blocks() const
+        {
+            return impl_->nb_blocks();
+        }
+
+        auto MappedImplicitModelFields::block_fields(
+            const Block3D& block ) const -> std::optional< BlockFields >
+        {
+            return impl_->block_fields( block );
+        }
+
+        void save_implicit_model_fields(
+            const ImplicitStructuralModel& model, std::string_view directory )
+        {
+            std::vector< const Block3D* > blocks;
+            for( const auto& block : model.blocks() )
+            {
+                if( block.mesh().type_name()
+                    == TetrahedralSolid3D::type_name_static() )
+                {
+                    blocks.push_back( &block );
+                }
+            }
+            absl::FixedArray< SavedBlockFields > fields( blocks.size() );
+            async::parallel_for(
+                async::irange( std::size_t{ 0 }, blocks.size() ),
+                [&fields, &blocks, &model]( std::size_t b ) {
+                    fields[b] = saved_block_fields( model, *blocks[b] );
+                } );
+            set_offsets( absl::MakeSpan( fields ) );
+            const auto filename = absl::StrCat( directory, FIELDS_FILENAME );
+            FieldsWriter writer{ filename };
+            FieldsHeader header{};
+            header.magic = FIELDS_MAGIC;
+            header.version = FIELDS_VERSION;
+            header.byte_order = FIELDS_BYTE_ORDER;
+            header.nb_blocks = fields.size();
+            writer.write_value( header );
+            for( const auto& block : fields )
+            {
+                writer.write_value( block.entry );
+            }
+            for( const auto& block : fields )
+            {
+                writer.write_array( block.implicit_values,
+                    block.entry.implicit_values_offset );
+                if( !block.stratigraphic_locations.empty() )
+                {
+                    writer.write_array( block.stratigraphic_locations,
+                        block.entry.stratigraphic_locations_offset );
+                }
+            }
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                writer.good(), nullptr, OpenGeodeException::TYPE::internal,
+                "[save_implicit_model_fields] Error while writing file: ",
+                filename );
+        }
+
+        bool has_implicit_model_fields( std::string_view directory )
+        {
+            return std::filesystem::exists(
+                absl::StrCat( directory, FIELDS_FILENAME ) );
+        }
+
+        index_t map_implicit_model_fields(
+            ImplicitStructuralModel& model, std::string_view directory )
+        {
+            if( !has_implicit_model_fields( directory ) )
+            {
+                return 0;
+            }
+            const auto fields =
+                std::make_shared< const MappedImplicitModelFields >(
+                    absl::StrCat( directory, FIELDS_FILENAME ) );
+            ImplicitStructuralModelBuilder builder{ model };
+            index_t nb_mapped{ 0 };
+            for( const auto& block : model.blocks() )
+            {
+                const auto block_fields = fields->block_fields( block );
+                if( !block_fields )
+                {
+                    continue;
+                }
+                builder.map_implicit_values(
+                    block, block_fields->implicit_values, fields );
+                nb_mapped++;
+            }
+            if( nb_mapped != fields->nb_blocks() )
+            {
+                Logger::warn( "[map_implicit_model_fields] ",
+                    fields->nb_blocks() - nb_mapped,
+                    " saved Block fields do not match their Block mesh, and "
+                    "are not mapped." );
+            }
+            return nb_mapped;
+        }
+    } // namespace detail
+} // namespace geode
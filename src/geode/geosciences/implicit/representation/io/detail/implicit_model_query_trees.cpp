@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_query_trees.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include <async++.h>
+
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+#include <geode/mesh/core/triangulated_surface.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/surface.hpp>
+
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/builder/implicit_cross_section_builder.hpp>
+#include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/query_tree_boxes.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_cross_section.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
+
+namespace
+{
+    constexpr auto MODEL_QUERY_TREES_FILENAME =
+        "/implicit_model_query_trees.bin";
+    constexpr auto SECTION_QUERY_TREES_FILENAME =
+        "/implicit_section_query_trees.bin";
+    constexpr std::uint32_t QUERY_TREES_VERSION{ 2 };
+
+    /*!
+     * Boxes of the elements of one component, in the order given to the
+     * AABBTree constructor.
+     */
+    template < geode::index_t dimension >
+    struct ComponentQueryTree
+    {
+        std::string component_id;
+        geode::detail::QueryTreeBoxes< dimension > boxes;
+    };
+
+    template < geode::index_t dimension >
+    using ComponentQueryTrees = std::vector< ComponentQueryTree< dimension > >;
+
+    template < typename Type >
+    void write_value( std::ofstream& file, const Type& value )
+    {
+        file.write( reinterpret_cast< const char* >( &value ), sizeof( Type ) );
+    }
+
+    template < typename Type >
+    bool read_value( std::ifstream& file, Type& value )
+    {
+        return static_cast< bool >(
+            file.read( reinterpret_cast< char* >( &value ), sizeof( Type ) ) );
+    }
+
+    /*!
+     * Computes the query tree boxes of the given components in parallel.
+     */
+    template < geode::index_t dimension,
+        typename Component,
+        typename ComputeBoxes >
+    ComponentQueryTrees< dimension > component_query_trees(
+        absl::Span< const Component* const > components,
+        const ComputeBoxes& compute_boxes )
+    {
+        ComponentQueryTrees< dimension > trees( components.size() );
+        async::parallel_for(
+            async::irange( std::size_t{ 0 }, components.size() ),
+            [&trees, &components, &compute_boxes]( std::size_t c ) {
+                trees[c].component_id = components[c]->id().string();
+                trees[c].boxes = compute_boxes( *components[c] );
+            } );
+        return trees;
+    }
+
+    geode::index_t nb_elements( const geode::TetrahedralSolid3D& mesh )
+    {
+        return mesh.nb_polyhedra();
+    }
+
+    geode::index_t nb_elements( const geode::TriangulatedSurface2D& mesh )
+    {
+        return mesh.nb_polygons();
+    }
+
+    auto element_vertices(
+        const geode::TetrahedralSolid3D& mesh, geode::index_t tetrahedron )
+    {
+        return mesh.polyhedron_vertices( tetrahedron );
+    }
+
+    auto element_vertices(
+        const geode::TriangulatedSurface2D& mesh, geode::index_t triangle )
+    {
+        return mesh.polygon_vertices( triangle );
+    }
+
+    /*!
+     * Boxes of the mesh elements computed from the given vertex positions,
+     * which may differ from the mesh points.
+     */
+    template < geode::index_t dimension, typename Mesh, typename VertexPoint >
+    geode::detail::QueryTreeBoxes< dimension > mesh_query_tree_boxes(
+        const Mesh& mesh,
+        std::uint64_t fingerprint,
+        const VertexPoint& vertex_point )
+    {
+        geode::detail::QueryTreeBoxes< dimension > boxes;
+        boxes.fingerprint = fingerprint;
+        boxes.boxes.resize( nb_elements( mesh ) );
+        for( const auto e : geode::Range{ nb_elements( mesh ) } )
+        {
+            for( const auto v : element_vertices( mesh, e ) )
+            {
+                boxes.boxes[e].add_point( vertex_point( v ) );
+            }
+        }
+        return boxes;
+    }
+
+    template < geode::index_t dimension, typename Mesh >
+    geode::detail::QueryTreeBoxes< dimension > mesh_query_tree_boxes(
+        const Mesh& mesh )
+    {
+        return mesh_query_tree_boxes< dimension >( mesh,
+            geode::detail::mesh_vertices_fingerprint( mesh ),
+            [&mesh]( geode::index_t vertex ) {
+                return mesh.point( vertex );
+            } );
+    }
+
+    geode::detail::QueryTreeBoxes3D stratigraphic_query_tree_boxes(
+        const geode::StratigraphicModel& model, const geode::Block3D& block )
+    {
+        return mesh_query_tree_boxes< 3 >(
+            block.mesh< geode::TetrahedralSolid3D >(),
+            geode::detail::block_stratigraphic_coordinates_fingerprint(
+                model, block ),
+            [&model, &block]( geode::index_t vertex ) {
+                return model.stratigraphic_coordinates( block, vertex )
+                    .stratigraphic_coordinates();
+            } );
+    }
+
+    template < geode::index_t dimension >
+    void write_query_trees( std::ofstream& file,
+        const ComponentQueryTrees< dimension >& trees )
+    {
+        write_value( file, static_cast< geode::index_t >( trees.size() ) );
+        for( const auto& tree : trees )
+        {
+            file.write( tree.component_id.data(),
+                static_cast< std::streamsize >( tree.component_id.size() ) );
+            write_value( file, tree.boxes.fingerprint );
+            const auto& boxes = tree.boxes.boxes;
+            write_value( file, static_cast< geode::index_t >( boxes.size() ) );
+            for( const auto& box : boxes )
+            {
+                write_value( file, box.min() );
+                write_value( file, box.max() );
+            }
+        }
+    }
+
+    template < geode::index_t dimension >
+    std::optional< ComponentQueryTree< dimension > > read_query_tree(
+        std::ifstream& file )
+    {
+        ComponentQueryTree< dimension > tree;
+        tree.component_id.resize( geode::uuid{}.string().size() );
+        if( !file.read( tree.component_id.data(),
+                static_cast< std::streamsize >( tree.component_id.size() ) ) )
+        {
+            return std::nullopt;
+        }
+        geode::index_t nb_boxes;
+        if( !read_value( file, tree.boxes.fingerprint )
+            || !read_value( file, nb_boxes ) )
+        {
+            return std::nullopt;
+        }
+        std::vector< geode::Point< dimension > > corners( 2 * nb_boxes );
+        if( !file.read( reinterpret_cast< char* >( corners.data() ),
+                static_cast< std::streamsize >(
+                    corners.size() * sizeof( geode::Point< dimension > ) ) ) )
+        {
+            return std::nullopt;
+        }
+        tree.boxes.boxes.resize( nb_boxes );
+        for( const auto b : geode::Range{ nb_boxes } )
+        {
+            tree.boxes.boxes[b].add_point( corners[2 * b] );
+            tree.boxes.boxes[b].add_point( corners[2 * b + 1] );
+        }
+        return tree;
+    }
+
+    template < geode::index_t dimension >
+    std::optional< ComponentQueryTrees< dimension > > read_query_trees(
+        std::ifstream& file )
+    {
+        geode::index_t nb_trees;
+        if( !read_value( file, nb_trees ) )
+        {
+            return std::nullopt;
+        }
+        ComponentQueryTrees< dimension > trees;
+        trees.reserve( nb_trees );
+        while( trees.size() < nb_trees )
+        {
+            auto tree = read_query_tree< dimension >( file );
+            if( !tree )
+            {
+                return std::nullopt;
+            }
+            trees.emplace_back( std::move( tree.value() ) );
+        }
+        return trees;
+    }
+
+    std::ofstream open_query_trees_file( const std::string& filename )
+    {
+        std::ofstream file{ filename, std::ofstream::binary };
+        write_value( file, QUERY_TREES_VERSION );
+        return file;
+    }
+
+    std::optional< std::ifstream > open_saved_query_trees_file(
+        const std::string& filename )
+    {
+        std::ifstream file{ filename, std::ifstream::binary };
+        std::uint32_t version;
+        if( !file.good() || !read_value( file, version )
+            || version != QUERY_TREES_VERSION )
+        {
+            return std::nullopt;
+        }
+        return file;
+    }
+
+    void check_query_trees_file(
+        const std::ofstream& file, const std::string& filename )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
+            file.good(), nullptr, geode::OpenGeodeException::TYPE::internal,
+            "[save_query_trees] Error while writing file: ", filename );
+    }
+
+    template < typename Mesh, typename Component, typename Components >
+    std::vector< const Component* > meshed_components(
+        const Components& components )
+    {
+        std::vector< const Component* > result;
+        for( const auto& component : components )
+        {
+            if( component.mesh().type_name() == Mesh::type_name_static() )
+            {
+                result.push_back( &component );
+            }
+        }
+        return result;
+    }
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        void save_implicit_model_query_trees(
+            const ImplicitStructuralModel& model, std::string_view directory )
+        {
+            const auto blocks =
+                meshed_components< TetrahedralSolid3D, Block3D >(
+                    model.blocks() );
+            ComponentQueryTrees< 3 > trees;
+            ComponentQueryTrees< 3 > stratigraphic_trees;
+            const auto* stratigraphic_model =
+                dynamic_cast< const StratigraphicModel* >( &model );
+            async::parallel_invoke(
+                [&trees, &blocks] {
+                    trees = component_query_trees< 3 >(
+                        absl::MakeConstSpan( blocks ),
+                        []( const Block3D& block ) {
+                            return mesh_query_tree_boxes< 3 >(
+                                block.mesh< TetrahedralSolid3D >() );
+                        } );
+                },
+                [&stratigraphic_trees, &blocks, stratigraphic_model] {
+                    if( !stratigraphic_model )
+                    {
+                        return;
+                    }
+                    stratigraphic_trees = component_query_trees< 3 >(
+                        absl::MakeConstSpan( blocks ),
+                        [stratigraphic_model]( const Block3D& block ) {
+                            return stratigraphic_query_tree_boxes(
+                                *stratigraphic_model, block );
+                        } );
+                } );
+            const auto filename =
+                absl::StrCat( directory, MODEL_QUERY_TREES_FILENAME );
+            auto file = open_query_trees_file( filename );
+            write_query_trees( file, trees );
+            write_query_trees( file, stratigraphic_trees );
+            check_query_trees_file( file, filename );
+        }
+
+        index_t load_implicit_model_query_trees(
+            ImplicitStructuralModel& model, std::string_view directory )
+        {
+            auto file = open_saved_query_trees_file(
+                absl::StrCat( directory, MODEL_QUERY_TREES_FILENAME ) );
+            if( !file )
+            {
+                return 0;
+            }
+            auto trees = read_query_trees< 3 >( file.value() );
+            auto stratigraphic_trees = read_query_trees< 3 >( file.value() );
+            if( !trees || !stratigraphic_trees )
+            {
+                return 0;
+            }
+            ImplicitStructuralModelBuilder builder{ model };
+            index_t nb_loaded{ 0 };
+            for( auto& tree : trees.value() )
+            {
+                const uuid block_id{ tree.component_id };
+                if( model.has_block( block_id ) )
+                {
+                    builder.set_implicit_query_tree_boxes(
+                        model.block( block_id ), std::move( tree.boxes ) );
+                    nb_loaded++;
+                }
+            }
+            for( auto& tree : stratigraphic_trees.value() )
+            {
+                const uuid block_id{ tree.component_id };
+                if( model.has_block( block_id ) )
+                {
+                    builder.set_stratigraphic_query_tree_boxes(
+                        model.block( block_id ), std::move( tree.boxes ) );
+                    nb_loaded++;
+                }
+            }
+            return nb_loaded;
+        }
+
+        void save_implicit_section_query_trees(
+            const ImplicitCrossSection& section, std::string_view directory )
+        {
+            const auto surfaces =
+                meshed_components< TriangulatedSurface2D, Surface2D >(
+                    section.surfaces() );
+            const auto trees = component_query_trees< 2 >(
+                absl::MakeConstSpan( surfaces ),
+                []( const Surface2D& surface ) {
+                    return mesh_query_tree_boxes< 2 >(
+                        surface.mesh< TriangulatedSurface2D >() );
+                } );
+            const auto filename =
+                absl::StrCat( directory, SECTION_QUERY_TREES_FILENAME );
+            auto file = open_query_trees_file( filename );
+            write_query_trees( file, trees );
+            check_query_trees_file( file, filename );
+        }
+
+        index_t load_implicit_section_query_trees(
+            ImplicitCrossSection& section, std::string_view directory )
+        {
+            auto file = open_saved_query_trees_file(
+                absl::StrCat( directory, SECTION_QUERY_TREES_FILENAME ) );
+            if( !file )
+            {
+                return 0;
+            }
+            auto trees = read_query_trees< 2 >( file.value() );
+            if( !trees )
+            {
+                return 0;
+            }
+            ImplicitCrossSectionBuilder builder{ section };
+            index_t nb_loaded{ 0 };
+            for( auto& tree : trees.value() )
+            {
+                const uuid surface_id{ tree.component_id };
+                if( section.has_surface( surface_id ) )
+                {
+                    builder.set_implicit_query_tree_boxes(
+                        section.surface( surface_id ),
+                        std::move( tree.boxes ) );
+                    nb_loaded++;
+                }
+            }
+            return nb_loaded;
+        }
+    } // namespace detail
+} // namespace geode
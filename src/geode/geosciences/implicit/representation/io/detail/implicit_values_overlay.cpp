@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/detail/implicit_values_overlay.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <absl/strings/str_cat.h>
+
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/builder/stratigraphic_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+
+namespace
+{
+    constexpr auto IMPLICIT_VALUES_DIRECTORY = "/implicit_values";
+    constexpr auto STRATIGRAPHIC_LOCATIONS_DIRECTORY =
+        "/stratigraphic_locations";
+} // namespace
+
+namespace geode
+{
+    namespace detail
+    {
+        void save_block_implicit_values( const ImplicitStructuralModel& model,
+            const Block3D& block,
+            std::string_view directory )
+        {
+            const auto values_directory =
+                absl::StrCat( directory, IMPLICIT_VALUES_DIRECTORY );
+            std::filesystem::create_directories( values_directory );
+            const auto filename =
+                absl::StrCat( values_directory, "/", block.id().string() );
+            const auto nb_vertices = block.mesh().nb_vertices();
+            std::vector< double > values( nb_vertices );
+            for( const auto v : Range{ nb_vertices } )
+            {
+                values[v] = model.stored_implicit_value( block, v );
+            }
+            std::ofstream file{ filename, std::ofstream::binary };
+            file.write( reinterpret_cast< const char* >( &nb_vertices ),
+                sizeof( nb_vertices ) );
+            file.write( reinterpret_cast< const char* >( values.data() ),
+                static_cast< std::streamsize >(
+                    values.size() * sizeof( double ) ) );
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                file.good(), nullptr, OpenGeodeException::TYPE::internal,
+                "[save_block_implicit_values] Error while writing file: ",
+                filename );
+        }
+
+        index_t load_block_implicit_values(
+            ImplicitStructuralModel& model, std::string_view directory )
+        {
+            const std::filesystem::path values_directory{ absl::StrCat(
+                directory, IMPLICIT_VALUES_DIRECTORY ) };
+            if( !std::filesystem::is_directory( values_directory ) )
+            {
+                return 0;
+            }
+            ImplicitStructuralModelBuilder builder{ model };
+            index_t nb_blocks{ 0 };
+            for( const auto& entry :
+                std::filesystem::directory_iterator( values_directory ) )
+            {
+                const uuid block_id{ entry.path().filename().string() };
+                if( !model.has_block( block_id ) )
+                {
+                    continue;
+                }
+                std::ifstream file{ entry.path(), std::ifstream::binary };
+                index_t nb_values{ 0 };
+                file.read( reinterpret_cast< char* >( &nb_values ),
+                    sizeof( nb_values ) );
+                std::vector< double > values( nb_values );
+                file.read( reinterpret_cast< char* >( values.data() ),
+                    static_cast< std::streamsize >(
+                        values.size() * sizeof( double ) ) );
+                OpenGeodeGeosciencesImplicitException::check_exception(
+                    !file.fail(), nullptr, OpenGeodeException::TYPE::data,
+                    "[load_block_implicit_values] Error while reading file: ",
+                    entry.path().string() );
+                builder.set_block_stored_implicit_values(
+                    model.block( block_id ), values );
+                nb_blocks++;
+            }
+            return nb_blocks;
+        }
+
+        void save_block_stratigraphic_locations(
+            const StratigraphicModel& model,
+            const Block3D& block,
+            std::string_view directory )
+        {
+            const auto locations_directory =
+                absl::StrCat( directory, STRATIGRAPHIC_LOCATIONS_DIRECTORY );
+            std::filesystem::create_directories( locations_directory );
+            const auto filename =
+                absl::StrCat( locations_directory, "/", block.id().string() );
+            const auto nb_vertices = block.mesh().nb_vertices();
+            std::vector< double > locations( 2 * nb_vertices );
+            for( const auto v : Range{ nb_vertices } )
+            {
+                const auto location =
+                    model.stratigraphic_coordinates( block, v )
+                        .stratigraphic_location();
+                locations[2 * v] = location.value( 0 );
+                locations[2 * v + 1] = location.value( 1 );
+            }
+            std::ofstream file{ filename, std::ofstream::binary };
+            file.write( reinterpret_cast< const char* >( &nb_vertices ),
+                sizeof( nb_vertices ) );
+            file.write( reinterpret_cast< const char* >( locations.data() ),
+                static_cast< std::streamsize >(
+                    locations.size() * sizeof( double ) ) );
+            OpenGeodeGeosciencesImplicitException::check_exception(
+                file.good(), nullptr, OpenGeodeException::TYPE::internal,
+                "[save_block_stratigraphic_locations] Error while writing "
+                "file: ",
+                filename );
+        }
+
+        index_t load_block_stratigraphic_locations(
+            StratigraphicModel& model, std::string_view directory )
+        {
+            const std::filesystem::path locations_directory{ absl::StrCat(
+                directory, STRATIGRAPHIC_LOCATIONS_DIRECTORY ) };
+            if( !std::filesystem::is_directory( locations_directory ) )
+            {
+                return 0;
+            }
+            StratigraphicModelBuilder builder{ model };
+            index_t nb_blocks{ 0 };
+            for( const auto& entry :
+                std::filesystem::directory_iterator( locations_directory ) )
+            {
+                const uuid block_id{ entry.path().filename().string() };
+                if( !model.has_block( block_id ) )
+                {
+                    continue;
+                }
+                const auto& block = model.block( block_id );
+                std::ifstream file{ entry.path(), std::ifstream::binary };
+                index_t nb_locations{ 0 };
+                file.read( reinterpret_cast< char* >( &nb_locations ),
+                    sizeof( nb_locations ) );
+                std::vector< double > locations( 2 * nb_locations );
+                file.read( reinterpret_cast< char* >( locations.data() ),
+                    static_cast< std::streamsize >(
+                        locations.size() * sizeof( double ) ) );
+                OpenGeodeGeosciencesImplicitException::check_exception(
+                    !file.fail()
+                        && nb_locations == block.mesh().nb_vertices(),
+                    nullptr, OpenGeodeException::TYPE::data,
+                    "[load_block_stratigraphic_locations] Error while reading "
+                    "file: ",
+                    entry.path().string() );
+                for( const auto v : Range{ nb_locations } )
+                {
+                    builder.set_stratigraphic_location( block, v,
+                        Point2D{ { locations[2 * v], locations[2 * v + 1] } } );
+                }
+                nb_blocks++;
+            }
+            return nb_blocks;
+        }
+    } // namespace detail
+} // namespace geode
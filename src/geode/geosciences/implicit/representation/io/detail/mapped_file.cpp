@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/detail/mapped_file.hpp>
+
+#include <string>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include <geode/basic/pimpl_impl.hpp>
+
+namespace geode
+{
+    namespace detail
+    {
+        class MappedFile::Impl
+        {
+        public:
+            explicit Impl( std::string_view filename )
+            {
+                const std::string path{ filename };
+#ifdef _WIN32
+                const auto file = ::CreateFileA( path.c_str(), GENERIC_READ,
+                    FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL, nullptr );
+                check_mapping( file != INVALID_HANDLE_VALUE, filename );
+                LARGE_INTEGER file_size;
+                const auto has_size = ::GetFileSizeEx( file, &file_size );
+                if( !has_size || file_size.QuadPart == 0 )
+                {
+                    ::CloseHandle( file );
+                    check_mapping( has_size, filename );
+                    return;
+                }
+                const auto mapping = ::CreateFileMappingA(
+                    file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+                ::CloseHandle( file );
+                check_mapping( mapping != nullptr, filename );
+                const auto* address =
+                    ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+                ::CloseHandle( mapping );
+                check_mapping( address != nullptr, filename );
+                data_ = static_cast< const char* >( address );
+                size_ = static_cast< std::size_t >( file_size.QuadPart );
+#else
+                const auto descriptor = ::open( path.c_str(), O_RDONLY );
+                check_mapping( descriptor != -1, filename );
+                struct stat status;
+                const auto has_size = ::fstat( descriptor, &status ) == 0;
+                if( !has_size || status.st_size == 0 )
+                {
+                    ::close( descriptor );
+                    check_mapping( has_size, filename );
+                    return;
+                }
+                const auto size = static_cast< std::size_t >( status.st_size );
+                auto* address = ::mmap(
+                    nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0 );
+                ::close( descriptor );
+                check_mapping( address != MAP_FAILED, filename );
+                data_ = static_cast< const char* >( address );
+                size_ = size;
+#endif
+            }
+
+            ~Impl()
+            {
+                if( data_ == nullptr )
+                {
+                    return;
+                }
+#ifdef _WIN32
+                ::UnmapViewOfFile( data_ );
+#else
+                ::munmap( const_cast< char* >( data_ ), size_ );
+#endif
+            }
+
+            absl::Span< const char > data() const
+            {
+                return { data_, size_ };
+            }
+
+        private:
+            static void check_mapping( bool success, std::string_view filename )
+            {
+                OpenGeodeGeosciencesImplicitException::check_exception( success,
+                    nullptr, OpenGeodeException::TYPE::data,
+                    "[MappedFile] Cannot map file: ", filename );
+            }
+
+        private:
+            const char* data_{ nullptr };
+            std::size_t size_{ 0 };
+        };
+
+        MappedFile::MappedFile( std::string_view filename ) : impl_{ filename }
+        {
+        }
+
+        MappedFile::MappedFile( MappedFile&& ) noexcept = default;
+
+        MappedFile::~MappedFile() = default;
+
+        absl::Span< const char > MappedFile::data() const
+        {
+            return impl_->data();
+        }
+    } // namespace detail
+} // namespace geode
@@ -28,6 +28,7 @@
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
 
@@ -40,15 +41,27 @@ namespace geode
         HorizonsStackBuilder< dimension > builder{ horizons_stack };
         async::parallel_invoke(
             [&builder, &directory] {
+                const detail::IOTraceScope trace{ "HorizonsStack",
+                    "load Identifier" };
                 builder.load_identifier( directory );
             },
             [&builder, &directory] {
-                builder.load_horizons( directory );
+                {
+                    const detail::IOTraceScope trace{ "HorizonsStack",
+                        "load Horizons" };
+                    builder.load_horizons( directory );
+                }
+                const detail::IOTraceScope trace{ "HorizonsStack",
+                    "load StratigraphicUnits" };
                 builder.load_stratigraphic_units( directory );
             },
             [&builder, &directory] {
+                const detail::IOTraceScope trace{ "HorizonsStack",
+                    "load StratigraphicRelationships" };
                 builder.load_stratigraphic_relationships( directory );
             } );
+        const detail::IOTraceScope trace{ "HorizonsStack",
+            "compute top and bottom horizons" };
         builder.compute_top_and_bottom_horizons();
     }
 
@@ -56,7 +69,10 @@ namespace geode
     HorizonsStack< dimension > OpenGeodeHorizonsStackInput< dimension >::read()
     {
         const UnzipFile zip_reader{ this->filename(), uuid{}.string() };
-        zip_reader.extract_all();
+        {
+            const detail::IOTraceScope trace{ "HorizonsStack", "extract" };
+            zip_reader.extract_all();
+        }
         HorizonsStack< dimension > horizons_stack{ BITSERY::constructor };
         load_horizons_stack_files( horizons_stack, zip_reader.directory() );
         return horizons_stack;
@@ -34,44 +34,60 @@
 
 #include <geode/model/representation/io/geode/geode_section_input.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/explicit/representation/io/geode/geode_cross_section_input.hpp>
 #include <geode/geosciences/implicit/representation/builder/implicit_cross_section_builder.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_cross_section.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_query_trees.hpp>
 #include <geode/geosciences/implicit/representation/io/horizons_stack_input.hpp>
 
-namespace geode
+namespace
 {
-    ImplicitCrossSection OpenGeodeImplicitCrossSectionInput::read()
+    void load_implicit_section_impl(
+        geode::ImplicitCrossSection& section, std::string_view directory )
     {
-        const UnzipFile zip_reader{ this->filename(), uuid{}.string() };
-        zip_reader.extract_all();
-        ImplicitCrossSection section{ BITSERY::constructor };
-        detail::load_implicit_cross_section_files(
-            section, zip_reader.directory() );
-        const auto impl_filename = absl::StrCat(
-            zip_reader.directory(), "/implicit_section_impl.og_ixsctn" );
-        OpenGeodeGeosciencesImplicitException::check_exception(
-            std::filesystem::exists( to_string( impl_filename ) ), nullptr,
-            OpenGeodeException::TYPE::data,
+        const auto impl_filename =
+            absl::StrCat( directory, "/implicit_section_impl.og_ixsctn" );
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
+            std::filesystem::exists( geode::to_string( impl_filename ) ),
+            nullptr, geode::OpenGeodeException::TYPE::data,
             "[OpenGeodeImplicitCrossSectionInput::read] Error in reading "
             "files: Could not find stored impl." );
+        const geode::detail::IOTraceScope trace{ "ImplicitCrossSection",
+            "load ImplicitImpl" };
         std::ifstream file{ impl_filename, std::ifstream::binary };
-        TContext context{};
-        BitseryExtensions::register_deserialize_pcontext(
+        geode::TContext context{};
+        geode::BitseryExtensions::register_deserialize_pcontext(
             std::get< 0 >( context ) );
-        Deserializer archive{ context, file };
+        geode::Deserializer archive{ context, file };
         archive.object( section );
         const auto& adapter = archive.adapter();
-        OpenGeodeGeosciencesImplicitException::check_exception(
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
             adapter.error() == bitsery::ReaderError::NoError
                 && adapter.isCompletedSuccessfully()
                 && std::get< 1 >( context ).isValid(),
-            nullptr, OpenGeodeException::TYPE::internal,
+            nullptr, geode::OpenGeodeException::TYPE::internal,
             "[OpenGeodeImplicitCrossSectionOutput::load_section_impl] "
             "Error while reading file: ",
             impl_filename );
+    }
+} // namespace
 
+namespace geode
+{
+    ImplicitCrossSection OpenGeodeImplicitCrossSectionInput::read()
+    {
+        ImplicitCrossSection section{ BITSERY::constructor };
+        detail::read_geode_archive( this->filename(), "ImplicitCrossSection",
+            [&section]( std::string_view directory ) {
+                detail::load_implicit_cross_section_files( section, directory );
+                load_implicit_section_impl( section, directory );
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "load QueryTrees" };
+                detail::load_implicit_section_query_trees( section, directory );
+            } );
         return section;
     }
 
@@ -81,11 +97,19 @@ namespace geode
             ImplicitCrossSection& section, std::string_view directory )
         {
             ImplicitCrossSectionBuilder builder{ section };
-            builder.set_horizons_stack( load_horizons_stack< 2 >(
-                absl::StrCat( directory, "/horizons_stack.",
-                    HorizonsStack2D::native_extension_static() ) ) );
+            {
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "load HorizonsStack" };
+                builder.set_horizons_stack( load_horizons_stack< 2 >(
+                    absl::StrCat( directory, "/horizons_stack.",
+                        HorizonsStack2D::native_extension_static() ) ) );
+            }
             // builder.reinitialize_implicit_query_trees();
-            load_cross_section_files( section, directory );
+            {
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "load CrossSection" };
+                load_cross_section_files( section, directory );
+            }
         }
     } // namespace detail
 } // namespace geode
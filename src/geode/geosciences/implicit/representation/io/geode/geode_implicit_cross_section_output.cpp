@@ -36,8 +36,10 @@
 
 #include <geode/model/representation/io/geode/geode_section_output.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
 #include <geode/geosciences/explicit/representation/io/geode/geode_cross_section_output.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_query_trees.hpp>
 #include <geode/geosciences/implicit/representation/io/horizons_stack_output.hpp>
 
 namespace geode
@@ -45,6 +47,7 @@ namespace geode
     void OpenGeodeImplicitCrossSectionOutput::archive_implicit_section_files(
         const ZipFile& zip_writer ) const
     {
+        const detail::IOTraceScope trace{ "ImplicitCrossSection", "archive" };
         for( const auto& file :
             std::filesystem::directory_iterator( zip_writer.directory() ) )
         {
@@ -58,16 +61,22 @@ namespace geode
     {
         async::parallel_invoke(
             [&directory, &implicit_section] {
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "save CrossSection" };
                 OpenGeodeCrossSectionOutput cross_section_output{ "" };
                 cross_section_output.save_cross_section_files(
                     implicit_section, directory );
             },
             [&directory, &implicit_section] {
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "save HorizonsStack" };
                 save_horizons_stack( implicit_section.horizons_stack(),
                     absl::StrCat( directory, "/horizons_stack.",
                         HorizonsStack2D::native_extension_static() ) );
             },
             [&directory, &implicit_section] {
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "save ImplicitImpl" };
                 const auto filename = absl::StrCat(
                     directory, "/implicit_section_impl.og_ixsctn" );
                 std::ofstream file{ filename, std::ofstream::binary };
@@ -83,15 +92,26 @@ namespace geode
                     "[OpenGeodeImplicitCrossSectionOutput::save_section_impl] "
                     "Error while writing file: ",
                     filename );
+            },
+            [&directory, &implicit_section, this] {
+                if( !save_query_trees_ )
+                {
+                    return;
+                }
+                const detail::IOTraceScope trace{ "ImplicitCrossSection",
+                    "save QueryTrees" };
+                detail::save_implicit_section_query_trees(
+                    implicit_section, directory );
             } );
     }
 
     std::vector< std::string > OpenGeodeImplicitCrossSectionOutput::write(
         const ImplicitCrossSection& implicit_section ) const
     {
-        const ZipFile zip_writer{ this->filename(), uuid{}.string() };
-        save_implicit_section_files( implicit_section, zip_writer.directory() );
-        archive_implicit_section_files( zip_writer );
+        detail::write_geode_archive( this->filename(), *this,
+            [&implicit_section, this]( std::string_view directory ) {
+                save_implicit_section_files( implicit_section, directory );
+            } );
         return { to_string( this->filename() ) };
     }
 } // namespace geode
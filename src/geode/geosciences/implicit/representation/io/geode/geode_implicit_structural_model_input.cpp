@@ -34,56 +34,101 @@
 
 #include <geode/model/representation/io/geode/geode_brep_input.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/explicit/representation/io/geode/geode_structural_model_input.hpp>
 #include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_fields.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_query_trees.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_values_overlay.hpp>
 #include <geode/geosciences/implicit/representation/io/horizons_stack_input.hpp>
 
-namespace geode
+namespace
 {
-    ImplicitStructuralModel OpenGeodeImplicitStructuralModelInput::read()
+    void load_implicit_model_impl(
+        geode::ImplicitStructuralModel& model, std::string_view directory )
     {
-        const UnzipFile zip_reader{ this->filename(), uuid{}.string() };
-        zip_reader.extract_all();
-        ImplicitStructuralModel model{ BITSERY::constructor };
-        detail::load_implicit_structural_model_files(
-            model, zip_reader.directory() );
-        const auto impl_filename = absl::StrCat(
-            zip_reader.directory(), "/implicit_model_impl.og_istrm" );
-        OpenGeodeGeosciencesImplicitException::check_exception(
-            std::filesystem::exists( to_string( impl_filename ) ), nullptr,
-            OpenGeodeException::TYPE::data,
+        const auto impl_filename =
+            absl::StrCat( directory, "/implicit_model_impl.og_istrm" );
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
+            std::filesystem::exists( geode::to_string( impl_filename ) ),
+            nullptr, geode::OpenGeodeException::TYPE::data,
             "[OpenGeodeImplicitStructuralModelInput::read] Error in reading "
             "files: Could not find stored impl." );
+        const geode::detail::IOTraceScope trace{ "ImplicitStructuralModel",
+            "load ImplicitImpl" };
         std::ifstream file{ impl_filename, std::ifstream::binary };
-        TContext context{};
-        BitseryExtensions::register_deserialize_pcontext(
+        geode::TContext context{};
+        geode::BitseryExtensions::register_deserialize_pcontext(
             std::get< 0 >( context ) );
-        Deserializer archive{ context, file };
+        geode::Deserializer archive{ context, file };
         archive.object( model );
         const auto& adapter = archive.adapter();
-        OpenGeodeGeosciencesImplicitException::check_exception(
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
             adapter.error() == bitsery::ReaderError::NoError
                 && adapter.isCompletedSuccessfully()
                 && std::get< 1 >( context ).isValid(),
-            nullptr, OpenGeodeException::TYPE::internal,
+            nullptr, geode::OpenGeodeException::TYPE::internal,
             "[OpenGeodeImplicitStructuralModelOutput::load_model_impl] "
             "Error while reading file: ",
             impl_filename );
+    }
+} // namespace
+
+namespace geode
+{
+    ImplicitStructuralModel OpenGeodeImplicitStructuralModelInput::read()
+    {
+        ImplicitStructuralModel model{ BITSERY::constructor };
+        detail::read_geode_archive( this->filename(), "ImplicitStructuralModel",
+            [&model]( std::string_view directory ) {
+                detail::load_implicit_structural_model_directory(
+                    model, directory );
+            } );
+        if( std::filesystem::is_directory( to_string( this->filename() ) ) )
+        {
+            const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                "map fields" };
+            detail::map_implicit_model_fields( model, this->filename() );
+        }
         return model;
     }
 
     namespace detail
     {
+        void load_implicit_structural_model_directory(
+            ImplicitStructuralModel& model, std::string_view directory )
+        {
+            load_implicit_structural_model_files( model, directory );
+            load_implicit_model_impl( model, directory );
+            {
+                const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                    "load implicit values" };
+                load_block_implicit_values( model, directory );
+            }
+            const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                "load QueryTrees" };
+            load_implicit_model_query_trees( model, directory );
+        }
+
         void load_implicit_structural_model_files(
             ImplicitStructuralModel& model, std::string_view directory )
         {
             ImplicitStructuralModelBuilder builder{ model };
-            builder.set_horizons_stack( load_horizons_stack< 3 >(
-                absl::StrCat( directory, "/horizons_stack.",
-                    HorizonsStack3D::native_extension_static() ) ) );
-            load_structural_model_files( model, directory );
+            {
+                const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                    "load HorizonsStack" };
+                builder.set_horizons_stack( load_horizons_stack< 3 >(
+                    absl::StrCat( directory, "/horizons_stack.",
+                        HorizonsStack3D::native_extension_static() ) ) );
+            }
+            {
+                const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                    "load StructuralModel" };
+                load_structural_model_files( model, directory );
+            }
             // builder.reinitialize_implicit_query_trees();
         }
     } // namespace detail
@@ -23,27 +23,321 @@
 
 #include <geode/geosciences/implicit/representation/io/geode/geode_implicit_structural_model_output.hpp>
 
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include <absl/container/btree_map.h>
+
 #include <async++.h>
 
+#include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/range.hpp>
 #include <geode/basic/uuid.hpp>
 #include <geode/basic/zip_file.hpp>
 
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/edged_curve.hpp>
+#include <geode/mesh/core/point_set.hpp>
+#include <geode/mesh/core/surface_mesh.hpp>
+#include <geode/mesh/core/tetrahedral_solid.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+#include <geode/model/mixin/core/corner.hpp>
+#include <geode/model/mixin/core/line.hpp>
+#include <geode/model/mixin/core/surface.hpp>
 #include <geode/model/representation/io/geode/geode_brep_output.hpp>
 
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/explicit/representation/io/geode/geode_structural_model_output.hpp>
+#include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_fields.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_query_trees.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_values_overlay.hpp>
 #include <geode/geosciences/implicit/representation/io/horizons_stack_output.hpp>
 
+namespace
+{
+    constexpr auto FINGERPRINT_FILENAME = "implicit_model_fingerprint.txt";
+
+    struct ImplicitModelFingerprint
+    {
+        std::uint64_t geometry{ 0 };
+        absl::btree_map< std::string, std::uint64_t > block_values;
+    };
+
+    template < typename Vertices >
+    void add_element_vertices( geode::detail::Fingerprint& fingerprint,
+        const Vertices& vertices )
+    {
+        fingerprint.add_value( vertices.size() );
+        for( const auto vertex : vertices )
+        {
+            fingerprint.add_value( vertex );
+        }
+    }
+
+    std::uint64_t mesh_fingerprint( const geode::PointSet3D& mesh )
+    {
+        return geode::detail::mesh_vertices_fingerprint( mesh );
+    }
+
+    std::uint64_t mesh_fingerprint( const geode::EdgedCurve3D& mesh )
+    {
+        geode::detail::Fingerprint fingerprint;
+        fingerprint.add_value(
+            geode::detail::mesh_vertices_fingerprint( mesh ) );
+        fingerprint.add_value( mesh.nb_edges() );
+        for( const auto e : geode::Range{ mesh.nb_edges() } )
+        {
+            add_element_vertices( fingerprint, mesh.edge_vertices( e ) );
+        }
+        return fingerprint.value();
+    }
+
+    std::uint64_t mesh_fingerprint( const geode::SurfaceMesh3D& mesh )
+    {
+        geode::detail::Fingerprint fingerprint;
+        fingerprint.add_value(
+            geode::detail::mesh_vertices_fingerprint( mesh ) );
+        fingerprint.add_value( mesh.nb_polygons() );
+        for( const auto p : geode::Range{ mesh.nb_polygons() } )
+        {
+            add_element_vertices( fingerprint, mesh.polygon_vertices( p ) );
+        }
+        return fingerprint.value();
+    }
+
+    std::uint64_t mesh_fingerprint( const geode::SolidMesh3D& mesh )
+    {
+        geode::detail::Fingerprint fingerprint;
+        fingerprint.add_value(
+            geode::detail::mesh_vertices_fingerprint( mesh ) );
+        fingerprint.add_value( mesh.nb_polyhedra() );
+        for( const auto p : geode::Range{ mesh.nb_polyhedra() } )
+        {
+            add_element_vertices(
+                fingerprint, mesh.polyhedron_vertices( p ) );
+        }
+        return fingerprint.value();
+    }
+
+    std::uint64_t geometry_fingerprint(
+        const geode::ImplicitStructuralModel& model )
+    {
+        absl::btree_map< std::string, std::uint64_t > components;
+        const auto add_components = [&components]( const auto& range ) {
+            for( const auto& component : range )
+            {
+                components.emplace( component.id().string(),
+                    mesh_fingerprint( component.mesh() ) );
+            }
+        };
+        add_components( model.corners() );
+        add_components( model.lines() );
+        add_components( model.surfaces() );
+        add_components( model.blocks() );
+        geode::detail::Fingerprint fingerprint;
+        for( const auto& [id, value] : components )
+        {
+            fingerprint.add_string( id );
+            fingerprint.add_value( value );
+        }
+        return fingerprint.value();
+    }
+
+    /*!
+     * Hash of the implicit values of each block, and of the stratigraphic
+     * locations of its vertices for a StratigraphicModel.
+     */
+    absl::btree_map< std::string, std::uint64_t > block_values_fingerprint(
+        const geode::ImplicitStructuralModel& model )
+    {
+        const auto* stratigraphic_model =
+            dynamic_cast< const geode::StratigraphicModel* >( &model );
+        absl::btree_map< std::string, std::uint64_t > block_values;
+        for( const auto& block : model.blocks() )
+        {
+            if( block.mesh().type_name()
+                != geode::TetrahedralSolid3D::type_name_static() )
+            {
+                continue;
+            }
+            geode::detail::Fingerprint fingerprint;
+            for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+            {
+                fingerprint.add_value(
+                    model.stored_implicit_value( block, v ) );
+                if( stratigraphic_model )
+                {
+                    fingerprint.add_value(
+                        stratigraphic_model
+                            ->stratigraphic_coordinates( block, v )
+                            .stratigraphic_location() );
+                }
+            }
+            block_values.emplace( block.id().string(), fingerprint.value() );
+        }
+        return block_values;
+    }
+
+    ImplicitModelFingerprint compute_fingerprint(
+        const geode::ImplicitStructuralModel& model )
+    {
+        ImplicitModelFingerprint fingerprint;
+        async::parallel_invoke(
+            [&fingerprint, &model] {
+                fingerprint.geometry = geometry_fingerprint( model );
+            },
+            [&fingerprint, &model] {
+                fingerprint.block_values =
+                    block_values_fingerprint( model );
+            } );
+        return fingerprint;
+    }
+
+    void save_fingerprint( const ImplicitModelFingerprint& fingerprint,
+        std::string_view directory )
+    {
+        const geode::detail::IOTraceScope trace{ "ImplicitStructuralModel",
+            "save Fingerprint" };
+        std::ofstream file{ absl::StrCat(
+            directory, "/", FINGERPRINT_FILENAME ) };
+        file << "geometry " << fingerprint.geometry << "\n";
+        for( const auto& [id, value] : fingerprint.block_values )
+        {
+            file << "block " << id << " " << value << "\n";
+        }
+    }
+
+    std::optional< ImplicitModelFingerprint > load_fingerprint(
+        std::string_view filename )
+    {
+        const auto content = geode::detail::read_geode_archive_entry(
+            filename, FINGERPRINT_FILENAME );
+        if( !content )
+        {
+            return std::nullopt;
+        }
+        std::istringstream file{ content.value() };
+        ImplicitModelFingerprint fingerprint;
+        std::string key;
+        if( !( file >> key >> fingerprint.geometry ) || key != "geometry" )
+        {
+            return std::nullopt;
+        }
+        std::string id;
+        std::uint64_t value;
+        while( file >> key >> id >> value )
+        {
+            fingerprint.block_values.emplace( id, value );
+        }
+        return fingerprint;
+    }
+
+    void save_implicit_model_horizons_stack(
+        const geode::ImplicitStructuralModel& implicit_model,
+        std::string_view directory )
+    {
+        const geode::detail::IOTraceScope trace{ "ImplicitStructuralModel",
+            "save HorizonsStack" };
+        geode::save_horizons_stack( implicit_model.horizons_stack(),
+            absl::StrCat( directory, "/horizons_stack.",
+                geode::HorizonsStack3D::native_extension_static() ) );
+    }
+
+    void save_implicit_model_impl(
+        const geode::ImplicitStructuralModel& implicit_model,
+        std::string_view directory )
+    {
+        const geode::detail::IOTraceScope trace{ "ImplicitStructuralModel",
+            "save ImplicitImpl" };
+        const auto filename =
+            absl::StrCat( directory, "/implicit_model_impl.og_istrm" );
+        std::ofstream file{ filename, std::ofstream::binary };
+        geode::TContext context{};
+        geode::BitseryExtensions::register_serialize_pcontext(
+            std::get< 0 >( context ) );
+        geode::Serializer archive{ context, file };
+        archive.object( implicit_model );
+        archive.adapter().flush();
+        geode::OpenGeodeGeosciencesImplicitException::check_exception(
+            std::get< 1 >( context ).isValid(), nullptr,
+            geode::OpenGeodeException::TYPE::internal,
+            "[OpenGeodeImplicitStructuralModelOutput::save_model_impl] "
+            "Error while writing file: ",
+            filename );
+    }
+
+    void save_changed_block_values(
+        const geode::ImplicitStructuralModel& implicit_model,
+        const ImplicitModelFingerprint& fingerprint,
+        const ImplicitModelFingerprint& stored_fingerprint,
+        std::string_view directory )
+    {
+        const geode::detail::IOTraceScope trace{ "ImplicitStructuralModel",
+            "save changed block values" };
+        for( const auto& [block_id, value] : fingerprint.block_values )
+        {
+            const auto stored =
+                stored_fingerprint.block_values.find( block_id );
+            if( stored != stored_fingerprint.block_values.end()
+                && stored->second == value )
+            {
+                continue;
+            }
+            const auto& block = implicit_model.block( geode::uuid{ block_id } );
+            geode::detail::save_block_implicit_values(
+                implicit_model, block, directory );
+            if( const auto* stratigraphic_model =
+                    dynamic_cast< const geode::StratigraphicModel* >(
+                        &implicit_model ) )
+            {
+                geode::detail::save_block_stratigraphic_locations(
+                    *stratigraphic_model, block, directory );
+            }
+        }
+    }
+
+    void append_archive_files( std::string_view filename,
+        const geode::GeodeArchiveOptions& options,
+        const std::function< void( std::string_view ) >& save_files )
+    {
+        const auto directory =
+            std::filesystem::temp_directory_path() / geode::uuid{}.string();
+        std::filesystem::create_directories( directory );
+        try
+        {
+            save_files( directory.string() );
+            geode::detail::update_geode_archive(
+                filename, directory.string(), options );
+        }
+        catch( ... )
+        {
+            std::filesystem::remove_all( directory );
+            throw;
+        }
+        std::filesystem::remove_all( directory );
+    }
+} // namespace
+
 namespace geode
 {
     void OpenGeodeImplicitStructuralModelOutput::archive_implicit_model_files(
         const ZipFile& zip_writer ) const
     {
+        const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+            "archive" };
         for( const auto& file :
             std::filesystem::directory_iterator( zip_writer.directory() ) )
         {
@@ -57,40 +351,103 @@ namespace geode
     {
         async::parallel_invoke(
             [&directory, &implicit_model] {
+                const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                    "save StructuralModel" };
                 OpenGeodeStructuralModelOutput structural_model_output{ "" };
                 structural_model_output.save_structural_model_files(
                     implicit_model, directory );
             },
             [&directory, &implicit_model] {
-                save_horizons_stack( implicit_model.horizons_stack(),
-                    absl::StrCat( directory, "/horizons_stack.",
-                        HorizonsStack3D::native_extension_static() ) );
+                save_implicit_model_horizons_stack( implicit_model, directory );
             },
             [&directory, &implicit_model] {
-                const auto filename =
-                    absl::StrCat( directory, "/implicit_model_impl.og_istrm" );
-                std::ofstream file{ filename, std::ofstream::binary };
-                TContext context{};
-                BitseryExtensions::register_serialize_pcontext(
-                    std::get< 0 >( context ) );
-                Serializer archive{ context, file };
-                archive.object( implicit_model );
-                archive.adapter().flush();
-                OpenGeodeGeosciencesImplicitException::check_exception(
-                    std::get< 1 >( context ).isValid(), nullptr,
-                    OpenGeodeException::TYPE::internal,
-                    "[OpenGeodeImplicitStructuralModelOutput::save_model_impl] "
-                    "Error while writing file: ",
-                    filename );
+                save_implicit_model_impl( implicit_model, directory );
+            },
+            [&directory, &implicit_model, this] {
+                if( !save_query_trees_ )
+                {
+                    return;
+                }
+                const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                    "save QueryTrees" };
+                detail::save_implicit_model_query_trees(
+                    implicit_model, directory );
+            },
+            [&directory, &implicit_model, this] {
+                if( !save_mapped_fields_ )
+                {
+                    return;
+                }
+                const detail::IOTraceScope trace{ "ImplicitStructuralModel",
+                    "save mapped fields" };
+                detail::save_implicit_model_fields( implicit_model, directory );
             } );
     }
 
     std::vector< std::string > OpenGeodeImplicitStructuralModelOutput::write(
         const ImplicitStructuralModel& implicit_model ) const
     {
-        const ZipFile zip_writer{ this->filename(), uuid{}.string() };
-        save_implicit_model_files( implicit_model, zip_writer.directory() );
-        archive_implicit_model_files( zip_writer );
+        detail::write_geode_archive( this->filename(), *this,
+            [&implicit_model, this]( std::string_view directory ) {
+                async::parallel_invoke(
+                    [&directory, &implicit_model, this] {
+                        save_implicit_model_files( implicit_model, directory );
+                    },
+                    [&directory, &implicit_model, this] {
+                        if( update_fingerprint_ )
+                        {
+                            save_fingerprint(
+                                compute_fingerprint( implicit_model ),
+                                directory );
+                        }
+                    } );
+            } );
+        return { to_string( this->filename() ) };
+    }
+
+    std::vector< std::string > OpenGeodeImplicitStructuralModelOutput::update(
+        const ImplicitStructuralModel& implicit_model ) const
+    {
+        const auto stored_fingerprint = load_fingerprint( this->filename() );
+        const auto fingerprint = compute_fingerprint( implicit_model );
+        OpenGeodeGeosciencesImplicitException::check_exception(
+            stored_fingerprint
+                && stored_fingerprint->geometry == fingerprint.geometry,
+            nullptr, OpenGeodeException::TYPE::data,
+            "[OpenGeodeImplicitStructuralModelOutput::update] Geometry of the "
+            "model does not match the one stored in ",
+            this->filename(), ", the model should be saved entirely." );
+        const auto save_mapped_fields =
+            save_mapped_fields_
+            || detail::has_implicit_model_fields( this->filename() );
+        append_archive_files( this->filename(), *this,
+            [&implicit_model, &fingerprint, &stored_fingerprint,
+                save_mapped_fields]( std::string_view directory ) {
+                async::parallel_invoke(
+                    [&directory, &implicit_model, &fingerprint,
+                        &stored_fingerprint] {
+                        save_changed_block_values( implicit_model,
+                            fingerprint, stored_fingerprint.value(),
+                            directory );
+                    },
+                    [&directory, &implicit_model] {
+                        save_implicit_model_horizons_stack(
+                            implicit_model, directory );
+                    },
+                    [&directory, &implicit_model] {
+                        save_implicit_model_impl( implicit_model, directory );
+                    },
+                    [&directory, &fingerprint] {
+                        save_fingerprint( fingerprint, directory );
+                    },
+                    [&directory, &implicit_model, save_mapped_fields] {
+                        if( save_mapped_fields )
+                        {
+                            detail::save_implicit_model_fields(
+                                implicit_model, directory );
+                        }
+                    } );
+            } );
         return { to_string( this->filename() ) };
     }
 } // namespace geode
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/geode/geode_stratigraphic_model_input.hpp>
+
+#include <filesystem>
+#include <optional>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <geode/basic/attribute_manager.hpp>
+#include <geode/basic/bitsery_archive.hpp>
+#include <geode/basic/range.hpp>
+#include <geode/basic/uuid.hpp>
+
+#include <geode/geometry/point.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+
+#include <geode/geosciences/explicit/representation/io/detail/io_trace.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
+#include <geode/geosciences/implicit/representation/builder/stratigraphic_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_fields.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_values_overlay.hpp>
+#include <geode/geosciences/implicit/representation/io/geode/geode_implicit_structural_model_input.hpp>
+
+namespace
+{
+    /*!
+     * The stratigraphic location attribute is stored with the block meshes
+     * under the attribute id of the saved model: its values are moved into
+     * the attribute instantiated by the loaded model.
+     */
+    void import_stored_stratigraphic_locations(
+        geode::StratigraphicModel& model )
+    {
+        absl::flat_hash_map< geode::uuid, geode::uuid > stored_attributes;
+        for( const auto& block : model.blocks() )
+        {
+            if( const auto ids =
+                    block.mesh().vertex_attribute_manager()
+                        .attribute_ids_matching_name(
+                            geode::StratigraphicModel::
+                                STRATIGRAPHIC_LOCATION_ATTRIBUTE_NAME ) )
+            {
+                stored_attributes.emplace( block.id(), ids->front() );
+            }
+        }
+        geode::StratigraphicModelBuilder builder{ model };
+        builder.instantiate_stratigraphic_attribute_on_blocks();
+        for( const auto& [block_id, attribute_id] : stored_attributes )
+        {
+            const auto& block = model.block( block_id );
+            auto& manager = block.mesh().vertex_attribute_manager();
+            const auto stored_attribute =
+                manager.find_read_only_attribute< geode::Point2D >(
+                    attribute_id );
+            for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+            {
+                builder.set_stratigraphic_location(
+                    block, v, stored_attribute->value( v ) );
+            }
+            manager.delete_attribute( attribute_id );
+        }
+    }
+} // namespace
+
+namespace geode
+{
+    StratigraphicModel OpenGeodeStratigraphicModelInput::read()
+    {
+        ImplicitStructuralModel implicit_model{ BITSERY::constructor };
+        std::optional< StratigraphicModel > model;
+        detail::read_geode_archive( this->filename(), "StratigraphicModel",
+            [&implicit_model, &model]( std::string_view directory ) {
+                detail::load_implicit_structural_model_directory(
+                    implicit_model, directory );
+                model.emplace( std::move( implicit_model ) );
+                import_stored_stratigraphic_locations( model.value() );
+                const detail::IOTraceScope trace{ "StratigraphicModel",
+                    "load stratigraphic locations" };
+                detail::load_block_stratigraphic_locations(
+                    model.value(), directory );
+            } );
+        if( std::filesystem::is_directory( to_string( this->filename() ) ) )
+        {
+            const detail::IOTraceScope trace{ "StratigraphicModel",
+                "map fields" };
+            detail::map_implicit_model_fields(
+                model.value(), this->filename() );
+        }
+        return std::move( model.value() );
+    }
+} // namespace geode
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/geode/geode_stratigraphic_model_output.hpp>
+
+#include <geode/geosciences/implicit/representation/io/geode/geode_implicit_structural_model_output.hpp>
+
+namespace
+{
+    geode::OpenGeodeImplicitStructuralModelOutput implicit_model_output(
+        const geode::OpenGeodeStratigraphicModelOutput& output )
+    {
+        geode::OpenGeodeImplicitStructuralModelOutput implicit_output{
+            output.filename()
+        };
+        static_cast< geode::GeodeArchiveOptions& >( implicit_output ) = output;
+        implicit_output.set_update_fingerprint( output.update_fingerprint() );
+        implicit_output.set_save_query_trees( output.save_query_trees() );
+        implicit_output.set_save_mapped_fields( output.save_mapped_fields() );
+        return implicit_output;
+    }
+} // namespace
+
+namespace geode
+{
+    std::vector< std::string > OpenGeodeStratigraphicModelOutput::write(
+        const StratigraphicModel& stratigraphic_model ) const
+    {
+        return implicit_model_output( *this ).write( stratigraphic_model );
+    }
+
+    std::vector< std::string > OpenGeodeStratigraphicModelOutput::update(
+        const StratigraphicModel& stratigraphic_model ) const
+    {
+        return implicit_model_output( *this ).update( stratigraphic_model );
+    }
+} // namespace geode
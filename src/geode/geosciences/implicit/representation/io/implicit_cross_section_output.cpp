@@ -34,6 +34,7 @@
 #include <geode/model/representation/io/section_output.hpp>
 
 #include <geode/geosciences/explicit/representation/io/cross_section_output.hpp>
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_cross_section.hpp>
 
 namespace geode
@@ -62,6 +63,15 @@ namespace geode
         }
     }
 
+    std::vector< std::string > save_implicit_cross_section(
+        const ImplicitCrossSection& implicit_model,
+        std::string_view filename,
+        const GeodeArchiveOptions& archive_options )
+    {
+        return detail::save_geode_archive< ImplicitCrossSectionOutputFactory >(
+            implicit_model, filename, archive_options );
+    }
+
     bool is_implicit_cross_section_saveable(
         const ImplicitCrossSection& section, std::string_view filename )
     {
@@ -33,6 +33,7 @@
 
 #include <geode/model/representation/io/brep_output.hpp>
 
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/explicit/representation/io/structural_model_output.hpp>
 #include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
 
@@ -64,6 +65,16 @@ namespace geode
         }
     }
 
+    std::vector< std::string > save_implicit_structural_model(
+        const ImplicitStructuralModel& implicit_model,
+        std::string_view filename,
+        const GeodeArchiveOptions& archive_options )
+    {
+        return detail::save_geode_archive<
+            ImplicitStructuralModelOutputFactory >(
+            implicit_model, filename, archive_options );
+    }
+
     bool is_implicit_structural_model_saveable(
         const ImplicitStructuralModel& implicit_model,
         std::string_view filename )
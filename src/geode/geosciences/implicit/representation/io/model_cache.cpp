@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2019 - 2026 Geode-solutions
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include <geode/geosciences/implicit/representation/io/model_cache.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+#include <absl/container/flat_hash_map.h>
+#include <absl/types/span.h>
+
+#include <geode/geometry/bounding_box.hpp>
+
+#include <geode/mesh/core/solid_mesh.hpp>
+
+#include <geode/model/mixin/core/block.hpp>
+
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/instrumentation.hpp>
+#include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/fingerprint.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/mapped_file.hpp>
+#include <geode/geosciences/implicit/representation/io/implicit_structural_model_input.hpp>
+#include <geode/geosciences/implicit/representation/io/stratigraphic_model_input.hpp>
+
+namespace
+{
+    using CachedModel = std::shared_ptr< const geode::ImplicitStructuralModel >;
+
+    enum struct MODEL_KIND : std::uint8_t
+    {
+        implicit_structural,
+        stratigraphic
+    };
+
+    struct FileSignature
+    {
+        bool operator==( const FileSignature& other ) const
+        {
+            return nb_files == other.nb_files && nb_bytes == other.nb_bytes
+                   && last_write == other.last_write;
+        }
+
+        std::size_t nb_files{ 0 };
+        std::uint64_t nb_bytes{ 0 };
+        std::filesystem::file_time_type last_write{
+            std::filesystem::file_time_type::min()
+        };
+    };
+
+    /*!
+     * Files holding the model content: the file itself, or every regular file
+     * of a directory archive sorted by path.
+     */
+    std::vector< std::filesystem::path > content_files(
+        const std::filesystem::path& path )
+    {
+        if( !std::filesystem::is_directory( path ) )
+        {
+            return { path };
+        }
+        std::vector< std::filesystem::path > files;
+        for( const auto& entry :
+            std::filesystem::recursive_directory_iterator( path ) )
+        {
+            if( entry.is_regular_file() )
+            {
+                files.push_back( entry.path() );
+            }
+        }
+        absl::c_sort( files );
+        return files;
+    }
+
+    FileSignature file_signature(
+        absl::Span< const std::filesystem::path > files )
+    {
+        FileSignature signature;
+        signature.nb_files = files.size();
+        for( const auto& file : files )
+        {
+            signature.nb_bytes += std::filesystem::file_size( file );
+            signature.last_write =
+                std::max( signature.last_write,
+                    std::filesystem::last_write_time( file ) );
+        }
+        return signature;
+    }
+
+    std::uint64_t content_fingerprint( const std::filesystem::path& root,
+        absl::Span< const std::filesystem::path > files )
+    {
+        OPENGEODE_GEOSCIENCES_TIME_SCOPE( "ModelCache::content_fingerprint" );
+        geode::detail::Fingerprint fingerprint;
+        for( const auto& file : files )
+        {
+            fingerprint.add_string(
+                file.lexically_relative( root ).generic_string() );
+            const geode::detail::MappedFile mapped_file{ file.string() };
+            const auto data = mapped_file.data();
+            fingerprint.add_value( data.size() );
+            fingerprint.add_string( { data.data(), data.size() } );
+        }
+        return fingerprint.value();
+    }
+
+    /*!
+     * Estimated size of the block query trees built before a model is
+     * shared: about two boxes and one index per tetrahedron and tree.
+     */
+    std::uint64_t query_trees_nb_bytes(
+        const geode::ImplicitStructuralModel& model, MODEL_KIND kind )
+    {
+        constexpr std::uint64_t BYTES_PER_ELEMENT{
+            2 * sizeof( geode::BoundingBox3D ) + sizeof( geode::index_t )
+        };
+        const std::uint64_t nb_trees{ kind == MODEL_KIND::stratigraphic ? 2u
+                                                                        : 1u };
+        std::uint64_t nb_elements{ 0 };
+        for( const auto& block : model.blocks() )
+        {
+            nb_elements += block.mesh().nb_polyhedra();
+        }
+        return nb_trees * nb_elements * BYTES_PER_ELEMENT;
+    }
+
+    /*!
+     * Takes the result of an accessor called only to build a lazy value.
+     */
+    template < typename Value >
+    void ensure_built( const Value& /*unused*/ )
+    {
+    }
+
+    /*!
+     * Builds every value a model computes lazily on const access. Cached
+     * models are shared between threads and CachedValue is not thread
+     * safe, so nothing may be left to compute once the model is published.
+     */
+    void build_lazy_values( const geode::ImplicitStructuralModel& model )
+    {
+        model.compute_implicit_query_trees();
+        ensure_built( model.fault_index() );
+        ensure_built( model.horizon_index() );
+        ensure_built( model.fault_block_index() );
+        ensure_built( model.stratigraphic_unit_index() );
+        ensure_built( model.fault_ids_from_names( {} ) );
+        ensure_built( model.horizon_ids_from_names( {} ) );
+        ensure_built( model.fault_block_ids_from_names( {} ) );
+        ensure_built( model.stratigraphic_unit_ids_from_names( {} ) );
+        const auto& stack = model.horizons_stack();
+        ensure_built( stack.horizon_ids_from_names( {} ) );
+        ensure_built( stack.stratigraphic_unit_ids_from_names( {} ) );
+    }
+
+    void build_lazy_values( const geode::StratigraphicModel& model )
+    {
+        build_lazy_values(
+            static_cast< const geode::ImplicitStructuralModel& >( model ) );
+        model.compute_stratigraphic_query_trees();
+        if( !model.uses_interleaved_stratigraphic_coordinates() )
+        {
+            return;
+        }
+        for( const auto& block : model.blocks() )
+        {
+            ensure_built(
+                model.interleaved_stratigraphic_coordinates( block ) );
+        }
+    }
+
+    class ModelCache
+    {
+        using ContentKey = std::pair< MODEL_KIND, std::uint64_t >;
+
+        struct PathEntry
+        {
+            FileSignature signature;
+            std::uint64_t fingerprint{ 0 };
+        };
+
+        struct Entry
+        {
+            std::shared_future< CachedModel > model;
+            std::uint64_t nb_bytes{ 0 };
+            std::uint64_t generation{ 0 };
+            std::list< ContentKey >::iterator position;
+        };
+
+    public:
+        static ModelCache& instance()
+        {
+            static ModelCache cache;
+            return cache;
+        }
+
+        template < typename Loader >
+        CachedModel get(
+            MODEL_KIND kind, std::string_view filename, const Loader& loader )
+        {
+            const std::filesystem::path file{ geode::to_string( filename ) };
+            geode::OpenGeodeGeosciencesImplicitException::check_exception(
+                std::filesystem::exists( file ), nullptr,
+                geode::OpenGeodeException::TYPE::data,
+                "[ModelCache] Cannot find file: ", filename );
+            const auto path = std::filesystem::canonical( file );
+            const auto files = content_files( path );
+            const auto signature = file_signature( files );
+            const ContentKey key{ kind, fingerprint( path, files, signature ) };
+            std::promise< CachedModel > promise;
+            std::shared_future< CachedModel > model;
+            std::uint64_t generation{ 0 };
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                const auto entry = entries_.find( key );
+                if( entry != entries_.end() )
+                {
+                    nb_hits_++;
+                    lru_.splice( lru_.begin(), lru_, entry->second.position );
+                    model = entry->second.model;
+                }
+                else
+                {
+                    nb_misses_++;
+                    model = promise.get_future().share();
+                    generation = ++nb_generations_;
+                    lru_.push_front( key );
+                    entries_.emplace(
+                        key, Entry{ model, 0, generation, lru_.begin() } );
+                }
+            }
+            if( generation == 0 )
+            {
+                return model.get();
+            }
+            std::uint64_t nb_bytes{ 0 };
+            try
+            {
+                OPENGEODE_GEOSCIENCES_TIME_SCOPE( "ModelCache::load" );
+                auto loaded_model = loader( path.string() );
+                nb_bytes =
+                    geode::detail::geode_archive_payload_size( path.string() )
+                    + query_trees_nb_bytes( *loaded_model, kind );
+                promise.set_value( std::move( loaded_model ) );
+            }
+            catch( ... )
+            {
+                promise.set_exception( std::current_exception() );
+                remove( key, generation );
+                throw;
+            }
+            account( key, generation, nb_bytes );
+            return model.get();
+        }
+
+        void set_memory_budget( std::uint64_t nb_bytes )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            memory_budget_ = nb_bytes;
+            evict();
+        }
+
+        geode::ModelCacheStatistics statistics()
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            geode::ModelCacheStatistics result;
+            result.nb_models = static_cast< geode::index_t >( lru_.size() );
+            result.nb_bytes = nb_bytes_;
+            result.memory_budget = memory_budget_;
+            result.nb_hits = nb_hits_;
+            result.nb_misses = nb_misses_;
+            result.nb_evictions = nb_evictions_;
+            return result;
+        }
+
+        void clear()
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            entries_.clear();
+            lru_.clear();
+            paths_.clear();
+            nb_bytes_ = 0;
+            nb_hits_ = 0;
+            nb_misses_ = 0;
+            nb_evictions_ = 0;
+        }
+
+    private:
+        /*!
+         * The content fingerprint of a path is computed again only when the
+         * size or the modification time of its files changed.
+         */
+        std::uint64_t fingerprint( const std::filesystem::path& path,
+            absl::Span< const std::filesystem::path > files,
+            const FileSignature& signature )
+        {
+            const auto path_key = path.string();
+            {
+                std::lock_guard< std::mutex > lock{ mutex_ };
+                const auto known_path = paths_.find( path_key );
+                if( known_path != paths_.end()
+                    && known_path->second.signature == signature )
+                {
+                    return known_path->second.fingerprint;
+                }
+            }
+            const auto value = content_fingerprint( path, files );
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            paths_[path_key] = { signature, value };
+            return value;
+        }
+
+        /*!
+         * Charges the in-memory size of a loaded model to the budget, unless
+         * its entry was dropped or replaced while loading.
+         */
+        void account( const ContentKey& key,
+            std::uint64_t generation,
+            std::uint64_t nb_bytes )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            const auto entry = entries_.find( key );
+            if( entry == entries_.end()
+                || entry->second.generation != generation )
+            {
+                return;
+            }
+            entry->second.nb_bytes = nb_bytes;
+            nb_bytes_ += nb_bytes;
+            evict();
+        }
+
+        void remove( const ContentKey& key, std::uint64_t generation )
+        {
+            std::lock_guard< std::mutex > lock{ mutex_ };
+            const auto entry = entries_.find( key );
+            if( entry == entries_.end()
+                || entry->second.generation != generation )
+            {
+                return;
+            }
+            nb_bytes_ -= entry->second.nb_bytes;
+            lru_.erase( entry->second.position );
+            entries_.erase( entry );
+            forget_paths( key.second );
+        }
+
+        /*!
+         * Drops the known paths of a content no longer cached by any kind of
+         * model, so that paths are only kept for cached contents.
+         */
+        void forget_paths( std::uint64_t content )
+        {
+            for( const auto kind :
+                { MODEL_KIND::implicit_structural, MODEL_KIND::stratigraphic } )
+            {
+                if( entries_.contains( ContentKey{ kind, content } ) )
+                {
+                    return;
+                }
+            }
+            absl::erase_if( paths_, [content]( const auto& path ) {
+                return path.second.fingerprint == content;
+            } );
+        }
+
+        /*!
+         * Drops the least recently used models until the budget is met.
+         * Callers keep their handle, and waiters of a model still loading
+         * keep their future.
+         */
+        void evict()
+        {
+            while( nb_bytes_ > memory_budget_ && !lru_.empty() )
+            {
+                const auto key = lru_.back();
+                const auto entry = entries_.find( key );
+                nb_bytes_ -= entry->second.nb_bytes;
+                entries_.erase( entry );
+                lru_.pop_back();
+                forget_paths( key.second );
+                nb_evictions_++;
+            }
+        }
+
+    private:
+        std::mutex mutex_;
+        absl::flat_hash_map< ContentKey, Entry > entries_;
+        absl::flat_hash_map< std::string, PathEntry > paths_;
+        std::list< ContentKey > lru_;
+        std::uint64_t memory_budget_{
+            std::numeric_limits< std::uint64_t >::max()
+        };
+        std::uint64_t nb_bytes_{ 0 };
+        std::uint64_t nb_hits_{ 0 };
+        std::uint64_t nb_misses_{ 0 };
+        std::uint64_t nb_evictions_{ 0 };
+        std::uint64_t nb_generations_{ 0 };
+    };
+} // namespace
+
+namespace geode
+{
+    std::shared_ptr< const StratigraphicModel > cached_stratigraphic_model(
+        std::string_view filename )
+    {
+        return std::static_pointer_cast< const StratigraphicModel >(
+            ModelCache::instance().get( MODEL_KIND::stratigraphic, filename,
+                []( std::string_view path ) {
+                    auto model = std::make_shared< const StratigraphicModel >(
+                        load_stratigraphic_model( path ) );
+                    build_lazy_values( *model );
+                    return CachedModel{ std::move( model ) };
+                } ) );
+    }
+
+    std::shared_ptr< const ImplicitStructuralModel >
+        cached_implicit_structural_model( std::string_view filename )
+    {
+        return ModelCache::instance().get( MODEL_KIND::implicit_structural,
+            filename, []( std::string_view path ) {
+                auto model = std::make_shared< const ImplicitStructuralModel >(
+                    load_implicit_structural_model( path ) );
+                build_lazy_values( *model );
+                return CachedModel{ std::move( model ) };
+            } );
+    }
+
+    void set_model_cache_memory_budget( std::uint64_t nb_bytes )
+    {
+        ModelCache::instance().set_memory_budget( nb_bytes );
+    }
+
+    ModelCacheStatistics model_cache_statistics()
+    {
+        return ModelCache::instance().statistics();
+    }
+
+    void clear_model_cache()
+    {
+        ModelCache::instance().clear();
+    }
+} // namespace geode
@@ -21,6 +21,9 @@
  *
  */
 
+#include <absl/algorithm/container.h>
+#include <absl/strings/match.h>
+
 #include <geode/basic/assert.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
@@ -34,6 +37,7 @@
 #include <geode/mesh/io/triangulated_surface_output.hpp>
 
 #include <geode/geosciences/explicit/geometry/geographic_coordinate_system.hpp>
+#include <geode/geosciences/explicit/geometry/geographic_coordinate_system_catalogue.hpp>
 #include <geode/geosciences/explicit/geometry/geographic_coordinate_system_helper.hpp>
 
 #include <geode/tests_config.hpp>
@@ -85,6 +89,106 @@ void test_crs()
     }
 }
 
+void test_crs_chunks()
+{
+    constexpr geode::index_t NB_VALUES{ 4 };
+    geode::AttributeManager reference_manager;
+    reference_manager.resize( NB_VALUES );
+    geode::GeographicCoordinateSystem3D reference_lambert1{ reference_manager,
+        { "EPSG", "27571", "I" } };
+    for( const auto p : geode::Range{ NB_VALUES } )
+    {
+        const auto value = static_cast< double >( p );
+        reference_lambert1.set_point(
+            p, geode::Point3D{ { value, value, value } } );
+    }
+    geode::GeographicCoordinateSystem3D reference_lambert2{ reference_manager,
+        { "EPSG", "27572", "II" } };
+    reference_lambert2.import_coordinates( reference_lambert1 );
+
+    constexpr geode::index_t NB_POINTS{ 10000 };
+    geode::AttributeManager manager;
+    manager.resize( NB_POINTS );
+    geode::GeographicCoordinateSystem3D lambert1{ manager,
+        { "EPSG", "27571", "I" } };
+    for( const auto p : geode::Range{ NB_POINTS } )
+    {
+        const auto value = static_cast< double >( p % NB_VALUES );
+        lambert1.set_point( p, geode::Point3D{ { value, value, value } } );
+    }
+    geode::GeographicCoordinateSystem3D lambert2{ manager,
+        { "EPSG", "27572", "II" } };
+    lambert2.import_coordinates( lambert1 );
+    for( const auto p : geode::Range{ NB_POINTS } )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::test(
+            lambert2.point( p ).inexact_equal(
+                reference_lambert2.point( p % NB_VALUES ) ),
+            "Wrong chunked coordinate conversion" );
+    }
+}
+
+void test_catalogue()
+{
+    const auto catalogue = geode::geographic_coordinate_system_catalogue();
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        catalogue.size() == 13181, "Wrong number of catalogue CRS" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        catalogue.data()
+            == geode::geographic_coordinate_system_catalogue().data(),
+        "Catalogue should be built once" );
+
+    const auto lambert =
+        geode::find_geographic_coordinate_system( "EPSG:27572" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        lambert && lambert->code == "27572", "Wrong catalogue lookup" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        !geode::is_geographic_coordinate_system_known( "EPSG:0" ),
+        "Wrong unknown CRS validation" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        geode::geographic_coordinate_system_type( "EPSG:27572" )
+            == geode::GeographicCoordinateSystemType::projected,
+        "Wrong projected CRS type" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        geode::geographic_coordinate_system_type( "EPSG:4326" )
+            == geode::GeographicCoordinateSystemType::geographic_2d,
+        "Wrong geographic CRS type" );
+
+    const auto prefixed =
+        geode::geographic_coordinate_systems_with_name_prefix( "ntf (paris)" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        !prefixed.empty(), "Wrong number of prefixed CRS" );
+    for( const auto& info : prefixed )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::test(
+            absl::StartsWith( info.name, "NTF (Paris)" ),
+            "Wrong prefixed CRS ", info.string() );
+    }
+    const auto projected =
+        geode::geographic_coordinate_systems_with_name_containing(
+            "LAMBERT ZONE II",
+            geode::GeographicCoordinateSystemType::projected );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        absl::c_any_of( projected,
+            []( const auto& info ) {
+                return info.authority_code() == "EPSG:27572";
+            } ),
+        "Lambert zone II should be found by name" );
+    for( const auto& info : projected )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::test(
+            geode::geographic_coordinate_system_type( info.authority_code() )
+                == geode::GeographicCoordinateSystemType::projected,
+            "Wrong filtered CRS type ", info.string() );
+    }
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        geode::geographic_coordinate_systems_of_type(
+            geode::GeographicCoordinateSystemType::vertical )
+                .size()
+            < catalogue.size(),
+        "Wrong number of vertical CRS" );
+}
+
 int main()
 {
     try
@@ -92,6 +196,8 @@ int main()
         geode::OpenGeodeGeosciencesExplicitLibrary::initialize();
         test_bitsery();
         test_crs();
+        test_crs_chunks();
+        test_catalogue();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
@@ -21,17 +21,24 @@
  *
  */
 
+#include <array>
+#include <string>
+
+#include <absl/algorithm/container.h>
+
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
 #include <geode/basic/range.hpp>
 
 #include <geode/model/mixin/core/line.hpp>
 #include <geode/model/mixin/core/surface.hpp>
+#include <geode/model/representation/builder/brep_builder.hpp>
 
 #include <geode/geosciences/explicit/mixin/core/fault.hpp>
 #include <geode/geosciences/explicit/mixin/core/horizon.hpp>
 #include <geode/geosciences/explicit/representation/builder/structural_model_builder.hpp>
 #include <geode/geosciences/explicit/representation/core/structural_model.hpp>
+#include <geode/geosciences/explicit/representation/io/io_trace.hpp>
 #include <geode/geosciences/explicit/representation/io/structural_model_input.hpp>
 #include <geode/geosciences/explicit/representation/io/structural_model_output.hpp>
 
@@ -81,6 +88,10 @@ void add_faults(
     geode::OpenGeodeGeosciencesExplicitException::test(
         model.fault( fault1 ).name() == "new_fault1",
         "Wrong modified Fault name" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        model.fault_id_from_name( "new_fault1" ) == fault1
+            && !model.fault_id_from_name( "fault1" ),
+        "Wrong Fault found from its modified name" );
 }
 
 void add_horizons(
@@ -128,6 +139,13 @@ void add_horizons(
     geode::OpenGeodeGeosciencesExplicitException::test(
         model.horizon( horizon2 ).name() == "new_horizon2",
         "Wrong modified Horizon name" );
+    const std::array< std::string, 3 > names{ "new_horizon2", "horizon2",
+        "unknown" };
+    const auto horizon_ids = model.horizon_ids_from_names( names );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        horizon_ids.size() == 3 && horizon_ids[0] == horizon2
+            && !horizon_ids[1] && !horizon_ids[2],
+        "Wrong Horizons found from their names" );
 }
 
 void add_lines( geode::BRepBuilder& builder )
@@ -193,6 +211,31 @@ void do_checks( const geode::StructuralModel& model,
         count_items( model.fault_items( model.fault( faults_uuids[1] ) ) ) == 2,
         "Number of iterations on items in "
         "faults_uuids[1] should be 2" );
+
+    const auto& fault_index = model.fault_index();
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        fault_index.nb_collections() == model.nb_faults(),
+        "Fault index should contain all faults" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        fault_index.items( faults_uuids[0] ).size() == 3,
+        "Fault index should give 3 items in faults_uuids[0]" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        fault_index.collections( surface_uuids[2] ).size() == 2,
+        "Fault index should give 2 faults for surface_uuids[2]" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        fault_index.collections( surface_uuids[4] ).empty(),
+        "Fault index should give no fault for surface_uuids[4]" );
+    const auto& horizon_index = model.horizon_index();
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        horizon_index.items( horizons_uuids[1] ).empty(),
+        "Horizon index should give no item in horizons_uuids[1]" );
+    for( const auto& surface_id : horizon_index.items( horizons_uuids[2] ) )
+    {
+        geode::OpenGeodeGeosciencesExplicitException::test(
+            horizon_index.collections( surface_id ).front()
+                == horizons_uuids[2],
+            "Horizon index should give horizons_uuids[2] for its items" );
+    }
 }
 
 void build_relations_between_geometry_and_geology(
@@ -257,16 +300,44 @@ void check_reloaded_model( const geode::StructuralModel& reloaded_model )
     geode::OpenGeodeGeosciencesExplicitException::test(
         reloaded_model.nb_faults() == 2,
         "Number of faults in reloaded model should be 2" );
+    const auto horizon_id =
+        reloaded_model.horizon_id_from_name( "new_horizon2" );
+    const auto fault_id = reloaded_model.fault_id_from_name( "new_fault1" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        horizon_id
+            && reloaded_model.horizon( horizon_id.value() ).name()
+                   == "new_horizon2"
+            && fault_id
+            && reloaded_model.fault( fault_id.value() ).name()
+                   == "new_fault1",
+        "Reloaded components should be found from their names" );
 }
 
 void test_io( const geode::StructuralModel& model )
 {
     const auto file_io = absl::StrCat( "test.", model.native_extension() );
+    geode::start_io_trace();
     geode::save_structural_model( model, file_io );
 
     geode::StructuralModel reloaded_model =
         geode::load_structural_model( file_io );
+    const auto trace = geode::stop_io_trace();
     check_reloaded_model( reloaded_model );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        absl::c_any_of( trace,
+            []( const geode::IOTraceEvent& event ) {
+                return event.category == "StructuralModel"
+                       && event.name == "save Faults";
+            } ),
+        "Faults saving should be traced" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        absl::c_any_of( trace,
+            []( const geode::IOTraceEvent& event ) {
+                return event.category == "StructuralModel"
+                       && event.name == "load BRep";
+            } ),
+        "BRep loading should be traced" );
+    geode::save_io_trace( trace, "structural_model_io_trace.json" );
 }
 
 void test_copy( const geode::StructuralModel& model )
@@ -383,8 +454,39 @@ void modify_model(
     geode::OpenGeodeGeosciencesExplicitException::test(
         model.nb_horizons() == 0,
         "Number of horizons in modified model should be 0" );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        model.horizon_index().nb_collections() == 0,
+        "Horizon index in modified model should be empty" );
     geode::OpenGeodeGeosciencesExplicitException::test( model.nb_faults() == 2,
         "Number of faults in modified model should be 2" );
+
+    // Relationship edits from any builder should invalidate the fault index
+    geode::uuid fault_id;
+    for( const auto& fault : model.faults() )
+    {
+        if( !model.fault_index().items( fault.id() ).empty() )
+        {
+            fault_id = fault.id();
+            break;
+        }
+    }
+    const auto nb_fault_items = model.fault_index().items( fault_id ).size();
+    const auto removed_item = model.fault_index().items( fault_id ).front();
+    geode::BRepBuilder brep_builder{ model };
+    brep_builder.remove_relation( removed_item, fault_id );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        model.fault_index().items( fault_id ).size() == nb_fault_items - 1,
+        "Fault index should be updated after removing a relation" );
+    builder.add_item_in_collection(
+        model.surface( removed_item ).component_id(),
+        model.fault( fault_id ).component_id() );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        model.fault_index().items( fault_id ).size() == nb_fault_items,
+        "Fault index should be updated after adding an item" );
+    builder.remove_surface( model.surface( removed_item ) );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        model.fault_index().collections( removed_item ).empty(),
+        "Fault index should be updated after removing a surface" );
 }
 
 geode::BRep build_brep()
@@ -396,6 +498,45 @@ geode::BRep build_brep()
     return brep;
 }
 
+void test_bulk_relations()
+{
+    geode::StructuralModel model{ build_brep() };
+    geode::StructuralModelBuilder builder( model );
+    const auto& horizon_id = builder.add_horizon();
+    std::vector< geode::uuid > surface_ids;
+    for( const auto& surface : model.surfaces() )
+    {
+        surface_ids.push_back( surface.id() );
+    }
+    surface_ids.push_back( surface_ids.front() );
+    builder.add_surfaces_in_horizon(
+        surface_ids, model.horizon( horizon_id ) );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        count_items( model.horizon_items( model.horizon( horizon_id ) ) )
+            == model.nb_surfaces(),
+        "Bulk insertion should add each surface once in the horizon" );
+    builder.add_surfaces_in_horizon(
+        surface_ids, model.horizon( horizon_id ) );
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        model.horizon_index().items( horizon_id ).size()
+            == model.nb_surfaces(),
+        "Bulk insertion should skip surfaces already in the horizon" );
+    bool invalid_item_rejected{ false };
+    try
+    {
+        const std::array< geode::uuid, 1 > wrong_ids{ horizon_id };
+        builder.add_surfaces_in_horizon(
+            wrong_ids, model.horizon( horizon_id ) );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        invalid_item_rejected = true;
+    }
+    geode::OpenGeodeGeosciencesExplicitException::test(
+        invalid_item_rejected,
+        "Bulk insertion should reject items that are not surfaces" );
+}
+
 int main()
 {
     try
@@ -411,6 +552,7 @@ int main()
         test_io( model );
         test_copy( model );
         modify_model( model, builder );
+        test_bulk_relations();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
@@ -21,10 +21,13 @@
  *
  */
 
+#include <stdexcept>
+
 #include <geode/tests_config.hpp>
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/range.hpp>
 
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
 #include <geode/geosciences/implicit/representation/core/detail/helpers.hpp>
@@ -134,6 +137,76 @@ void test_horizons_stack()
         absl::StrCat( geode::DATA_PATH, "test_HorizonStack_v0.og_hst3d" ) );
 }
 
+void test_horizons_stack_batch_edition()
+{
+    std::array< std::string, 2 > horizons_list{ "h0", "h1" };
+    std::array< std::string, 3 > units_list{ "su0", "su1", "su2" };
+    auto horizons_stack =
+        geode::detail::horizons_stack_from_bottom_to_top_names< 3 >(
+            horizons_list, units_list );
+    geode::HorizonsStackBuilder3D stack_builder{ horizons_stack };
+    const auto h0 =
+        geode::detail::horizon_id_from_name( horizons_stack, "h0" ).value();
+    const auto h1 =
+        geode::detail::horizon_id_from_name( horizons_stack, "h1" ).value();
+    auto unit_id = horizons_stack.above( h0 ).value();
+    std::vector< geode::uuid > new_horizons;
+    {
+        geode::HorizonsStackBatchEdition3D batch_edition{ stack_builder };
+        for( const auto i : geode::Range{ 3 } )
+        {
+            geode_unused( i );
+            const auto info = stack_builder.add_horizon_in_stratigraphic_unit(
+                horizons_stack.stratigraphic_unit( unit_id ) );
+            new_horizons.push_back( info.new_horizon_id );
+            unit_id = info.strati_unit_above_id;
+        }
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        horizons_stack.nb_horizons() == 5,
+        "Horizons Stack should have 5 horizons after batch edition." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        horizons_stack.nb_stratigraphic_units() == 6,
+        "Horizons Stack should have 6 Stratigraphic Units after batch "
+        "edition." );
+    auto current = h0;
+    for( const auto& new_horizon : new_horizons )
+    {
+        const auto unit = horizons_stack.above( current ).value();
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            horizons_stack.under( unit ).value() == current,
+            "Unit above a horizon should have it under." );
+        current = horizons_stack.above( unit ).value();
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            current == new_horizon,
+            "Inserted horizons should be stacked in insertion order." );
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        horizons_stack.above( horizons_stack.above( current ).value() ).value()
+            == h1,
+        "Horizon 1 should be above the last inserted horizon." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        horizons_stack.bottom_horizon().value() == h0
+            && horizons_stack.top_horizon().value() == h1,
+        "Top and bottom horizons should be unchanged by batch edition." );
+    const auto bottom_unit = horizons_stack.under( h0 ).value();
+    geode::uuid new_bottom;
+    try
+    {
+        geode::HorizonsStackBatchEdition3D batch_edition{ stack_builder };
+        new_bottom = stack_builder.add_horizon();
+        stack_builder.set_horizon_under( horizons_stack.horizon( new_bottom ),
+            horizons_stack.stratigraphic_unit( bottom_unit ) );
+        throw std::runtime_error{ "Interrupted batch edition" };
+    }
+    catch( const std::runtime_error& /*unused*/ )
+    {
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        horizons_stack.bottom_horizon().value() == new_bottom,
+        "Batch edition should be ended when leaving its scope." );
+}
+
 void test_horizons_stack( const geode::HorizonsStack2D& horizons_stack )
 {
     std::array< std::string, 4 > horizons_list{ "h1", "h2", "h3", "h4" };
@@ -247,6 +320,7 @@ int main()
         test_horizons_stack();
         test_create_horizons_stack_bottom_to_top();
         test_create_horizons_stack_top_to_bottom();
+        test_horizons_stack_batch_edition();
 
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
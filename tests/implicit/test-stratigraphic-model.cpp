@@ -21,30 +21,63 @@
  *
  */
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <absl/algorithm/container.h>
+
 #include <geode/tests_config.hpp>
 
 #include <geode/basic/assert.hpp>
 #include <geode/basic/attribute_manager.hpp>
 #include <geode/basic/logger.hpp>
+#include <geode/basic/variable_attribute.hpp>
 
+#include <geode/geometry/basic_objects/plane.hpp>
+#include <geode/geometry/basic_objects/tetrahedron.hpp>
 #include <geode/geometry/bounding_box.hpp>
+#include <geode/geometry/mensuration.hpp>
 #include <geode/geometry/point.hpp>
 
+#include <geode/mesh/builder/tetrahedral_solid_builder.hpp>
+#include <geode/mesh/core/geode/geode_tetrahedral_solid.hpp>
 #include <geode/mesh/core/tetrahedral_solid.hpp>
 #include <geode/mesh/core/triangulated_surface.hpp>
+#include <geode/mesh/io/tetrahedral_solid_input.hpp>
 #include <geode/mesh/io/triangulated_surface_output.hpp>
 
 #include <geode/model/mixin/core/block.hpp>
 #include <geode/model/mixin/core/surface.hpp>
 
+#include <geode/geosciences/explicit/representation/io/geode/geode_archive.hpp>
 #include <geode/geosciences/explicit/representation/io/structural_model_input.hpp>
 #include <geode/geosciences/implicit/geometry/stratigraphic_point.hpp>
+#include <geode/geosciences/implicit/representation/builder/helpers/stratigraphic_attribute_transfer.hpp>
+#include <geode/geosciences/implicit/representation/builder/helpers/stratigraphic_model_slicer.hpp>
 #include <geode/geosciences/implicit/representation/builder/horizons_stack_builder.hpp>
+#include <geode/geosciences/implicit/representation/builder/implicit_structural_model_builder.hpp>
 #include <geode/geosciences/implicit/representation/builder/stratigraphic_model_builder.hpp>
+#include <geode/geosciences/implicit/representation/core/detail/helpers.hpp>
 #include <geode/geosciences/implicit/representation/core/horizons_stack.hpp>
+#include <geode/geosciences/implicit/representation/core/implicit_structural_model.hpp>
+#include <geode/geosciences/implicit/representation/core/instrumentation.hpp>
 #include <geode/geosciences/implicit/representation/core/stratigraphic_model.hpp>
+#include <geode/geosciences/implicit/representation/core/stratigraphic_section.hpp>
+#include <geode/geosciences/implicit/representation/core/volumetrics.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_fields.hpp>
+#include <geode/geosciences/implicit/representation/io/detail/implicit_model_query_trees.hpp>
+#include <geode/geosciences/implicit/representation/io/geode/geode_implicit_structural_model_output.hpp>
+#include <geode/geosciences/implicit/representation/io/geode/geode_stratigraphic_model_output.hpp>
 #include <geode/geosciences/implicit/representation/io/implicit_structural_model_input.hpp>
 #include <geode/geosciences/implicit/representation/io/implicit_structural_model_output.hpp>
+#include <geode/geosciences/implicit/representation/io/model_cache.hpp>
+#include <geode/geosciences/implicit/representation/io/stratigraphic_model_input.hpp>
 
 void add_horizons_stack_to_model(
     geode::StratigraphicModel& model, const geode::uuid& block1_id )
@@ -200,6 +233,523 @@ void test_copy(
     }
 }
 
+void test_implicit_value_transform(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    auto transformed_model = model.clone();
+    const auto& block = transformed_model.block( block1_id );
+    const auto initial_value = transformed_model.implicit_value( block, 59 );
+    geode::StratigraphicModelBuilder builder{ transformed_model };
+    builder.set_implicit_value_transform( 2, 1 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( transformed_model.implicit_value( block, 59 )
+                   - ( 2 * initial_value + 1 ) )
+            < geode::GLOBAL_EPSILON,
+        "Wrong implicit value after setting implicit value transform." );
+    const auto stratigraphic_bbox =
+        transformed_model.stratigraphic_bounding_box();
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( stratigraphic_bbox.max().value( 2 ) - 3 )
+            < geode::GLOBAL_EPSILON,
+        "Wrong stratigraphic bounding box after setting implicit value "
+        "transform." );
+    builder.bake_implicit_value_transform();
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        transformed_model.implicit_value_scale() == 1
+            && transformed_model.implicit_value_offset() == 0,
+        "Implicit value transform should be reset after bake." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( transformed_model.implicit_value( block, 59 )
+                   - ( 2 * initial_value + 1 ) )
+            < geode::GLOBAL_EPSILON,
+        "Wrong implicit value after baking implicit value transform." );
+    const auto attribute_ids =
+        block.mesh().vertex_attribute_manager().attribute_ids_matching_name(
+            geode::ImplicitStructuralModel::IMPLICIT_ATTRIBUTE_NAME );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        attribute_ids
+            && absl::c_linear_search( attribute_ids.value(),
+                transformed_model.implicit_attribute_id() ),
+        "Implicit values should keep their attribute name." );
+    const auto attribute =
+        block.mesh()
+            .vertex_attribute_manager()
+            .find_read_only_attribute<
+                geode::ImplicitStructuralModel::implicit_attribute_type >(
+                transformed_model.implicit_attribute_id() );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( attribute->value( 59 ) - ( 2 * initial_value + 1 ) )
+            < geode::GLOBAL_EPSILON,
+        "Baked implicit attribute should hold the implicit values." );
+}
+
+void test_single_precision_storage(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    auto single_precision_model = model.clone();
+    const auto& block = single_precision_model.block( block1_id );
+    geode::StratigraphicModelBuilder builder{ single_precision_model };
+    builder.set_implicit_value( block, 59, 0.25 );
+    builder.set_implicit_value_precision(
+        geode::ImplicitStructuralModel::STORAGE_PRECISION::single_precision );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        single_precision_model.implicit_value_precision()
+            == geode::ImplicitStructuralModel::STORAGE_PRECISION::
+                single_precision,
+        "Implicit values should be stored in single precision." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        single_precision_model.implicit_value( block, 59 ) == 0.25,
+        "Wrong implicit value after conversion to single precision." );
+    builder.set_implicit_value( block, 59, 0.1 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( single_precision_model.implicit_value( block, 59 ) - 0.1 )
+            < 1e-7,
+        "Wrong implicit value set in single precision." );
+    const auto filename = "test_implicit_model_single_precision.og_istrm";
+    geode::save_implicit_structural_model( single_precision_model, filename );
+    const auto reloaded_model =
+        geode::load_implicit_structural_model( filename );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.implicit_value_precision()
+            == geode::ImplicitStructuralModel::STORAGE_PRECISION::
+                single_precision,
+        "Implicit value precision should be saved." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.implicit_value( reloaded_model.block( block1_id ), 59 )
+            == single_precision_model.implicit_value( block, 59 ),
+        "Wrong implicit value after reloading single precision model." );
+}
+
+void test_stored_value_changes(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    auto changed_model = model.clone();
+    const auto& block = changed_model.block( block1_id );
+    geode::StratigraphicModelBuilder builder{ changed_model };
+    builder.set_interleaved_stratigraphic_coordinates( true );
+    builder.set_implicit_value( block, 59, 0.1 );
+    const auto initial_bbox = changed_model.stratigraphic_bounding_box();
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        changed_model.interleaved_stratigraphic_coordinates( block )[59]
+                .implicit_value()
+            == 0.1,
+        "Wrong interleaved implicit value before precision change." );
+    builder.set_implicit_value_precision(
+        geode::ImplicitStructuralModel::STORAGE_PRECISION::single_precision );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        changed_model.interleaved_stratigraphic_coordinates( block )[59]
+                .implicit_value()
+            == changed_model.implicit_value( block, 59 ),
+        "Interleaved implicit values should follow precision change." );
+    std::vector< double > values( block.mesh().nb_vertices() );
+    for( const auto v : geode::Range{ block.mesh().nb_vertices() } )
+    {
+        values[v] = 2 * changed_model.stored_implicit_value( block, v ) + 10;
+    }
+    builder.set_block_stored_implicit_values( block, values );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        changed_model.interleaved_stratigraphic_coordinates( block )[59]
+                .implicit_value()
+            == changed_model.implicit_value( block, 59 ),
+        "Interleaved implicit values should follow stored value changes." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        changed_model.stratigraphic_bounding_box().max().value( 2 )
+            > initial_bbox.max().value( 2 ),
+        "Stratigraphic bounding box should follow stored value changes." );
+}
+
+void test_interleaved_coordinates(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    auto interleaved_model = model.clone();
+    const auto& block = interleaved_model.block( block1_id );
+    geode::StratigraphicModelBuilder builder{ interleaved_model };
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        interleaved_model.interleaved_stratigraphic_coordinates( block )
+            .empty(),
+        "Interleaved store should not be built when disabled." );
+    builder.set_interleaved_stratigraphic_coordinates( true );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        interleaved_model.uses_interleaved_stratigraphic_coordinates(),
+        "Model should use interleaved stratigraphic coordinates." );
+    test_model( interleaved_model, block1_id );
+    const auto coordinates =
+        interleaved_model.interleaved_stratigraphic_coordinates( block );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        coordinates.size() == block.mesh().nb_vertices(),
+        "Wrong number of interleaved stratigraphic coordinates." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        coordinates[59].stratigraphic_coordinates().inexact_equal(
+            interleaved_model.stratigraphic_coordinates( block, 59 )
+                .stratigraphic_coordinates() ),
+        "Wrong interleaved stratigraphic coordinates for vertex 59." );
+    builder.set_stratigraphic_coordinates( block, 59,
+        geode::StratigraphicPoint3D{ geode::Point2D{ { 0.5, 0.25 } }, 0.75 } );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        interleaved_model.interleaved_stratigraphic_coordinates( block )[59]
+            .stratigraphic_coordinates()
+            .inexact_equal( geode::Point3D{ { 0.5, 0.25, 0.75 } } ),
+        "Interleaved stratigraphic coordinates should follow vertex "
+        "modifications." );
+    builder.set_interleaved_stratigraphic_coordinates( false );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        interleaved_model.interleaved_stratigraphic_coordinates( block )
+            .empty(),
+        "Interleaved store should be released when disabled." );
+}
+
+void test_attribute_transfer(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::StratigraphicModel source;
+    geode::StratigraphicModelBuilder source_builder{ source };
+    const auto mappings = source_builder.copy( model );
+    const auto& source_block_id =
+        mappings.at( geode::Block3D::component_type_static() )
+            .in2out( block1_id );
+    for( const auto& block : source.blocks() )
+    {
+        const auto& mesh = block.mesh();
+        auto& manager = mesh.vertex_attribute_manager();
+        geode::AttributeValues< double > default_values;
+        default_values.default_value = 0;
+        default_values.no_value = 0;
+        const auto attribute_id =
+            manager.create_attribute< geode::VariableAttribute, double >(
+                "test_property", default_values, {} );
+        auto attribute =
+            manager.find_attribute< geode::VariableAttribute, double >(
+                attribute_id );
+        for( const auto v : geode::Range{ mesh.nb_vertices() } )
+        {
+            attribute->set_value( v, mesh.point( v ).value( 0 ) );
+        }
+    }
+    geode::StratigraphicModel target;
+    geode::StratigraphicModelBuilder{ target }.copy( source );
+    const std::array< std::string, 1 > names{ "test_property" };
+    const auto result =
+        geode::transfer_attributes_through_stratigraphic_space(
+            source, target, names );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        result.nb_mapped_vertices > 0,
+        "Attribute transfer should map target vertices." );
+    const auto& block = target.block( source_block_id );
+    const auto& manager = block.mesh().vertex_attribute_manager();
+    const auto attribute = manager.find_read_only_attribute< double >(
+        manager.attribute_ids_matching_name( "test_property" )
+            .value()
+            .front() );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs(
+            attribute->value( 59 ) - block.mesh().point( 59 ).value( 0 ) )
+            < 1e-6,
+        "Wrong attribute value transferred through stratigraphic space." );
+}
+
+void test_slice(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    const auto& block = model.block( block1_id );
+    const auto center = model.bounding_box().center();
+    const geode::Plane plane{ geode::Vector3D{ { 1, 0, 0 } }, center };
+    const auto section = geode::slice_stratigraphic_model( model, plane );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        section.nb_surfaces() > 0, "Slice should contain surfaces." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        section.nb_horizons() == model.nb_horizons(),
+        "Slice should contain the model horizons." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        section.horizons_stack().nb_horizons()
+            == model.horizons_stack().nb_horizons(),
+        "Slice should contain the model horizons stack." );
+    for( const auto& surface : section.surfaces() )
+    {
+        const auto& mesh = surface.mesh();
+        for( const auto p : geode::Range{ mesh.nb_polygons() } )
+        {
+            const auto point = mesh.polygon_barycenter( p );
+            const geode::Point3D point3d{ { center.value( 0 ),
+                center.value( 1 ) + point.value( 0 ),
+                center.value( 2 ) + point.value( 1 ) } };
+            const auto tetrahedron =
+                model.containing_polyhedron( block, point3d );
+            if( !tetrahedron )
+            {
+                continue;
+            }
+            const auto section_value =
+                section.implicit_value( surface, point );
+            geode::OpenGeodeGeosciencesImplicitException::test(
+                section_value.has_value()
+                    && std::fabs( section_value.value()
+                                  - model.implicit_value(
+                                      block, point3d, tetrahedron.value() ) )
+                           < 1e-6,
+                "Wrong implicit value interpolated on slice." );
+            return;
+        }
+    }
+}
+
+void test_stratigraphic_columns(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    const auto& block = model.block( block1_id );
+    const auto& point = block.mesh().point( 59 );
+    const auto bbox = model.bounding_box();
+    const std::array< geode::Point2D, 2 > locations{
+        geode::Point2D{ { point.value( 0 ), point.value( 1 ) } },
+        geode::Point2D{ { bbox.max().value( 0 ) + 1,
+            bbox.max().value( 1 ) + 1 } }
+    };
+    const auto columns = model.stratigraphic_columns( locations );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        columns.nb_columns() == 2, "Wrong number of stratigraphic columns." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        columns.column( 1 ).empty(),
+        "Column outside the model should be empty." );
+    const auto column = columns.column( 0 );
+    for( const auto i : geode::Indices{ column } )
+    {
+        const auto& interval = column[i];
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            interval.thickness() > 0,
+            "Wrong stratigraphic interval thickness." );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            i == 0
+                || column[i - 1].bottom
+                       >= interval.top - geode::GLOBAL_EPSILON,
+            "Stratigraphic intervals should be sorted from top to bottom." );
+        const geode::Point3D middle{ { point.value( 0 ), point.value( 1 ),
+            ( interval.top + interval.bottom ) / 2. } };
+        if( const auto value = model.implicit_value( block, middle ) )
+        {
+            geode::OpenGeodeGeosciencesImplicitException::test(
+                model.containing_stratigraphic_unit( value.value() )
+                    == interval.stratigraphic_unit,
+                "Wrong stratigraphic unit in column interval." );
+        }
+    }
+    const auto unit = model.containing_stratigraphic_unit(
+        model.implicit_value( block, 59 ) );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !unit
+            || absl::c_any_of(
+                column, [&unit]( const geode::StratigraphicColumnInterval&
+                                     interval ) {
+                    return interval.stratigraphic_unit == unit.value();
+                } ),
+        "Column should cross the unit of its location." );
+}
+
+void test_stratigraphic_unit_labels(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    auto labelled_model = model.clone();
+    const auto& block = labelled_model.block( block1_id );
+    const auto& mesh = block.mesh< geode::TetrahedralSolid3D >();
+    geode::StratigraphicModelBuilder builder{ labelled_model };
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !labelled_model.has_stratigraphic_unit_labels(),
+        "Labels should not be computed by default." );
+    builder.compute_stratigraphic_unit_labels();
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        labelled_model.has_stratigraphic_unit_labels(),
+        "Labels should be computed." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        labelled_model.stratigraphic_unit_label_table().size()
+            == labelled_model.horizons_stack().nb_horizons() + 1,
+        "Wrong size of stratigraphic unit label table." );
+    for( const auto tetrahedron : geode::Range{ mesh.nb_polyhedra() } )
+    {
+        double value{ 0 };
+        double min_value{ std::numeric_limits< double >::max() };
+        double max_value{ std::numeric_limits< double >::lowest() };
+        for( const auto v : geode::LRange{ 4 } )
+        {
+            const auto vertex_value = labelled_model.implicit_value(
+                block, mesh.polyhedron_vertex( { tetrahedron, v } ) );
+            value += vertex_value / 4.;
+            min_value = std::min( min_value, vertex_value );
+            max_value = std::max( max_value, vertex_value );
+        }
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            labelled_model.tetrahedron_stratigraphic_unit( block, tetrahedron )
+                == labelled_model.containing_stratigraphic_unit( value ),
+            "Wrong stratigraphic unit label of tetrahedron ", tetrahedron );
+        if( labelled_model.is_cut_by_horizon( block, tetrahedron ) )
+        {
+            geode::OpenGeodeGeosciencesImplicitException::test(
+                labelled_model.containing_stratigraphic_unit( min_value )
+                    != labelled_model.containing_stratigraphic_unit(
+                        max_value ),
+                "Tetrahedron ", tetrahedron,
+                " should not be cut by a horizon." );
+        }
+        else
+        {
+            geode::OpenGeodeGeosciencesImplicitException::test(
+                labelled_model.containing_stratigraphic_unit( min_value )
+                    == labelled_model.containing_stratigraphic_unit(
+                        max_value ),
+                "Tetrahedron ", tetrahedron, " should be cut by a horizon." );
+        }
+    }
+    const auto& horizon = *labelled_model.horizons_stack().horizons().begin();
+    builder.set_horizon_implicit_value( horizon,
+        labelled_model.horizon_implicit_value( horizon ).value() );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !labelled_model.has_stratigraphic_unit_labels(),
+        "Labels should be invalidated by isovalue modification." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !mesh.polyhedron_attribute_manager().attribute_ids_matching_name(
+            geode::ImplicitStructuralModel::
+                STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME ),
+        "Invalidated labels should be removed from the block mesh." );
+    builder.compute_stratigraphic_unit_labels();
+    builder.block_mesh_builder< geode::TetrahedralSolid3D >( block1_id )
+        ->create_tetrahedron( { 0, 1, 2, 3 } );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !labelled_model.has_stratigraphic_unit_labels(),
+        "Labels should be out of date after a block mesh edit." );
+    builder.notify_block_mesh_change( block );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !labelled_model.has_stratigraphic_unit_labels()
+            && !mesh.polyhedron_attribute_manager()
+                    .attribute_ids_matching_name(
+                        geode::ImplicitStructuralModel::
+                            STRATIGRAPHIC_UNIT_LABEL_ATTRIBUTE_NAME ),
+        "Notified block mesh edit should remove the labels from the block "
+        "mesh." );
+}
+
+void test_single_tetrahedron_volumetrics()
+{
+    geode::ImplicitStructuralModel model;
+    geode::ImplicitStructuralModelBuilder builder{ model };
+    const auto block_id = builder.add_block(
+        geode::OpenGeodeTetrahedralSolid3D::impl_name_static() );
+    auto mesh_builder =
+        builder.block_mesh_builder< geode::TetrahedralSolid3D >( block_id );
+    mesh_builder->create_point( geode::Point3D{ { 0, 0, 0 } } );
+    mesh_builder->create_point( geode::Point3D{ { 1, 0, 0 } } );
+    mesh_builder->create_point( geode::Point3D{ { 0, 1, 0 } } );
+    mesh_builder->create_point( geode::Point3D{ { 0, 0, 1 } } );
+    mesh_builder->create_tetrahedron( { 0, 1, 2, 3 } );
+    builder.reinitialize_implicit_query_trees();
+    const auto& block = model.block( block_id );
+    const std::array< double, 4 > values{ 0, 0, 0, 1 };
+    builder.set_block_stored_implicit_values( block, values );
+
+    auto stack_builder = builder.horizons_stack_builder();
+    const auto bottom_id = stack_builder.add_horizon();
+    const auto top_id = stack_builder.add_horizon();
+    const auto unit_id = stack_builder.add_stratigraphic_unit();
+    const auto& stack = model.horizons_stack();
+    stack_builder.set_horizon_under(
+        stack.horizon( bottom_id ), stack.stratigraphic_unit( unit_id ) );
+    stack_builder.set_horizon_above(
+        stack.horizon( top_id ), stack.stratigraphic_unit( unit_id ) );
+    builder.set_horizon_implicit_value( stack.horizon( bottom_id ), 0.25 );
+    builder.set_horizon_implicit_value( stack.horizon( top_id ), 0.5 );
+
+    // The implicit value is z: the part of the unit tetrahedron above the
+    // plane z = t has volume (1 - t)^3 / 6
+    const auto unit_volume = ( 0.75 * 0.75 * 0.75 - 0.5 * 0.5 * 0.5 ) / 6.;
+    for( const auto labelled : { false, true } )
+    {
+        if( labelled )
+        {
+            builder.compute_stratigraphic_unit_labels();
+        }
+        const auto volumetrics = geode::implicit_model_volumetrics( model );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            std::fabs( volumetrics.block_volumes.at( block_id ) - 1. / 6. )
+                < 1e-12,
+            "Wrong single tetrahedron block volume." );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            volumetrics.stratigraphic_unit_volumes.size() == 1,
+            "Only the bounded unit should have a volume." );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            std::fabs( volumetrics.stratigraphic_unit_volumes.at( unit_id )
+                       - unit_volume )
+                < 1e-12,
+            "Wrong single tetrahedron unit volume." );
+    }
+}
+
+void test_volumetrics(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    const auto volumetrics = geode::implicit_model_volumetrics( model );
+    const auto& block = model.block( block1_id );
+    const auto& mesh = block.mesh< geode::TetrahedralSolid3D >();
+    double block_volume{ 0 };
+    for( const auto tetrahedron : geode::Range{ mesh.nb_polyhedra() } )
+    {
+        block_volume += std::fabs(
+            geode::tetrahedron_volume( mesh.tetrahedron( tetrahedron ) ) );
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( volumetrics.block_volumes.at( block1_id ) - block_volume )
+            < 1e-6 * block_volume,
+        "Wrong block volume." );
+    double units_volume{ 0 };
+    for( const auto& [unit, volume] :
+        volumetrics.block_stratigraphic_unit_volumes.at( block1_id ) )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            volume >= 0, "Unit volume should be positive." );
+        units_volume += volume;
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        units_volume > 0 && units_volume <= block_volume * ( 1 + 1e-6 ),
+        "Wrong unit volumes in block." );
+
+    auto labelled_model = model.clone();
+    geode::StratigraphicModelBuilder{ labelled_model }
+        .compute_stratigraphic_unit_labels();
+    const auto labelled_volumetrics =
+        geode::implicit_model_volumetrics( labelled_model );
+    for( const auto& [unit, volume] : volumetrics.stratigraphic_unit_volumes )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            std::fabs(
+                labelled_volumetrics.stratigraphic_unit_volumes.at( unit )
+                - volume )
+                < 1e-6 * block_volume,
+            "Unit volumes should not depend on labels." );
+    }
+
+    const auto bbox = model.bounding_box();
+    std::vector< geode::Point2D > locations;
+    for( const auto i : geode::LRange{ 10 } )
+    {
+        for( const auto j : geode::LRange{ 10 } )
+        {
+            locations.emplace_back( std::array< double, 2 >{
+                bbox.min().value( 0 )
+                    + ( i + 0.5 )
+                          * ( bbox.max().value( 0 ) - bbox.min().value( 0 ) )
+                          / 10.,
+                bbox.min().value( 1 )
+                    + ( j + 0.5 )
+                          * ( bbox.max().value( 1 ) - bbox.min().value( 1 ) )
+                          / 10. } );
+        }
+    }
+    for( const auto& [unit, statistics] :
+        geode::stratigraphic_unit_thickness_statistics( model, locations ) )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            statistics.nb_columns > 0 && statistics.min <= statistics.mean
+                && statistics.mean <= statistics.max
+                && statistics.standard_deviation >= 0,
+            "Wrong thickness statistics of unit ", unit.string() );
+    }
+}
+
 void test_save_stratigraphic_surfaces( const geode::StratigraphicModel& model )
 {
     geode::index_t counter{ 0 };
@@ -239,6 +789,73 @@ void test_save_stratigraphic_surfaces( const geode::StratigraphicModel& model )
     }
 }
 
+void test_save_stratigraphic_blocks( const geode::StratigraphicModel& model )
+{
+    geode::Logger::info( "Testing save stratigraphic blocks" );
+    const auto& block = *model.blocks().begin();
+    const auto& mesh = block.mesh();
+    geode::detail::save_stratigraphic_blocks( model, "test_strati_block_" );
+    for( const auto b : geode::Range{ model.nb_blocks() } )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            std::filesystem::exists(
+                absl::StrCat( "test_strati_block_", b, ".og_tso3d" ) ),
+            "Stratigraphic block ", b, " should have been saved." );
+    }
+    const auto strati_mesh =
+        geode::load_tetrahedral_solid< 3 >( "test_strati_block_0.og_tso3d" );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        strati_mesh->nb_vertices() == mesh.nb_vertices()
+            && strati_mesh->nb_polyhedra() == mesh.nb_polyhedra(),
+        "Wrong stratigraphic block size." );
+    for( const auto p : geode::Range{ mesh.nb_polyhedra() } )
+    {
+        for( const auto f : geode::LRange{ 4 } )
+        {
+            geode::OpenGeodeGeosciencesImplicitException::test(
+                strati_mesh->polyhedron_vertex( { p, f } )
+                        == mesh.polyhedron_vertex( { p, f } )
+                    && strati_mesh->polyhedron_adjacent( { p, f } )
+                           == mesh.polyhedron_adjacent( { p, f } ),
+                "Wrong stratigraphic block topology." );
+        }
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        strati_mesh->point( 0 )
+            == model.stratigraphic_coordinates( block, 0 )
+                   .stratigraphic_coordinates(),
+        "Wrong stratigraphic block point." );
+}
+
+void test_stratigraphic_surfaces( const geode::StratigraphicModel& model )
+{
+    for( const auto& block : model.blocks() )
+    {
+        const auto strati_surfaces = model.stratigraphic_surfaces( block );
+        for( const auto& [surface_id, batch_surfaces] : strati_surfaces )
+        {
+            const auto single_surfaces = model.stratigraphic_surface(
+                block, model.surface( surface_id ) );
+            geode::OpenGeodeGeosciencesImplicitException::test(
+                batch_surfaces.size() == single_surfaces.size(),
+                "Wrong number of stratigraphic surfaces for surface ",
+                surface_id.string() );
+            for( const auto side : geode::Indices{ batch_surfaces } )
+            {
+                for( const auto v :
+                    geode::Range{ batch_surfaces[side]->nb_vertices() } )
+                {
+                    geode::OpenGeodeGeosciencesImplicitException::test(
+                        batch_surfaces[side]->point( v ).inexact_equal(
+                            single_surfaces[side]->point( v ) ),
+                        "Wrong stratigraphic point ", v, " for surface ",
+                        surface_id.string() );
+                }
+            }
+        }
+    }
+}
+
 void test_io(
     const geode::StratigraphicModel& model, const geode::uuid& block1_id )
 {
@@ -252,9 +869,354 @@ void test_io(
     builder.reinitialize_stratigraphic_query_trees();
     builder.import_old_stratigraphic_attribute_values_from_attribute_name(
         geode::StratigraphicModel::STRATIGRAPHIC_LOCATION_ATTRIBUTE_NAME );
+    model_reload.compute_stratigraphic_query_trees();
+    for( const auto& block : model_reload.blocks() )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            model_reload.has_implicit_query_tree( block )
+                && model_reload.has_stratigraphic_query_tree( block ),
+            "Every block query tree should be built." );
+    }
+    const auto lazy_model = model_reload.clone();
+    const auto& block = model_reload.block( block1_id );
+    const auto& lazy_block = lazy_model.block( block1_id );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !lazy_model.has_implicit_query_tree( lazy_block )
+            && !lazy_model.has_stratigraphic_query_tree( lazy_block ),
+        "Cloned model query trees should be built lazily." );
+    const auto& mesh = block.mesh();
+    for( geode::index_t p = 0; p < mesh.nb_polyhedra(); p += 7 )
+    {
+        const auto barycenter = mesh.polyhedron_barycenter( p );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            model_reload.containing_polyhedron( block, barycenter )
+                == lazy_model.containing_polyhedron( lazy_block, barycenter ),
+            "Parallel and lazy query trees should give the same containing "
+            "polyhedron." );
+        geode::Point3D strati_sum;
+        for( const auto v : geode::LRange{ 4 } )
+        {
+            strati_sum += model_reload
+                              .stratigraphic_coordinates(
+                                  block, mesh.polyhedron_vertex( { p, v } ) )
+                              .stratigraphic_coordinates();
+        }
+        const geode::StratigraphicPoint3D strati_barycenter{ strati_sum / 4. };
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            model_reload.stratigraphic_containing_polyhedron(
+                block, strati_barycenter )
+                == lazy_model.stratigraphic_containing_polyhedron(
+                    lazy_block, strati_barycenter ),
+            "Parallel and lazy stratigraphic query trees should give the same "
+            "containing polyhedron." );
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        lazy_model.has_implicit_query_tree( lazy_block )
+            && lazy_model.has_stratigraphic_query_tree( lazy_block ),
+        "Queries should build the lazy query trees." );
     test_model( model_reload, block1_id );
 }
 
+void test_archive_modes(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::Logger::info( "Testing archive modes" );
+    const auto& block = model.block( block1_id );
+    geode::GeodeArchiveOptions stored;
+    stored.set_archive_mode( geode::ARCHIVE_MODE::stored );
+    geode::GeodeArchiveOptions fast;
+    fast.set_compression_level( 1 );
+    geode::GeodeArchiveOptions directory;
+    directory.set_archive_mode( geode::ARCHIVE_MODE::directory );
+    for( const auto& [options, filename] :
+        { std::make_pair( stored, "test_implicit_model_stored.og_istrm" ),
+            std::make_pair( fast, "test_implicit_model_fast.og_istrm" ),
+            std::make_pair(
+                directory, "test_implicit_model_directory.og_istrm" ) } )
+    {
+        // Writing twice replaces the archive written the first time
+        geode::save_implicit_structural_model( model, filename, options );
+        geode::save_implicit_structural_model( model, filename, options );
+        const auto reloaded_model =
+            geode::load_implicit_structural_model( filename );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            reloaded_model.nb_blocks() == model.nb_blocks()
+                && std::fabs(
+                       reloaded_model.implicit_value(
+                           reloaded_model.block( block1_id ), 59 )
+                       - model.implicit_value( block, 59 ) )
+                       < geode::GLOBAL_EPSILON,
+            "Model should be reloaded from every archive mode." );
+    }
+    const std::filesystem::path user_directory{
+        "test_implicit_model_user_directory.og_istrm"
+    };
+    std::filesystem::create_directories( user_directory );
+    std::ofstream{ user_directory / "user_file.txt" } << "user data";
+    bool replaced{ true };
+    try
+    {
+        geode::save_implicit_structural_model(
+            model, user_directory.string(), directory );
+    }
+    catch( const geode::OpenGeodeException& )
+    {
+        replaced = false;
+    }
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !replaced
+            && std::filesystem::exists( user_directory / "user_file.txt" ),
+        "Directory mode should not replace a directory it did not write." );
+    std::filesystem::remove_all( user_directory );
+}
+
+void test_query_trees_io(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::Logger::info( "Testing query trees IO" );
+    geode::detail::save_implicit_model_query_trees( model, "." );
+    auto reloaded_model = model.clone();
+    const auto nb_loaded =
+        geode::detail::load_implicit_model_query_trees( reloaded_model, "." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        nb_loaded == 2 * model.nb_blocks(),
+        "Every block implicit and stratigraphic boxes should be loaded." );
+    const auto& block = reloaded_model.block( block1_id );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !reloaded_model.has_implicit_query_tree( block )
+            && !reloaded_model.has_stratigraphic_query_tree( block ),
+        "Loaded query trees should only be built on first query." );
+    const auto& initial_block = model.block( block1_id );
+    const auto& point = block.mesh().point( 59 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.containing_polyhedron( block, point )
+            == model.containing_polyhedron( initial_block, point ),
+        "Loaded query tree should give the same containing polyhedron." );
+    const auto strati_point =
+        model.stratigraphic_coordinates( initial_block, 59 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.stratigraphic_containing_polyhedron(
+            block, strati_point )
+            == model.stratigraphic_containing_polyhedron(
+                initial_block, strati_point ),
+        "Loaded stratigraphic query tree should give the same "
+        "stratigraphic containing polyhedron." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.has_implicit_query_tree( block )
+            && reloaded_model.has_stratigraphic_query_tree( block ),
+        "Query trees should be built after the first queries." );
+}
+
+void test_incremental_io(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::Logger::info( "Testing incremental IO" );
+    const auto filename = "test_implicit_model_update.og_istrm";
+    geode::OpenGeodeImplicitStructuralModelOutput output{ filename };
+    output.set_update_fingerprint( true );
+    output.write( model );
+    const auto written_size = std::filesystem::file_size( filename );
+    auto updated_model = model.clone();
+    const auto& block = updated_model.block( block1_id );
+    geode::StratigraphicModelBuilder builder{ updated_model };
+    builder.set_implicit_value_transform( 2, 1 );
+    builder.set_implicit_value( block, 0, 42 );
+    output.update( updated_model );
+    const auto updated_size = std::filesystem::file_size( filename );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        updated_size > written_size
+            && updated_size - written_size < written_size / 2,
+        "Update should only append the changed entries to the archive." );
+    const auto reloaded_model =
+        geode::load_implicit_structural_model( filename );
+    const auto& reloaded_block = reloaded_model.block( block1_id );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.implicit_value_scale() == 2
+            && reloaded_model.implicit_value_offset() == 1,
+        "Implicit value transform should be updated in the archive." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( reloaded_model.implicit_value( reloaded_block, 0 )
+                   - updated_model.implicit_value( block, 0 ) )
+            < geode::GLOBAL_EPSILON,
+        "Changed implicit value should be updated in the archive." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( reloaded_model.implicit_value( reloaded_block, 59 )
+                   - updated_model.implicit_value( block, 59 ) )
+            < geode::GLOBAL_EPSILON,
+        "Unchanged implicit value should be kept in the archive." );
+}
+
+void test_stratigraphic_model_update(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::Logger::info( "Testing StratigraphicModel archive update" );
+    const auto filename = "test_stratigraphic_model_update.og_stgm";
+    geode::OpenGeodeStratigraphicModelOutput output{ filename };
+    output.set_update_fingerprint( true );
+    output.write( model );
+    auto updated_model = model.clone();
+    const auto& block = updated_model.block( block1_id );
+    geode::StratigraphicModelBuilder builder{ updated_model };
+    builder.set_implicit_value( block, 0, 42 );
+    builder.set_stratigraphic_location( block, 0, geode::Point2D{ { 3, 4 } } );
+    output.update( updated_model );
+    const auto reloaded_model = geode::load_stratigraphic_model( filename );
+    const auto& reloaded_block = reloaded_model.block( block1_id );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( reloaded_model.implicit_value( reloaded_block, 0 )
+                   - updated_model.implicit_value( block, 0 ) )
+            < geode::GLOBAL_EPSILON,
+        "Changed implicit value should be updated in the og_stgm archive." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.stratigraphic_coordinates( reloaded_block, 0 )
+                .stratigraphic_location()
+            == geode::Point2D{ { 3, 4 } },
+        "Changed stratigraphic location should be updated in the og_stgm "
+        "archive." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.stratigraphic_coordinates( reloaded_block, 59 )
+                .stratigraphic_location()
+            == updated_model.stratigraphic_coordinates( block, 59 )
+                   .stratigraphic_location(),
+        "Unchanged stratigraphic location should be kept in the og_stgm "
+        "archive." );
+}
+
+void test_mapped_fields_io(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::Logger::info( "Testing mapped fields IO" );
+    const auto filename = "test_stratigraphic_model_mapped.og_stgm";
+    geode::OpenGeodeStratigraphicModelOutput output{ filename };
+    output.set_archive_mode( geode::ARCHIVE_MODE::directory );
+    output.set_save_mapped_fields( true );
+    output.write( model );
+    const auto& block = model.block( block1_id );
+    const geode::detail::MappedImplicitModelFields fields{ absl::StrCat(
+        filename, "/implicit_model_fields.bin" ) };
+    const auto block_fields = fields.block_fields( block );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        fields.nb_blocks() == model.nb_blocks() && block_fields
+            && block_fields->implicit_values[59]
+                   == model.stored_implicit_value( block, 59 )
+            && block_fields->stratigraphic_locations[2 * 59]
+                   == model.stratigraphic_coordinates( block, 59 )
+                          .stratigraphic_location()
+                          .value( 0 ),
+        "Saved fields should hold the block values and locations." );
+    auto reloaded_model = geode::load_stratigraphic_model( filename );
+    const auto& reloaded_block = reloaded_model.block( block1_id );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.has_mapped_implicit_values( reloaded_block ),
+        "Implicit values should be mapped from a directory archive." );
+    const auto& point = block.mesh().point( 59 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.implicit_value( reloaded_block, 59 )
+                == model.implicit_value( block, 59 )
+            && std::fabs(
+                   reloaded_model.implicit_value( reloaded_block, point )
+                       .value()
+                   - model.implicit_value( block, point ).value() )
+                   < geode::GLOBAL_EPSILON,
+        "Mapped implicit values should match the saved ones." );
+    geode::StratigraphicModelBuilder builder{ reloaded_model };
+    builder.set_implicit_value( reloaded_block, 59, 42 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !reloaded_model.has_mapped_implicit_values( reloaded_block )
+            && std::fabs(
+                   reloaded_model.implicit_value( reloaded_block, 59 ) - 42 )
+                   < geode::GLOBAL_EPSILON
+            && reloaded_model.implicit_value( reloaded_block, 0 )
+                   == model.implicit_value( block, 0 ),
+        "Modifying implicit values should drop the mapping." );
+}
+
+void test_model_cache(
+    const geode::StratigraphicModel& model, const geode::uuid& block1_id )
+{
+    geode::Logger::info( "Testing model cache" );
+    const auto filename = "test_implicit_model_cache.og_istrm";
+    geode::save_implicit_structural_model( model, filename );
+    geode::clear_model_cache();
+    const auto cached_model =
+        geode::cached_implicit_structural_model( filename );
+    const auto shared_model =
+        geode::cached_implicit_structural_model( filename );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        cached_model.get() == shared_model.get(),
+        "Cached model should be shared between requests." );
+    const auto statistics = geode::model_cache_statistics();
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        statistics.nb_models == 1 && statistics.nb_misses == 1
+            && statistics.nb_hits == 1,
+        "Model cache should have loaded the model once." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        statistics.nb_bytes
+            > geode::detail::geode_archive_payload_size( filename ),
+        "Model size should add the query trees to the uncompressed files." );
+    const auto& block = cached_model->block( block1_id );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        std::fabs( cached_model->implicit_value( block, 59 )
+                   - model.implicit_value( model.block( block1_id ), 59 ) )
+            < geode::GLOBAL_EPSILON,
+        "Cached model should hold the saved implicit values." );
+    geode::set_model_cache_memory_budget( 0 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        geode::model_cache_statistics().nb_models == 0
+            && geode::model_cache_statistics().nb_evictions == 1,
+        "Model should be evicted when exceeding the memory budget." );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        cached_model->containing_polyhedron( block, block.mesh().point( 59 ) )
+            == model.containing_polyhedron(
+                model.block( block1_id ), block.mesh().point( 59 ) ),
+        "Evicted model should remain valid for its holders." );
+    geode::set_model_cache_memory_budget(
+        std::numeric_limits< std::uint64_t >::max() );
+    const auto reloaded_model =
+        geode::cached_implicit_structural_model( filename );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        reloaded_model.get() != cached_model.get()
+            && geode::model_cache_statistics().nb_misses == 2,
+        "Evicted model should be reloaded on the next request." );
+    geode::clear_model_cache();
+}
+
+void test_instrumentation()
+{
+    const auto records = geode::instrumentation_snapshot();
+    if( !geode::is_instrumentation_enabled() )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test( records.empty(),
+            "Instrumentation snapshot should be empty when disabled" );
+        return;
+    }
+    for( const auto& record : records )
+    {
+        geode::Logger::debug( record.name, " [", record.component_id,
+            "]: ", record.count, " in ", record.seconds, "s" );
+    }
+    const auto inverse_lookup = absl::c_find_if(
+        records, []( const geode::InstrumentationRecord& record ) {
+            return record.name
+                   == "StratigraphicModel::stratigraphic_containing_polyhedron";
+        } );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        inverse_lookup != records.end() && inverse_lookup->count > 0,
+        "Stratigraphic inverse lookups should have been counted" );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        !inverse_lookup->component_id.empty(),
+        "Stratigraphic inverse lookups should be attributed to a block" );
+    geode::reset_instrumentation();
+    for( const auto& record : geode::instrumentation_snapshot() )
+    {
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            record.count == 0, "Instrumentation should be reset" );
+        geode::OpenGeodeGeosciencesImplicitException::test(
+            record.component_id.empty(),
+            "Instrumentation reset should drop component records" );
+    }
+}
+
 void test_move( geode::StratigraphicModel& implicit_model )
 {
     const auto old_implicit_id = implicit_model.implicit_attribute_id();
@@ -288,11 +1250,38 @@ int main()
         test_model( model, block1_id );
         geode::Logger::info( "Testing copy" );
         test_copy( model, block1_id );
+        geode::Logger::info( "Testing implicit value transform" );
+        test_implicit_value_transform( model, block1_id );
+        geode::Logger::info( "Testing single precision storage" );
+        test_single_precision_storage( model, block1_id );
+        test_stored_value_changes( model, block1_id );
+        geode::Logger::info( "Testing interleaved stratigraphic coordinates" );
+        test_interleaved_coordinates( model, block1_id );
+        geode::Logger::info( "Testing attribute transfer" );
+        test_attribute_transfer( model, block1_id );
+        geode::Logger::info( "Testing slice" );
+        test_slice( model, block1_id );
+        geode::Logger::info( "Testing stratigraphic columns" );
+        test_stratigraphic_columns( model, block1_id );
+        geode::Logger::info( "Testing stratigraphic unit labels" );
+        test_stratigraphic_unit_labels( model, block1_id );
+        geode::Logger::info( "Testing volumetrics" );
+        test_volumetrics( model, block1_id );
+        test_single_tetrahedron_volumetrics();
         DEBUG( "Testing save stratigraphic surfaces" );
         test_save_stratigraphic_surfaces( model );
+        test_stratigraphic_surfaces( model );
+        test_save_stratigraphic_blocks( model );
         DEBUG( "Testing IO" );
         test_io( model, block1_id );
+        test_query_trees_io( model, block1_id );
+        test_archive_modes( model, block1_id );
+        test_incremental_io( model, block1_id );
+        test_stratigraphic_model_update( model, block1_id );
+        test_mapped_fields_io( model, block1_id );
+        test_model_cache( model, block1_id );
         test_move( model );
+        test_instrumentation();
         geode::Logger::info( "TEST SUCCESS" );
         return 0;
     }
@@ -44,6 +44,7 @@
 #include <geode/geosciences/implicit/representation/builder/stratigraphic_section_builder.hpp>
 #include <geode/geosciences/implicit/representation/core/stratigraphic_section.hpp>
 #include <geode/geosciences/implicit/representation/io/implicit_cross_section_input.hpp>
+#include <geode/geosciences/implicit/representation/io/geode/geode_implicit_cross_section_output.hpp>
 #include <geode/geosciences/implicit/representation/io/implicit_cross_section_output.hpp>
 
 geode::StratigraphicSection import_section_with_stratigraphy()
@@ -176,6 +177,24 @@ void test_io( const geode::StratigraphicSection& implicit_model )
     test_section( model_reload );
 }
 
+void test_query_trees_io( const geode::StratigraphicSection& implicit_model )
+{
+    geode::Logger::info( "Testing query trees IO" );
+    const auto filename = "test_implicit_section_query_trees.og_ixsctn";
+    geode::OpenGeodeImplicitCrossSectionOutput output{ filename };
+    output.set_save_query_trees( true );
+    output.write( implicit_model );
+    const auto model_reload = geode::load_implicit_cross_section( filename );
+    const geode::uuid surface0_id{ "00000000-2d28-4eeb-8000-000027dab659" };
+    const auto& surface0 = implicit_model.surface( surface0_id );
+    const auto& point = surface0.mesh().point( 1773 );
+    geode::OpenGeodeGeosciencesImplicitException::test(
+        model_reload.containing_polygon(
+            model_reload.surface( surface0_id ), point )
+            == implicit_model.containing_polygon( surface0, point ),
+        "Loaded query tree should give the same containing polygon." );
+}
+
 void test_move( geode::StratigraphicSection& implicit_model )
 {
     const auto old_implicit_id = implicit_model.implicit_attribute_id();
@@ -201,6 +220,7 @@ int main()
         test_section( model );
         // test_save_stratigraphic_lines( model );
         test_io( model );
+        test_query_trees_io( model );
         test_move( model );
         test_backward_io( absl::StrCat(
             geode::DATA_PATH, "test_old_implicit_crossection.og_ixsctn" ) );